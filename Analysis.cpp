@@ -0,0 +1,156 @@
+/**
+ * @file Analysis.cpp
+ * @brief Implementación del análisis estructural de matrices y de la selección automática del método de solución.
+ *
+ * @section features_sec Características principales
+ * -Medición de dominancia diagonal, simetría, fracción de ceros y ancho de banda en una sola pasada.
+ * -Estimación del costo de los métodos directos e iterativos.
+ * -Selección automática del método con explicación de la elección.
+ */
+#include "Analysis.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+/**
+ * @brief Analiza la estructura de una matriz cuadrada de coeficientes.
+ *
+ * Recorre la matriz una sola vez: para cada fila acumula la suma de los elementos fuera de la diagonal
+ * (dominancia), cuenta los ceros, actualiza el ancho de banda y compara cada elemento con su simétrico.
+ *
+ * @param A Matriz cuadrada de coeficientes (no se modifica).
+ * @return AnalisisMatriz Propiedades medidas de la matriz.
+ *
+ * @throw std::invalid_argument Si la matriz no es cuadrada.
+ */
+AnalisisMatriz analizarMatriz(Matrix& A) {
+    const int n = A.getRows();
+    if (A.getCols() != n) {
+        throw std::invalid_argument("El análisis requiere una matriz cuadrada.");
+    }
+    const double TOLERANCIA_SIMETRIA = 1e-10;
+
+    AnalisisMatriz analisis;
+    analisis.size = n;
+    analisis.diagonalNoNula = true;
+    analisis.diagonalPositiva = true;
+    analisis.simetrica = true;
+    analisis.razonDominancia = n > 0 ? INFINITY : 0.0;
+    analisis.anchoBanda = 0;
+
+    long long ceros = 0;
+    for (int i = 0; i < n; i++) {
+        double sumaFuera = 0.0;
+        for (int j = 0; j < n; j++) {
+            double valor = A.at(i, j);
+            if (valor == 0.0) {
+                ceros++;
+                continue;
+            }
+            analisis.anchoBanda = std::max(analisis.anchoBanda, std::abs(i - j));
+            if (j != i) {
+                sumaFuera += std::abs(valor);
+            }
+            // Cada par (i,j) se compara una sola vez, desde la parte triangular inferior
+            if (analisis.simetrica && j < i) {
+                double simetrico = A.at(j, i);
+                double escala = std::max({std::abs(valor), std::abs(simetrico), 1.0});
+                if (std::abs(valor - simetrico) > TOLERANCIA_SIMETRIA * escala) {
+                    analisis.simetrica = false;
+                }
+            }
+        }
+        double diagonal = A.at(i, i);
+        if (diagonal == 0.0) analisis.diagonalNoNula = false;
+        if (diagonal <= 0.0) analisis.diagonalPositiva = false;
+        double razon = sumaFuera > 0.0 ? std::abs(diagonal) / sumaFuera : INFINITY;
+        analisis.razonDominancia = std::min(analisis.razonDominancia, razon);
+    }
+    // La parte superior también debe revisarse para los ceros de la parte inferior
+    if (analisis.simetrica) {
+        for (int i = 0; i < n && analisis.simetrica; i++) {
+            for (int j = i + 1; j < n; j++) {
+                if (A.at(j, i) == 0.0 && A.at(i, j) != 0.0) {
+                    analisis.simetrica = false;
+                    break;
+                }
+            }
+        }
+    }
+
+    const double dn = static_cast<double>(n);
+    analisis.diagonalDominante = analisis.diagonalNoNula && analisis.razonDominancia > 1.0;
+    analisis.fraccionCeros = n > 0 ? static_cast<double>(ceros) / (dn * dn) : 0.0;
+    analisis.costoDirecto = 2.0 * dn * dn * dn / 3.0;
+    // metodoIterativoGeneral recorre la fila completa, por lo que un barrido cuesta ≈ 2n² aunque haya ceros
+    analisis.costoIteracion = 2.0 * dn * dn;
+    return analisis;
+}
+
+/**
+ * @brief Elige el método más rápido que se puede aplicar con garantías a partir del análisis.
+ *
+ * Con dominancia diagonal estricta, la norma infinito de la matriz de iteración de Jacobi está acotada por
+ * q = 1 / razonDominancia, así que bastan ⌈log(tolerancia) / log(q)⌉ barridos; Gauss-Seidel converge al menos
+ * igual de rápido con el mismo costo por barrido, por lo que se prefiere sobre Jacobi.
+ *
+ * @param analisis Resultado de analizarMatriz.
+ * @param tolerancia Tolerancia con la que se resolverá el sistema, para estimar las iteraciones.
+ * @param motivo Recibe una explicación legible de la elección.
+ * @return MetodoSolucion Método elegido.
+ */
+MetodoSolucion elegirMetodo(const AnalisisMatriz& analisis, double tolerancia, String& motivo) {
+    String ceros; ceros.fromDouble(analisis.fraccionCeros * 100.0, 1);
+    String banda; banda.fromInt(analisis.anchoBanda);
+    String estructura = String(" (ceros: ") + ceros + String("%, ancho de banda: ") + banda +
+                        String(analisis.simetrica ? ", simétrica)." : ", no simétrica).");
+
+    if (!analisis.diagonalDominante) {
+        motivo = String("Gauss: la matriz no es estrictamente diagonal dominante, Jacobi y Gauss-Seidel podrían no converger") + estructura;
+        return MetodoSolucion::Gauss;
+    }
+
+    double q = 1.0 / analisis.razonDominancia;
+    double iteraciones = q > 0.0 ? std::ceil(std::log(tolerancia) / std::log(q)) : 1.0;
+    iteraciones = std::max(iteraciones, 1.0);
+    double costoIterativo = iteraciones * analisis.costoIteracion;
+
+    String estimadas; estimadas.fromInt(static_cast<int>(std::min(iteraciones, 1e9)));
+    if (costoIterativo < analisis.costoDirecto) {
+        motivo = String("Gauss-Seidel: la matriz es diagonal dominante, convergencia garantizada en a lo más ") + estimadas +
+                 String(" iteraciones, más barato que la eliminación directa") + estructura;
+        return MetodoSolucion::GaussSeidel;
+    }
+    motivo = String("Gauss: la matriz es diagonal dominante, pero las ") + estimadas +
+             String(" iteraciones estimadas cuestan más que la eliminación directa") + estructura;
+    return MetodoSolucion::Gauss;
+}
+
+/**
+ * @brief Resuelve un sistema eligiendo automáticamente el método a partir del análisis de A.
+ *
+ * @param A Matriz de coeficientes del sistema (puede modificarse si se usa un método directo).
+ * @param b Vector columna de términos independientes (puede modificarse si se usa un método directo).
+ * @param tolerancia Criterio de parada de los métodos iterativos.
+ * @param maxIter Número máximo de iteraciones de los métodos iterativos.
+ * @param motivo Recibe el método elegido y la razón de la elección.
+ * @return Matrix vectorSolución solución del sistema.
+ *
+ * @throw std::runtime_error Si el sistema no tiene solución única.
+ */
+Matrix resolverAutomatico(Matrix& A, Matrix& b, double tolerancia, int maxIter, String& motivo) {
+    AnalisisMatriz analisis = analizarMatriz(A);
+    MetodoSolucion metodo = elegirMetodo(analisis, tolerancia, motivo);
+    // Con dominancia diagonal estricta la eliminación no necesita buscar pivotes ni intercambiar filas
+    EstrategiaPivoteo estrategia = analisis.diagonalDominante ? EstrategiaPivoteo::SinPivoteo : EstrategiaPivoteo::Parcial;
+    if (metodo == MetodoSolucion::Gauss) {
+        return gaussElimination(A, b, false, false, estrategia);
+    }
+    try {
+        return resolverSistema(metodo, A, b, tolerancia, maxIter);
+    } catch (const std::runtime_error&) {
+        // Los métodos iterativos no modifican A ni b, así que se puede recurrir a Gauss directamente
+        motivo = motivo + String(" No convergió en el límite de iteraciones; se usó Gauss.");
+        return gaussElimination(A, b, false, false, estrategia);
+    }
+}
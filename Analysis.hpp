@@ -0,0 +1,71 @@
+/**
+ * @file Analysis.hpp
+ * @brief Declaración del análisis estructural de matrices y de la selección automática del método de solución.
+ *
+ * El análisis mide en una sola pasada sobre la matriz las propiedades que determinan qué método conviene:
+ * dominancia diagonal, simetría, fracción de ceros, ancho de banda y costo estimado de cada método.
+ */
+#ifndef ANALYSIS_HPP
+#define ANALYSIS_HPP
+
+#include "Matrix.hpp"
+#include "Methods.hpp"
+#include "String.hpp"
+
+/**
+ * @brief Resultado del análisis estructural de una matriz de coeficientes.
+ */
+struct AnalisisMatriz {
+    int size;                      ///< Número de ecuaciones.
+    bool diagonalNoNula;           ///< Ningún elemento de la diagonal es cero.
+    bool diagonalDominante;        ///< Dominancia diagonal estricta por filas.
+    double razonDominancia;        ///< Mínimo de |a_ii| / Σ_{j≠i} |a_ij| sobre todas las filas (mayor a 1 indica dominancia estricta).
+    bool simetrica;                ///< a_ij = a_ji dentro de una tolerancia relativa.
+    bool diagonalPositiva;         ///< Todos los elementos de la diagonal son positivos.
+    double fraccionCeros;          ///< Fracción de elementos nulos de la matriz.
+    int anchoBanda;                ///< Máximo |i - j| entre los elementos no nulos.
+    double costoDirecto;           ///< Operaciones estimadas de la eliminación de Gauss (≈ 2n³/3).
+    double costoIteracion;         ///< Operaciones estimadas de un barrido iterativo sobre la matriz densa (≈ 2n², aunque haya ceros).
+};
+
+/**
+ * @brief Analiza la estructura de una matriz cuadrada de coeficientes.
+ *
+ * @param A Matriz cuadrada de coeficientes (no se modifica).
+ * @return AnalisisMatriz Propiedades medidas de la matriz.
+ *
+ * @throw std::invalid_argument Si la matriz no es cuadrada.
+ */
+AnalisisMatriz analizarMatriz(Matrix& A);
+
+/**
+ * @brief Elige el método más rápido que se puede aplicar con garantías a partir del análisis.
+ *
+ * Los métodos iterativos solo se eligen si la matriz es estrictamente diagonal dominante (lo que garantiza
+ * su convergencia) y su costo estimado es menor que el de la eliminación directa; en otro caso se usa Gauss.
+ *
+ * @param analisis Resultado de analizarMatriz.
+ * @param tolerancia Tolerancia con la que se resolverá el sistema, para estimar las iteraciones.
+ * @param motivo Recibe una explicación legible de la elección.
+ * @return MetodoSolucion Método elegido.
+ */
+MetodoSolucion elegirMetodo(const AnalisisMatriz& analisis, double tolerancia, String& motivo);
+
+/**
+ * @brief Resuelve un sistema eligiendo automáticamente el método a partir del análisis de A.
+ *
+ * Si se eligió un método iterativo y aun así no converge, se recurre a la eliminación de Gauss
+ * sobre el sistema original. Si A es estrictamente diagonal dominante, Gauss se aplica sin pivoteo.
+ *
+ * @param A Matriz de coeficientes del sistema (puede modificarse si se usa un método directo).
+ * @param b Vector columna de términos independientes (puede modificarse si se usa un método directo).
+ * @param tolerancia Criterio de parada de los métodos iterativos.
+ * @param maxIter Número máximo de iteraciones de los métodos iterativos.
+ * @param motivo Recibe el método elegido y la razón de la elección.
+ * @return Matrix vectorSolución solución del sistema.
+ *
+ * @throw std::runtime_error Si el sistema no tiene solución única.
+ */
+Matrix resolverAutomatico(Matrix& A, Matrix& b, double tolerancia, int maxIter, String& motivo);
+
+#endif
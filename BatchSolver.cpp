@@ -0,0 +1,328 @@
+/**
+ * @file BatchSolver.cpp
+ * @brief Implementación de la clase LoteSistemas y del método de Gauss por lotes.
+ *
+ * @section features_sec Características principales
+ * -Almacenamiento de los sistemas como estructura de arreglos para vectorizar a través de sistemas.
+ * -Un arreglo por bloque de sistemas, reservado y puesto en cero por el hilo que lo resolverá (primer toque).
+ * -Pivoteo parcial independiente para cada sistema.
+ * -Reparto de los sistemas entre varios hilos y banderas de fallo por sistema en lugar de excepciones.
+ * -Fijación opcional de cada hilo a un núcleo según la topología NUMA.
+ */
+#include "BatchSolver.hpp"
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <stdexcept>
+#include <thread>
+#include "ExecutionControl.hpp"
+
+LoteSistemas::LoteSistemas(int size, int sistemas, int hilos, PoliticaAfinidad afinidad)
+    : n(size), numSistemas(sistemas) {
+    if (size <= 0 || sistemas <= 0) {
+        throw std::invalid_argument("El tamaño y el número de sistemas del lote deben ser positivos.");
+    }
+    const int ALINEACION = 8;
+    if (hilos <= 0) {
+        hilos = static_cast<int>(std::thread::hardware_concurrency());
+        if (hilos <= 0) hilos = 1;
+    }
+    // Bloques de un múltiplo de 8 sistemas para no partir registros SIMD; no tiene sentido usar más bloques que eso
+    numBloques = std::min(hilos, (numSistemas + ALINEACION - 1) / ALINEACION);
+    porBloque = (numSistemas + numBloques - 1) / numBloques;
+    porBloque = ((porBloque + ALINEACION - 1) / ALINEACION) * ALINEACION;
+    numBloques = (numSistemas + porBloque - 1) / porBloque;
+
+    coeficientes = std::make_unique<std::unique_ptr<double[]>[]>(numBloques);
+    terminos = std::make_unique<std::unique_ptr<double[]>[]>(numBloques);
+    fallos = std::make_unique<unsigned char[]>(numSistemas);
+
+    // make_unique pone el bloque en cero: la primera escritura de cada página la hace el hilo dueño del bloque
+    auto reservarBloque = [this](int bloque) {
+        const size_t ancho = static_cast<size_t>(getAnchoBloque(bloque));
+        coeficientes[bloque] = std::make_unique<double[]>(static_cast<size_t>(n) * n * ancho);
+        terminos[bloque] = std::make_unique<double[]>(static_cast<size_t>(n) * ancho);
+    };
+    if (numBloques == 1 && afinidad == PoliticaAfinidad::Ninguna) {
+        reservarBloque(0);
+        return;
+    }
+    std::unique_ptr<std::exception_ptr[]> errores = std::make_unique<std::exception_ptr[]>(numBloques);
+    std::unique_ptr<std::thread[]> trabajadores = std::make_unique<std::thread[]>(numBloques);
+    for (int h = 0; h < numBloques; h++) {
+        trabajadores[h] = std::thread([&, h]() {
+            try {
+                fijarHilo(afinidad, h);
+                reservarBloque(h);
+            } catch (...) {
+                errores[h] = std::current_exception();
+            }
+        });
+    }
+    for (int h = 0; h < numBloques; h++) trabajadores[h].join();
+    for (int h = 0; h < numBloques; h++) {
+        if (errores[h]) std::rethrow_exception(errores[h]);
+    }
+}
+
+int LoteSistemas::getSize() const {
+    return n;
+}
+
+int LoteSistemas::getNumSistemas() const {
+    return numSistemas;
+}
+
+double& LoteSistemas::coeficiente(int sistema, int row, int col) {
+    if (sistema < 0 || sistema >= numSistemas || row < 0 || row >= n || col < 0 || col >= n) {
+        throw std::out_of_range("Índices fuera de rango");
+    }
+    const int bloque = sistema / porBloque;
+    const size_t ancho = static_cast<size_t>(getAnchoBloque(bloque));
+    return coeficientes[bloque][(static_cast<size_t>(row) * n + col) * ancho + sistema % porBloque];
+}
+
+double& LoteSistemas::termino(int sistema, int row) {
+    if (sistema < 0 || sistema >= numSistemas || row < 0 || row >= n) {
+        throw std::out_of_range("Índices fuera de rango");
+    }
+    const int bloque = sistema / porBloque;
+    const size_t ancho = static_cast<size_t>(getAnchoBloque(bloque));
+    return terminos[bloque][static_cast<size_t>(row) * ancho + sistema % porBloque];
+}
+
+bool LoteSistemas::fallo(int sistema) const {
+    if (sistema < 0 || sistema >= numSistemas) {
+        throw std::out_of_range("Índice fuera de rango");
+    }
+    return fallos[sistema] != 0;
+}
+
+void LoteSistemas::cargarSistema(int sistema, Matrix& A, Matrix& b) {
+    if (A.getRows() != n || A.getCols() != n || b.getRows() != n || b.getCols() != 1) {
+        throw std::invalid_argument("Las dimensiones del sistema no coinciden con las del lote.");
+    }
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            coeficiente(sistema, i, j) = A.at(i, j);
+        }
+        termino(sistema, i) = b.at(i, 0);
+    }
+}
+
+Matrix LoteSistemas::solucion(int sistema) {
+    Matrix x(n, 1);
+    for (int i = 0; i < n; i++) {
+        x.at(i, 0) = termino(sistema, i);
+    }
+    return x;
+}
+
+int LoteSistemas::getNumBloques() const {
+    return numBloques;
+}
+
+int LoteSistemas::getInicioBloque(int bloque) const {
+    if (bloque < 0 || bloque >= numBloques) {
+        throw std::out_of_range("Bloque fuera de rango");
+    }
+    return bloque * porBloque;
+}
+
+int LoteSistemas::getAnchoBloque(int bloque) const {
+    return std::min(porBloque, numSistemas - getInicioBloque(bloque));
+}
+
+double* LoteSistemas::datosCoeficientes(int bloque) {
+    getInicioBloque(bloque);
+    return coeficientes[bloque].get();
+}
+
+double* LoteSistemas::datosTerminos(int bloque) {
+    getInicioBloque(bloque);
+    return terminos[bloque].get();
+}
+
+unsigned char* LoteSistemas::datosFallos() {
+    return fallos.get();
+}
+
+/**
+ * @brief Resuelve los sistemas de un bloque del lote; cada hilo ejecuta esta función sobre sus bloques.
+ *
+ * @param A Coeficientes del bloque en formato SoA.
+ * @param b Términos independientes del bloque en formato SoA.
+ * @param fallos Banderas de fallo del primer sistema del bloque en adelante.
+ * @param n Tamaño de cada sistema.
+ * @param ancho Número de sistemas del bloque (distancia entre dos elementos consecutivos de un mismo sistema).
+ * @param control Control de ejecución que consultan los hilos trabajadores; con nullptr la función corre en el
+ *        hilo que llamó a gaussEliminationLote y verifica el control activo con verificarInterrupcion.
+ * @return int Número de sistemas del bloque que no pudieron resolverse, o -1 si un trabajador se interrumpió.
+ */
+static int resolverBloqueLote(double* A, double* b, unsigned char* fallos, int n, int ancho,
+                              const ControlEjecucion* control) {
+    const double TOLERANCIA = 1e-12;
+    const size_t paso = static_cast<size_t>(ancho);
+
+    // Arreglos de trabajo, uno por sistema del bloque
+    std::unique_ptr<int[]> filaPivote = std::make_unique<int[]>(ancho);
+    std::unique_ptr<double[]> valorPivote = std::make_unique<double[]>(ancho);
+    std::unique_ptr<double[]> inversoPivote = std::make_unique<double[]>(ancho);
+    std::unique_ptr<double[]> factor = std::make_unique<double[]>(ancho);
+
+    // Puntero al elemento (i,j) del primer sistema del bloque
+    auto coef = [&](int i, int j) { return A + (static_cast<size_t>(i) * n + j) * paso; };
+    auto term = [&](int i) { return b + static_cast<size_t>(i) * paso; };
+
+    for (int k = 0; k < ancho; k++) fallos[k] = 0;
+
+    for (int column = 0; column < n; column++) {
+        // Los avisos de progreso solo se envían desde el hilo que llamó; los trabajadores consultan el estado
+        if (control == nullptr) {
+            verificarInterrupcion(RegionMedida::Eliminacion, column, n);
+        } else if (control->estado() != EstadoEjecucion::Activa) {
+            return -1;
+        }
+
+        // 1. Encontrar, en cada sistema, la fila con el mayor pivote
+        const double* diagonal = coef(column, column);
+        for (int k = 0; k < ancho; k++) {
+            filaPivote[k] = column;
+            valorPivote[k] = std::abs(diagonal[k]);
+        }
+        for (int row = column + 1; row < n; row++) {
+            const double* candidato = coef(row, column);
+            for (int k = 0; k < ancho; k++) {
+                double valor = std::abs(candidato[k]);
+                bool mayor = valor > valorPivote[k];
+                valorPivote[k] = mayor ? valor : valorPivote[k];
+                filaPivote[k] = mayor ? row : filaPivote[k];
+            }
+        }
+
+        // 2. Intercambiar filas solo en los sistemas que lo necesitan (a la izquierda ya hay ceros)
+        for (int k = 0; k < ancho; k++) {
+            int maxRow = filaPivote[k];
+            if (maxRow != column) {
+                for (int col = column; col < n; col++) {
+                    std::swap(coef(column, col)[k], coef(maxRow, col)[k]);
+                }
+                std::swap(term(column)[k], term(maxRow)[k]);
+            }
+        }
+
+        // 3. Marcar los sistemas singulares; su inverso queda en cero para no propagar infinitos
+        for (int k = 0; k < ancho; k++) {
+            bool singular = valorPivote[k] < TOLERANCIA;
+            fallos[k] |= singular ? 1 : 0;
+            inversoPivote[k] = singular ? 0.0 : 1.0 / diagonal[k];
+        }
+
+        // 4. Eliminar hacia abajo en todos los sistemas a la vez
+        const double* terminoPivote = term(column);
+        for (int row = column + 1; row < n; row++) {
+            double* filaColumna = coef(row, column);
+            for (int k = 0; k < ancho; k++) {
+                factor[k] = filaColumna[k] * inversoPivote[k];
+                filaColumna[k] = 0.0;
+            }
+            for (int col = column + 1; col < n; col++) {
+                double* destino = coef(row, col);
+                const double* origen = coef(column, col);
+                for (int k = 0; k < ancho; k++) {
+                    destino[k] -= factor[k] * origen[k];
+                }
+            }
+            double* terminoFila = term(row);
+            for (int k = 0; k < ancho; k++) {
+                terminoFila[k] -= factor[k] * terminoPivote[k];
+            }
+        }
+    }
+
+    // 5. Sustitución regresiva; la solución reemplaza a los términos independientes
+    for (int row = n - 1; row >= 0; row--) {
+        double* terminoFila = term(row);
+        for (int col = row + 1; col < n; col++) {
+            const double* coeficienteFila = coef(row, col);
+            const double* conocido = term(col);
+            for (int k = 0; k < ancho; k++) {
+                terminoFila[k] -= coeficienteFila[k] * conocido[k];
+            }
+        }
+        const double* diagonal = coef(row, row);
+        for (int k = 0; k < ancho; k++) {
+            terminoFila[k] = fallos[k] ? 0.0 : terminoFila[k] / diagonal[k];
+        }
+    }
+
+    int numFallos = 0;
+    for (int k = 0; k < ancho; k++) numFallos += fallos[k];
+    return numFallos;
+}
+
+/**
+ * @brief Resuelve todos los sistemas de un lote mediante eliminación de Gauss con pivoteo parcial.
+ *
+ * Reparte los bloques del lote (múltiplos de 8 sistemas para no partir registros SIMD) en rangos contiguos,
+ * uno por hilo; el hilo h se fija como el hilo que reservó el bloque h.
+ *
+ * @param lote Lote de sistemas (los coeficientes se destruyen y los términos se reemplazan por las soluciones).
+ * @param numHilos Número de hilos a utilizar; 0 usa uno por bloque del lote.
+ * @param afinidad Política para fijar cada hilo a un núcleo.
+ * @return int Número de sistemas que no pudieron resolverse.
+ */
+int gaussEliminationLote(LoteSistemas& lote, int numHilos, PoliticaAfinidad afinidad) {
+    const int n = lote.getSize();
+    const int numBloques = lote.getNumBloques();
+
+    // No tiene sentido usar más hilos que bloques de sistemas
+    if (numHilos <= 0 || numHilos > numBloques) {
+        numHilos = numBloques;
+    }
+    unsigned char* fallos = lote.datosFallos();
+    auto resolverBloque = [&lote, n, fallos](int bloque, const ControlEjecucion* control) {
+        return resolverBloqueLote(lote.datosCoeficientes(bloque), lote.datosTerminos(bloque),
+                                  fallos + lote.getInicioBloque(bloque), n, lote.getAnchoBloque(bloque), control);
+    };
+
+    if (numHilos <= 1 && afinidad == PoliticaAfinidad::Ninguna) {
+        int numFallos = 0;
+        for (int bloque = 0; bloque < numBloques; bloque++) {
+            numFallos += resolverBloque(bloque, nullptr);
+        }
+        return numFallos;
+    }
+    ControlEjecucion* control = SesionControl::activo();
+
+    std::unique_ptr<int[]> fallosPorHilo = std::make_unique<int[]>(numHilos);
+    std::unique_ptr<std::thread[]> hilos = std::make_unique<std::thread[]>(numHilos);
+    for (int h = 0; h < numHilos; h++) {
+        int desde = static_cast<int>(static_cast<long long>(numBloques) * h / numHilos);
+        int hasta = static_cast<int>(static_cast<long long>(numBloques) * (h + 1) / numHilos);
+        hilos[h] = std::thread([=, &fallosPorHilo, &resolverBloque]() {
+            fijarHilo(afinidad, h);
+            fallosPorHilo[h] = 0;
+            for (int bloque = desde; bloque < hasta; bloque++) {
+                int resultado = resolverBloque(bloque, control);
+                if (resultado < 0) {
+                    fallosPorHilo[h] = -1;
+                    return;
+                }
+                fallosPorHilo[h] += resultado;
+            }
+        });
+    }
+
+    int numFallos = 0;
+    bool interrumpido = false;
+    for (int h = 0; h < numHilos; h++) {
+        hilos[h].join();
+        interrumpido = interrumpido || fallosPorHilo[h] < 0;
+        numFallos += std::max(fallosPorHilo[h], 0);
+    }
+    if (interrumpido) {
+        throw std::runtime_error(mensajeInterrupcion(control->comprobar()));
+    }
+    return numFallos;
+}
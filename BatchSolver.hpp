@@ -0,0 +1,180 @@
+/**
+ * @file BatchSolver.hpp
+ * @brief Declaración de la clase LoteSistemas y del método de Gauss por lotes.
+ *
+ * Permite resolver miles de sistemas pequeños e independientes del mismo tamaño en una sola llamada.
+ * Los sistemas se almacenan como estructura de arreglos (SoA): el elemento (i,j) de todos los sistemas
+ * ocupa posiciones contiguas en memoria, de modo que cada operación de la eliminación se aplica a todos
+ * los sistemas a la vez y el compilador puede vectorizarla. El lote se divide en bloques de sistemas, uno
+ * por hilo, y cada bloque vive en su propio arreglo reservado por el hilo que lo resolverá.
+ */
+#ifndef BATCH_SOLVER_HPP
+#define BATCH_SOLVER_HPP
+
+#include <memory>
+#include "Matrix.hpp"
+#include "Numa.hpp"
+
+/**
+ * @class LoteSistemas
+ * @brief Conjunto de `K` sistemas de tamaño `n` x `n` almacenados como estructura de arreglos.
+ *
+ * Los sistemas se reparten en bloques consecutivos de `ancho` sistemas (múltiplo de 8, salvo quizá el último).
+ * Dentro de un bloque, el coeficiente (i,j) de su sistema k se guarda en la posición `(i*n + j)*ancho + k` y el
+ * término independiente i en `i*ancho + k`. Cada bloque se reserva y se pone en cero en un hilo fijado con la
+ * misma política y el mismo número que el hilo de gaussEliminationLote que lo resolverá; así, por la política
+ * de primer toque de Linux, sus páginas quedan en la memoria del nodo NUMA donde se procesan y ninguna página
+ * mezcla sistemas de dos hilos.
+ *
+ * Tras llamar a gaussEliminationLote, los términos independientes contienen la solución de cada sistema y las
+ * banderas de fallo indican qué sistemas no pudieron resolverse.
+ */
+class LoteSistemas {
+    private:
+        int n;
+        int numSistemas;
+        int numBloques;
+        int porBloque; // Sistemas por bloque; el último puede tener menos. //
+        std::unique_ptr<std::unique_ptr<double[]>[]> coeficientes; // Por bloque: n*n*ancho valores, el índice del sistema es el más rápido. //
+        std::unique_ptr<std::unique_ptr<double[]>[]> terminos;     // Por bloque: n*ancho valores, el índice del sistema es el más rápido. //
+        std::unique_ptr<unsigned char[]> fallos; // Una bandera por sistema. //
+    public:
+        /**
+        * @brief Constructor del lote, inicializa todos los valores en cero.
+        *
+        * @param size Tamaño de cada sistema (número de ecuaciones).
+        * @param sistemas Número de sistemas del lote.
+        * @param hilos Número de bloques en que se divide el lote, uno por hilo de gaussEliminationLote; 0 usa todos
+        *        los núcleos disponibles. Se reduce si no alcanzan los sistemas para bloques de 8.
+        * @param afinidad Política con la que se fija el hilo que reserva cada bloque; debe ser la misma que se pase
+        *        a gaussEliminationLote para que cada bloque quede en el nodo de su hilo.
+        *
+        * @throws std::invalid_argument Si el tamaño o el número de sistemas no son positivos.
+        */
+        LoteSistemas(int size, int sistemas, int hilos = 0, PoliticaAfinidad afinidad = PoliticaAfinidad::Ninguna);
+
+        /**
+        * @brief Devuelve el número de ecuaciones de cada sistema.
+        * @return Tamaño de los sistemas.
+        */
+        int getSize() const;
+
+        /**
+        * @brief Devuelve el número de sistemas del lote.
+        * @return Número de sistemas.
+        */
+        int getNumSistemas() const;
+
+        /**
+        * @brief Acceso con verificación de límites a un coeficiente de un sistema.
+        *
+        * @param sistema Índice del sistema (0 <= sistema < K).
+        * @param row Fila del coeficiente.
+        * @param col Columna del coeficiente.
+        * @return double& Referencia al coeficiente.
+        *
+        * @throws std::out_of_range Si algún índice está fuera de rango.
+        */
+        double& coeficiente(int sistema, int row, int col);
+
+        /**
+        * @brief Acceso con verificación de límites a un término independiente (o a la solución tras resolver).
+        *
+        * @param sistema Índice del sistema.
+        * @param row Fila del término.
+        * @return double& Referencia al término.
+        *
+        * @throws std::out_of_range Si algún índice está fuera de rango.
+        */
+        double& termino(int sistema, int row);
+
+        /**
+        * @brief Indica si el sistema no pudo resolverse en la última llamada a gaussEliminationLote.
+        *
+        * @param sistema Índice del sistema.
+        * @return true si el sistema es singular o numéricamente inestable.
+        *
+        * @throws std::out_of_range Si el índice está fuera de rango.
+        */
+        bool fallo(int sistema) const;
+
+        /**
+        * @brief Copia un sistema almacenado como Matrix dentro del lote.
+        *
+        * @param sistema Índice del sistema destino.
+        * @param A Matriz de coeficientes de `n` x `n`.
+        * @param b Vector columna de `n` términos independientes.
+        *
+        * @throws std::invalid_argument Si las dimensiones no coinciden con las del lote.
+        */
+        void cargarSistema(int sistema, Matrix& A, Matrix& b);
+
+        /**
+        * @brief Copia la solución de un sistema en un vector columna.
+        *
+        * @param sistema Índice del sistema.
+        * @return Matrix Vector solución (solo es válido si `fallo(sistema)` es falso).
+        */
+        Matrix solucion(int sistema);
+
+        /**
+        * @brief Número de bloques en que se divide el lote.
+        */
+        int getNumBloques() const;
+
+        /**
+        * @brief Índice del primer sistema del bloque.
+        *
+        * @throws std::out_of_range Si el bloque está fuera de rango.
+        */
+        int getInicioBloque(int bloque) const;
+
+        /**
+        * @brief Número de sistemas del bloque (distancia entre dos elementos consecutivos de un mismo sistema).
+        *
+        * @throws std::out_of_range Si el bloque está fuera de rango.
+        */
+        int getAnchoBloque(int bloque) const;
+
+        /**
+        * @brief Puntero a los coeficientes del bloque en formato SoA, para llenarlo sin copias intermedias.
+        *
+        * @throws std::out_of_range Si el bloque está fuera de rango.
+        */
+        double* datosCoeficientes(int bloque);
+
+        /**
+        * @brief Puntero a los términos independientes del bloque en formato SoA.
+        *
+        * @throws std::out_of_range Si el bloque está fuera de rango.
+        */
+        double* datosTerminos(int bloque);
+
+        /**
+        * @brief Puntero a las banderas de fallo, una por sistema.
+        */
+        unsigned char* datosFallos();
+};
+
+/**
+ * @brief Resuelve todos los sistemas de un lote mediante eliminación de Gauss con pivoteo parcial.
+ *
+ * Cada paso de la eliminación recorre el índice de sistema en el ciclo más interno, por lo que los
+ * sistemas se procesan en los carriles SIMD del procesador. El pivoteo se decide por separado en cada sistema.
+ * Los bloques del lote se reparten entre `numHilos` hilos; el hilo h se fija con la misma política y número que
+ * el hilo que reservó el bloque h, por lo que con un hilo por bloque cada uno trabaja en la memoria de su nodo.
+ *
+ * A diferencia de gaussElimination, un sistema singular no lanza excepción: se marca su bandera de fallo,
+ * su solución queda en cero y el resto del lote se resuelve con normalidad.
+ *
+ * @param lote Lote de sistemas (los coeficientes se destruyen y los términos se reemplazan por las soluciones).
+ * @param numHilos Número de hilos a utilizar; 0 usa uno por bloque del lote.
+ * @param afinidad Política para fijar cada hilo a un núcleo (ver Numa.hpp); debe coincidir con la del lote.
+ * @return int Número de sistemas que no pudieron resolverse.
+ *
+ * @throw std::runtime_error Si la solución se cancela o vence su plazo (ver ExecutionControl.hpp); el lote
+ *        queda a medio eliminar.
+ */
+int gaussEliminationLote(LoteSistemas& lote, int numHilos = 0, PoliticaAfinidad afinidad = PoliticaAfinidad::Ninguna);
+
+#endif
@@ -0,0 +1,259 @@
+/**
+ * @file Benchmark.cpp
+ * @brief Implementación de la medición de los métodos sobre los problemas de prueba.
+ *
+ * @section features_sec Características principales
+ * -Tiempo de pared con std::chrono::steady_clock, incluida la preparación del precondicionador o la factorización.
+ * -Error contra la solución exacta y residuo relativo de cada resultado.
+ * -Salida en tabla o en JSON para comparar ejecuciones.
+ * -IPC, GFLOP/s y bytes por operación de la eliminación, la sustitución y las iteraciones de cada método.
+ */
+#include "Benchmark.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include "Krylov.hpp"
+#include "IncompleteFactorization.hpp"
+#include "Multigrid.hpp"
+#include "LU.hpp"
+#include "Methods.hpp"
+#include "RecursiveLU.hpp"
+
+namespace {
+
+double normaInfinito(const Matrix& x) {
+    double norma = 0.0;
+    for (int i = 0; i < x.getRows(); i++) norma = std::max(norma, std::abs(x.at(i, 0)));
+    return norma;
+}
+
+/**
+ * @brief Calcula el error respecto a la solución exacta y el residuo relativo de `x`.
+ */
+void evaluarSolucion(const ProblemaPrueba& problema, const Matrix& x, MedicionMetodo& medicion) {
+    int n = x.getRows();
+    Matrix Ax = problema.A.multiplicar(x);
+    double error = 0.0;
+    double residuo = 0.0;
+    for (int i = 0; i < n; i++) {
+        error = std::max(error, std::abs(x.at(i, 0) - problema.solucion.at(i, 0)));
+        residuo = std::max(residuo, std::abs(problema.b.at(i, 0) - Ax.at(i, 0)));
+    }
+    double normaSolucion = normaInfinito(problema.solucion);
+    double normaB = normaInfinito(problema.b);
+    medicion.errorRelativo = normaSolucion > 0.0 ? error / normaSolucion : error;
+    medicion.residuoRelativo = normaB > 0.0 ? residuo / normaB : residuo;
+}
+
+/**
+ * @brief Escribe `texto` entre comillas, escapando los caracteres especiales de JSON.
+ */
+void escribirCadenaJSON(std::FILE* archivo, const char* texto) {
+    std::fputc('"', archivo);
+    for (const char* c = texto; *c != '\0'; c++) {
+        if (*c == '"' || *c == '\\') {
+            std::fputc('\\', archivo);
+            std::fputc(*c, archivo);
+        } else if (static_cast<unsigned char>(*c) < 0x20) {
+            std::fprintf(archivo, "\\u%04x", static_cast<unsigned>(static_cast<unsigned char>(*c)));
+        } else {
+            std::fputc(*c, archivo);
+        }
+    }
+    std::fputc('"', archivo);
+}
+
+/**
+ * @brief Escribe un número o null si no pudo calcularse.
+ */
+void escribirNumeroJSON(std::FILE* archivo, double valor) {
+    if (std::isfinite(valor)) {
+        std::fprintf(archivo, "%.6e", valor);
+    } else {
+        std::fprintf(archivo, "null");
+    }
+}
+
+/**
+ * @brief Escribe las regiones medidas de un método como objeto JSON.
+ */
+void escribirRendimientoJSON(std::FILE* archivo, const MedicionRendimiento& rendimiento) {
+    std::fprintf(archivo, "{\"contadores\": %s", rendimiento.tieneContador(ContadorHardware::Ciclos) ? "true" : "false");
+    if (rendimiento.motivo.getLength() > 0) {
+        std::fprintf(archivo, ", \"motivo\": ");
+        escribirCadenaJSON(archivo, rendimiento.motivo.c_str());
+    }
+    std::fprintf(archivo, ", \"regiones\": [");
+    bool primera = true;
+    for (int k = 0; k < CANTIDAD_REGIONES_MEDIDAS; k++) {
+        RegionMedida region = static_cast<RegionMedida>(k);
+        const ContadoresRegion& datos = rendimiento.region(region);
+        if (datos.llamadas == 0) continue;
+        std::fprintf(archivo, "%s{\"region\": ", primera ? "" : ", ");
+        primera = false;
+        escribirCadenaJSON(archivo, nombreRegionMedida(region));
+        std::fprintf(archivo, ", \"llamadas\": %d, \"segundos\": %.6f, \"operaciones\": %.6e, \"gflops\": ",
+                     datos.llamadas, datos.segundos, datos.operaciones);
+        escribirNumeroJSON(archivo, rendimiento.gflops(region));
+        std::fprintf(archivo, ", \"ipc\": ");
+        escribirNumeroJSON(archivo, rendimiento.ipc(region));
+        std::fprintf(archivo, ", \"bytesPorFlop\": ");
+        escribirNumeroJSON(archivo, rendimiento.bytesPorOperacion(region));
+        std::fputc('}', archivo);
+    }
+    std::fprintf(archivo, "]}");
+}
+
+} // namespace
+
+bool metodoAplicable(const ProblemaPrueba& problema, MetodoMedido metodo) {
+    switch (metodo) {
+    case MetodoMedido::GradienteConjugadoJacobi:
+        return problema.simetrica;
+    case MetodoMedido::GradienteConjugadoMultimalla:
+        // La agregación supone la estructura de una malla; en matrices aleatorias o densas el costo de preparación se dispara
+        return problema.tipo == TipoProblema::Poisson1D || problema.tipo == TipoProblema::Poisson2D
+            || problema.tipo == TipoProblema::Poisson3D;
+    case MetodoMedido::LUDensa:
+    case MetodoMedido::LURecursiva:
+        return problema.A.getRows() <= MAX_INCOGNITAS_LU_DENSA;
+    case MetodoMedido::BicgstabILU0:
+    case MetodoMedido::GaussSeidel:
+        return true;
+    }
+    return false;
+}
+
+MedicionMetodo medirMetodo(const ProblemaPrueba& problema, MetodoMedido metodo, const OpcionesIterativas& opciones) {
+    MedicionMetodo medicion;
+    medicion.metodo = metodo;
+    EstadisticasIterativas estadisticas;
+    OpcionesIterativas opcionesMedidas = opciones;
+    opcionesMedidas.estadisticas = &estadisticas;
+    opcionesMedidas.aproximacionInicial = nullptr;
+
+    SesionRendimiento sesion(&medicion.rendimiento);
+    auto inicio = std::chrono::steady_clock::now();
+    try {
+        Matrix x(0, 0);
+        switch (metodo) {
+        case MetodoMedido::GradienteConjugadoJacobi: {
+            PrecondicionadorJacobi precondicionador(problema.A);
+            x = gradienteConjugado(problema.A, problema.b, opcionesMedidas, &precondicionador);
+            break;
+        }
+        case MetodoMedido::GradienteConjugadoMultimalla: {
+            MultigridAlgebraico multimalla(problema.A);
+            x = gradienteConjugado(problema.A, problema.b, opcionesMedidas, &multimalla);
+            break;
+        }
+        case MetodoMedido::BicgstabILU0: {
+            FactorizacionILU0 ilu(problema.A);
+            x = bicgstab(problema.A, problema.b, opcionesMedidas, &ilu);
+            break;
+        }
+        case MetodoMedido::GaussSeidel:
+            x = gaussSeidelMethod(OperadorDisperso(problema.A), problema.b, opcionesMedidas);
+            break;
+        case MetodoMedido::LUDensa: {
+            FactorizacionLU lu(problema.A.toMatrix());
+            x = lu.resolver(problema.b);
+            estadisticas.iteraciones = 0;
+            break;
+        }
+        case MetodoMedido::LURecursiva: {
+            Matrix densa = problema.A.toMatrix();
+            Matrix terminos = problema.b;
+            x = luRecursiva(densa, terminos);
+            estadisticas.iteraciones = 0;
+            break;
+        }
+        }
+        medicion.segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+        medicion.exito = true;
+        medicion.iteraciones = estadisticas.iteraciones;
+        evaluarSolucion(problema, x, medicion);
+    } catch (const std::exception& e) {
+        medicion.segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+        medicion.iteraciones = estadisticas.iteraciones;
+        medicion.mensaje = String(e.what());
+    }
+    return medicion;
+}
+
+const char* nombreMetodoMedido(MetodoMedido metodo) {
+    switch (metodo) {
+    case MetodoMedido::GradienteConjugadoJacobi: return "CG + Jacobi";
+    case MetodoMedido::GradienteConjugadoMultimalla: return "CG + multimalla";
+    case MetodoMedido::BicgstabILU0: return "BiCGSTAB + ILU(0)";
+    case MetodoMedido::GaussSeidel: return "Gauss-Seidel";
+    case MetodoMedido::LUDensa: return "LU densa";
+    case MetodoMedido::LURecursiva: return "LU recursiva";
+    }
+    return "Desconocido";
+}
+
+void imprimirMediciones(const ProblemaPrueba& problema, const MedicionMetodo* mediciones, int cantidad) {
+    std::streamsize precisionOriginal = std::cout.precision();
+    std::cout << "Problema: " << nombreProblema(problema.tipo) << ", " << problema.A.getRows()
+              << " incógnitas, " << problema.A.getNoCeros() << " elementos no nulos.\n";
+    std::cout << std::left << std::setw(20) << "Método" << std::right << std::setw(12) << "Tiempo (s)"
+              << std::setw(12) << "Iteraciones" << std::setw(14) << "Error rel." << std::setw(14) << "Residuo rel." << "\n";
+    for (int k = 0; k < cantidad; k++) {
+        const MedicionMetodo& m = mediciones[k];
+        std::cout << std::left << std::setw(20) << nombreMetodoMedido(m.metodo) << std::right
+                  << std::setw(12) << std::fixed << std::setprecision(4) << m.segundos
+                  << std::setw(12) << m.iteraciones;
+        if (m.exito) {
+            std::cout << std::setw(14) << std::scientific << std::setprecision(3) << m.errorRelativo
+                      << std::setw(14) << m.residuoRelativo << "\n";
+        } else {
+            std::cout << "  Falló: " << m.mensaje.c_str() << "\n";
+        }
+        std::cout.unsetf(std::ios::floatfield);
+        m.rendimiento.imprimir();
+    }
+    if (cantidad > 0 && mediciones[0].rendimiento.motivo.getLength() > 0) {
+        std::cout << "Contadores de hardware no disponibles: " << mediciones[0].rendimiento.motivo.c_str()
+                  << "; solo se reportan GFLOP/s.\n";
+    }
+    std::cout.precision(precisionOriginal);
+}
+
+void guardarMedicionesJSON(const char* ruta, const ProblemaPrueba& problema, std::uint64_t semilla,
+                           const MedicionMetodo* mediciones, int cantidad) {
+    std::FILE* archivo = std::fopen(ruta, "w");
+    if (archivo == nullptr) {
+        throw std::runtime_error("No se pudo abrir el archivo de resultados.");
+    }
+    std::fprintf(archivo, "{\n  \"problema\": ");
+    escribirCadenaJSON(archivo, nombreProblema(problema.tipo));
+    std::fprintf(archivo, ",\n  \"incognitas\": %d,\n  \"noCeros\": %d,\n  \"semilla\": %llu,\n  \"mediciones\": [",
+                 problema.A.getRows(), problema.A.getNoCeros(), static_cast<unsigned long long>(semilla));
+    for (int k = 0; k < cantidad; k++) {
+        const MedicionMetodo& m = mediciones[k];
+        std::fprintf(archivo, "%s\n    {\"metodo\": ", k > 0 ? "," : "");
+        escribirCadenaJSON(archivo, nombreMetodoMedido(m.metodo));
+        std::fprintf(archivo, ", \"exito\": %s, \"segundos\": %.6f, \"iteraciones\": %d",
+                     m.exito ? "true" : "false", m.segundos, m.iteraciones);
+        if (m.exito) {
+            std::fprintf(archivo, ", \"errorRelativo\": %.6e, \"residuoRelativo\": %.6e", m.errorRelativo, m.residuoRelativo);
+        } else {
+            std::fprintf(archivo, ", \"mensaje\": ");
+            escribirCadenaJSON(archivo, m.mensaje.c_str());
+        }
+        std::fprintf(archivo, ", \"rendimiento\": ");
+        escribirRendimientoJSON(archivo, m.rendimiento);
+        std::fputc('}', archivo);
+    }
+    std::fprintf(archivo, "\n  ]\n}\n");
+    bool error = std::ferror(archivo) != 0;
+    if (std::fclose(archivo) != 0 || error) {
+        throw std::runtime_error("No se pudo escribir el archivo de resultados.");
+    }
+}
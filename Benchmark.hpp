@@ -0,0 +1,94 @@
+/**
+ * @file Benchmark.hpp
+ * @brief Declaración de la medición de los métodos de solución sobre los problemas de prueba.
+ *
+ * Resuelve un ProblemaPrueba con cada método aplicable y registra el tiempo, las iteraciones, el error
+ * contra la solución exacta y el residuo. Los resultados pueden guardarse en JSON para compararlos entre
+ * versiones y detectar regresiones de rendimiento.
+ */
+#ifndef BENCHMARK_HPP
+#define BENCHMARK_HPP
+
+#include <cstdint>
+#include "Generators.hpp"
+#include "IterativeOptions.hpp"
+#include "PerfCounters.hpp"
+#include "String.hpp"
+
+/**
+ * @brief Métodos que se miden sobre los problemas de prueba.
+ */
+enum class MetodoMedido {
+    GradienteConjugadoJacobi,     ///< Gradiente conjugado con precondicionador diagonal (solo simétricas).
+    GradienteConjugadoMultimalla, ///< Gradiente conjugado con multimalla algebraica (solo problemas de Poisson).
+    BicgstabILU0,                 ///< BiCGSTAB con ILU(0).
+    GaussSeidel,                  ///< Gauss-Seidel sobre la matriz dispersa.
+    LUDensa,                      ///< Factorización LU densa (solo sistemas de hasta MAX_INCOGNITAS_LU_DENSA incógnitas).
+    LURecursiva                   ///< Factorización LU recursiva, con el mismo límite de tamaño que LUDensa.
+};
+
+/**
+ * @brief Cantidad de valores de MetodoMedido, para recorrerlos todos.
+ */
+const int CANTIDAD_METODOS_MEDIDOS = 6;
+
+/**
+ * @brief Mayor tamaño de sistema para el que se mide la LU densa (O(n³) operaciones y n² de memoria).
+ */
+const int MAX_INCOGNITAS_LU_DENSA = 2000;
+
+/**
+ * @brief Resultado de resolver un problema de prueba con un método.
+ */
+struct MedicionMetodo {
+    MetodoMedido metodo;
+    bool exito = false;          ///< false si el método lanzó una excepción (ver `mensaje`).
+    double segundos = 0.0;       ///< Tiempo de preparación (precondicionador o factorización) y solución.
+    int iteraciones = 0;         ///< Iteraciones realizadas (0 en los métodos directos).
+    double errorRelativo = 0.0;  ///< ||x - x*||∞ / ||x*||∞ respecto a la solución exacta.
+    double residuoRelativo = 0.0; ///< ||b - A·x||∞ / ||b||∞.
+    String mensaje;              ///< Descripción del error cuando el método falla.
+    MedicionRendimiento rendimiento; ///< Contadores de hardware y métricas de las regiones del método.
+};
+
+/**
+ * @brief Indica si tiene sentido medir `metodo` sobre `problema` (simetría y tamaño).
+ */
+bool metodoAplicable(const ProblemaPrueba& problema, MetodoMedido metodo);
+
+/**
+ * @brief Resuelve el problema con el método indicado y mide el resultado.
+ *
+ * Las excepciones del método no se propagan: quedan registradas en la medición.
+ *
+ * @param problema Problema de prueba.
+ * @param metodo Método a medir.
+ * @param opciones Tolerancia, criterio e iteraciones máximas de los métodos iterativos.
+ */
+MedicionMetodo medirMetodo(const ProblemaPrueba& problema, MetodoMedido metodo, const OpcionesIterativas& opciones);
+
+/**
+ * @brief Nombre legible del método medido.
+ */
+const char* nombreMetodoMedido(MetodoMedido metodo);
+
+/**
+ * @brief Imprime en consola una tabla con las mediciones.
+ */
+void imprimirMediciones(const ProblemaPrueba& problema, const MedicionMetodo* mediciones, int cantidad);
+
+/**
+ * @brief Guarda las mediciones en un archivo JSON.
+ *
+ * @param ruta Archivo de salida (se sobrescribe).
+ * @param problema Problema medido.
+ * @param semilla Semilla con la que se generó el problema.
+ * @param mediciones Mediciones a guardar.
+ * @param cantidad Número de mediciones.
+ *
+ * @throws std::runtime_error Si el archivo no puede escribirse.
+ */
+void guardarMedicionesJSON(const char* ruta, const ProblemaPrueba& problema, std::uint64_t semilla,
+                           const MedicionMetodo* mediciones, int cantidad);
+
+#endif
@@ -0,0 +1,663 @@
+/**
+ * @file BlockJacobi.cpp
+ * @brief Implementación de los métodos de Jacobi y Gauss-Seidel por bloques.
+ *
+ * @section features_sec Características principales
+ * -Particiones uniformes, definidas por el usuario o automáticas por agregación de conexiones fuertes.
+ * -Cada bloque diagonal se factoriza una sola vez con la LU recursiva; cada barrido solo hace sustituciones.
+ * -Los hilos se crean una vez por resolución, factorizan sus bloques y se sincronizan con una barrera en cada barrido.
+ * -Cada hilo factoriza exactamente los bloques que actualiza, guardados en el orden del recorrido, para que sus
+ *  factores queden en la memoria de su nodo NUMA (primer toque).
+ * -Gauss-Seidel por bloques con ordenamiento multicolor: los bloques de un color se resuelven en paralelo y el
+ *  resultado no depende del número de hilos.
+ */
+#include "BlockJacobi.hpp"
+#include <algorithm>
+#include <cmath>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include "ExecutionControl.hpp"
+#include "RecursiveLU.hpp"
+#include "String.hpp"
+#include "utils.hpp"
+
+namespace {
+
+/**
+ * @brief Barrera reutilizable: cada llamada a esperar bloquea hasta que llegan todos los participantes.
+ */
+class BarreraHilos {
+    private:
+        std::mutex mutex;
+        std::condition_variable condicion;
+        int participantes;
+        int pendientes;
+        unsigned long generacion;
+    public:
+        explicit BarreraHilos(int participantes)
+            : participantes(participantes), pendientes(participantes), generacion(0) {}
+
+        void esperar() {
+            std::unique_lock<std::mutex> bloqueo(mutex);
+            unsigned long actual = generacion;
+            if (--pendientes == 0) {
+                generacion++;
+                pendientes = participantes;
+                condicion.notify_all();
+                return;
+            }
+            condicion.wait(bloqueo, [&]() { return generacion != actual; });
+        }
+};
+
+/**
+ * @brief Medidas de un hilo en el barrido actual; alineadas para que los hilos no compartan línea de caché.
+ */
+struct alignas(64) MedidaHilo {
+    double cambio = 0.0;
+    double residuo = 0.0;
+    std::exception_ptr error;
+};
+
+/**
+ * @brief Bloques diagonales factorizados y orden en que se recorren.
+ */
+struct BloquesFactorizados {
+    const SparseMatrix& A;
+    const ParticionBloques& particion;
+    int numBloques;
+    int tamanoMaximo;
+    std::unique_ptr<int[]> bloqueDe;          // Copia de la asignación, para no verificar límites en los barridos. //
+    std::unique_ptr<int[]> posicion;          // Posición de cada incógnita dentro de su bloque. //
+    std::unique_ptr<int[]> orden;             // Bloques agrupados por color. //
+    int numColores;
+    std::unique_ptr<int[]> inicioColor;       // Los bloques del color c son orden[inicioColor[c] .. inicioColor[c+1]). //
+    std::unique_ptr<long long[]> inicioDenso; // Inicio de los k² elementos del bloque k en `factores` y `copias`. //
+    std::unique_ptr<int[]> inicioPivotes;
+    long long totalDenso;
+    std::unique_ptr<double[]> factores; // L y U de cada bloque, por filas. //
+    std::unique_ptr<double[]> copias;   // A_II original, para el residuo (nulo si no se mide). //
+    std::unique_ptr<int[]> pivotes;
+
+    /**
+     * @brief Agrupa los bloques y reserva su almacenamiento sin inicializarlo.
+     *
+     * Los bloques se guardan en `factores` y `copias` en el orden en que se recorren (por color) y no se ponen en
+     * cero: la primera escritura la hace factorizar, que cada hilo llama sobre los mismos bloques que actualiza en
+     * los barridos, de modo que por la política de primer toque quedan en la memoria del nodo de ese hilo.
+     */
+    BloquesFactorizados(const SparseMatrix& A, const ParticionBloques& particion, bool colorear, bool guardarCopias)
+        : A(A), particion(particion), numBloques(particion.getNumBloques()), tamanoMaximo(0),
+          bloqueDe(std::make_unique<int[]>(particion.getSize())), posicion(std::make_unique<int[]>(particion.getSize())),
+          orden(std::make_unique<int[]>(numBloques)), numColores(0), inicioDenso(std::make_unique<long long[]>(numBloques)),
+          inicioPivotes(std::make_unique<int[]>(numBloques)), totalDenso(0) {
+        for (int k = 0; k < numBloques; k++) {
+            int tam = particion.getTamanoBloque(k);
+            const int* indices = particion.getIndices(k);
+            for (int r = 0; r < tam; r++) {
+                posicion[indices[r]] = r;
+                bloqueDe[indices[r]] = k;
+            }
+            tamanoMaximo = std::max(tamanoMaximo, tam);
+        }
+        ordenar(colorear);
+        int totalPivotes = 0;
+        for (int q = 0; q < numBloques; q++) {
+            int k = orden[q];
+            int tam = particion.getTamanoBloque(k);
+            inicioDenso[k] = totalDenso;
+            inicioPivotes[k] = totalPivotes;
+            totalDenso += static_cast<long long>(tam) * tam;
+            totalPivotes += tam;
+        }
+        factores.reset(new double[totalDenso]);
+        if (guardarCopias) copias.reset(new double[totalDenso]);
+        pivotes.reset(new int[totalPivotes]);
+    }
+
+    /**
+     * @brief Extrae A_II y la factoriza en el lugar con pivoteo parcial.
+     *
+     * @throw std::runtime_error Si el bloque es singular.
+     */
+    void factorizar(int k) {
+        int tam = particion.getTamanoBloque(k);
+        const int* indices = particion.getIndices(k);
+        const int* inicio = A.getInicioFila();
+        const int* columnas = A.getColumnas();
+        const double* valores = A.getValores();
+        Matrix bloque(tam, tam);
+        for (int r = 0; r < tam; r++) {
+            int i = indices[r];
+            for (int p = inicio[i]; p < inicio[i + 1]; p++) {
+                int j = columnas[p];
+                if (bloqueDe[j] == k) bloque.at(r, posicion[j]) += valores[p];
+            }
+        }
+        double* destinoCopia = copias == nullptr ? nullptr : copias.get() + inicioDenso[k];
+        if (destinoCopia != nullptr) {
+            for (int r = 0; r < tam; r++) {
+                for (int c = 0; c < tam; c++) destinoCopia[static_cast<long long>(r) * tam + c] = bloque.at(r, c);
+            }
+        }
+        try {
+            factorizarLURecursiva(bloque, pivotes.get() + inicioPivotes[k]);
+        } catch (const std::runtime_error&) {
+            String numero; numero.fromInt(k);
+            String msg = String("El bloque diagonal ") + numero + String(" es singular.");
+            throw std::runtime_error(msg.c_str());
+        }
+        double* destino = factores.get() + inicioDenso[k];
+        for (int r = 0; r < tam; r++) {
+            for (int c = 0; c < tam; c++) destino[static_cast<long long>(r) * tam + c] = bloque.at(r, c);
+        }
+    }
+
+    /**
+     * @brief Agrupa los bloques: uno solo para Jacobi, o por colores del grafo de bloques para Gauss-Seidel.
+     *
+     * Dos bloques reciben colores distintos si A_IJ o A_JI tiene algún elemento; el coloreado es voraz en el
+     * orden natural de los bloques.
+     */
+    void ordenar(bool colorear) {
+        if (!colorear) {
+            for (int k = 0; k < numBloques; k++) orden[k] = k;
+            numColores = 1;
+            inicioColor = std::make_unique<int[]>(2);
+            inicioColor[1] = numBloques;
+            return;
+        }
+        const int* inicio = A.getInicioFila();
+        const int* columnas = A.getColumnas();
+        // Grafo de bloques en listas comprimidas: la primera pasada cuenta los vecinos de cada bloque y la segunda
+        // los escribe. Los vecinos de k son vecinos[inicioVecinos[k] .. inicioVecinos[k+1])
+        std::unique_ptr<int[]> inicioVecinos = std::make_unique<int[]>(numBloques + 1);
+        std::unique_ptr<int[]> libre = std::make_unique<int[]>(numBloques);
+        std::unique_ptr<int[]> vecinos;
+        std::unique_ptr<int[]> marca = std::make_unique<int[]>(numBloques);
+        for (int pasada = 0; pasada < 2; pasada++) {
+            std::fill(marca.get(), marca.get() + numBloques, -1);
+            for (int k = 0; k < numBloques; k++) {
+                const int* indices = particion.getIndices(k);
+                for (int r = 0; r < particion.getTamanoBloque(k); r++) {
+                    int i = indices[r];
+                    for (int p = inicio[i]; p < inicio[i + 1]; p++) {
+                        int vecino = bloqueDe[columnas[p]];
+                        if (vecino == k || marca[vecino] == k) continue;
+                        marca[vecino] = k;
+                        if (pasada == 0) {
+                            inicioVecinos[k + 1]++;
+                            inicioVecinos[vecino + 1]++;
+                        } else {
+                            vecinos[libre[k]++] = vecino;
+                            vecinos[libre[vecino]++] = k;
+                        }
+                    }
+                }
+            }
+            if (pasada == 0) {
+                for (int k = 0; k < numBloques; k++) inicioVecinos[k + 1] += inicioVecinos[k];
+                std::copy(inicioVecinos.get(), inicioVecinos.get() + numBloques, libre.get());
+                vecinos = std::make_unique<int[]>(inicioVecinos[numBloques]);
+            }
+        }
+        std::unique_ptr<int[]> color = std::make_unique<int[]>(numBloques);
+        std::unique_ptr<int[]> usado = std::make_unique<int[]>(numBloques + 1);
+        std::fill(color.get(), color.get() + numBloques, -1);
+        std::fill(usado.get(), usado.get() + numBloques + 1, -1);
+        numColores = 0;
+        for (int k = 0; k < numBloques; k++) {
+            for (int q = inicioVecinos[k]; q < inicioVecinos[k + 1]; q++) {
+                if (color[vecinos[q]] >= 0) usado[color[vecinos[q]]] = k;
+            }
+            int c = 0;
+            while (usado[c] == k) c++;
+            color[k] = c;
+            numColores = std::max(numColores, c + 1);
+        }
+        inicioColor = std::make_unique<int[]>(numColores + 1);
+        for (int k = 0; k < numBloques; k++) inicioColor[color[k] + 1]++;
+        for (int c = 0; c < numColores; c++) inicioColor[c + 1] += inicioColor[c];
+        std::copy(inicioColor.get(), inicioColor.get() + numColores, libre.get());
+        for (int k = 0; k < numBloques; k++) orden[libre[color[k]]++] = k;
+    }
+
+    /**
+     * @brief Actualiza el bloque k: destino_I = A_II⁻¹·(b_I - Σ_{J≠I} A_IJ·origen_J).
+     *
+     * @param origen Valores de los que se leen los demás bloques y el valor anterior del bloque k.
+     * @param destino Recibe el bloque k (puede ser el mismo arreglo que origen).
+     * @param trabajo Arreglo de al menos 2·tamanoMaximo elementos.
+     */
+    void actualizar(int k, const double* b, const double* origen, double* destino, double* trabajo,
+                    MedidaHilo& medida) const {
+        int tam = particion.getTamanoBloque(k);
+        const int* indices = particion.getIndices(k);
+        const int* inicio = A.getInicioFila();
+        const int* columnas = A.getColumnas();
+        const double* valores = A.getValores();
+        double* terminos = trabajo;
+        double* z = trabajo + tamanoMaximo;
+        for (int r = 0; r < tam; r++) {
+            int i = indices[r];
+            double suma = b[i];
+            for (int p = inicio[i]; p < inicio[i + 1]; p++) {
+                int j = columnas[p];
+                if (bloqueDe[j] != k) suma -= valores[p] * origen[j];
+            }
+            terminos[r] = suma;
+        }
+        // L·U·z = P·terminos
+        const double* LU = factores.get() + inicioDenso[k];
+        const int* piv = pivotes.get() + inicioPivotes[k];
+        for (int r = 0; r < tam; r++) {
+            const double* fila = LU + static_cast<long long>(r) * tam;
+            double suma = terminos[piv[r]];
+            for (int c = 0; c < r; c++) suma -= fila[c] * z[c];
+            z[r] = suma;
+        }
+        for (int r = tam - 1; r >= 0; r--) {
+            const double* fila = LU + static_cast<long long>(r) * tam;
+            double suma = z[r];
+            for (int c = r + 1; c < tam; c++) suma -= fila[c] * z[c];
+            z[r] = suma / fila[r];
+        }
+        // terminos pasa a guardar el cambio del bloque
+        for (int r = 0; r < tam; r++) {
+            terminos[r] = z[r] - origen[indices[r]];
+            medida.cambio = std::max(medida.cambio, std::abs(terminos[r]));
+        }
+        if (copias != nullptr) {
+            // En Jacobi, b_I - A_II·x_I anterior - Σ A_IJ·x_J = A_II·(z - x_I anterior) es el residuo exacto de origen
+            const double* original = copias.get() + inicioDenso[k];
+            for (int r = 0; r < tam; r++) {
+                const double* fila = original + static_cast<long long>(r) * tam;
+                double suma = 0.0;
+                for (int c = 0; c < tam; c++) suma += fila[c] * terminos[c];
+                medida.residuo = std::max(medida.residuo, std::abs(suma));
+            }
+        }
+        for (int r = 0; r < tam; r++) destino[indices[r]] = z[r];
+    }
+
+    /**
+     * @brief Posiciones [desde, hasta) de `orden` que le tocan al hilo h dentro del color c.
+     */
+    void rangoColor(int c, int h, int hilos, int& desde, int& hasta) const {
+        int total = inicioColor[c + 1] - inicioColor[c];
+        desde = inicioColor[c] + static_cast<int>(static_cast<long long>(total) * h / hilos);
+        hasta = inicioColor[c] + static_cast<int>(static_cast<long long>(total) * (h + 1) / hilos);
+    }
+
+    /**
+     * @brief Actualiza la parte que le toca al hilo h de los bloques del color c.
+     */
+    void actualizarColor(int c, int h, int hilos, const double* b, const double* origen, double* destino,
+                         double* trabajo, MedidaHilo& medida) const {
+        int desde = 0;
+        int hasta = 0;
+        rangoColor(c, h, hilos, desde, hasta);
+        for (int q = desde; q < hasta; q++) actualizar(orden[q], b, origen, destino, trabajo, medida);
+    }
+
+    /**
+     * @brief Residuo ||b - A·x||∞ de las filas de los bloques que le tocan al hilo h dentro del color c.
+     */
+    void residuoColor(int c, int h, int hilos, const double* b, const double* x, MedidaHilo& medida) const {
+        const int* inicio = A.getInicioFila();
+        const int* columnas = A.getColumnas();
+        const double* valores = A.getValores();
+        int desde = 0;
+        int hasta = 0;
+        rangoColor(c, h, hilos, desde, hasta);
+        for (int q = desde; q < hasta; q++) {
+            int k = orden[q];
+            const int* indices = particion.getIndices(k);
+            for (int r = 0; r < particion.getTamanoBloque(k); r++) {
+                int i = indices[r];
+                double suma = b[i];
+                for (int p = inicio[i]; p < inicio[i + 1]; p++) suma -= valores[p] * x[columnas[p]];
+                medida.residuo = std::max(medida.residuo, std::abs(suma));
+            }
+        }
+    }
+
+    /**
+     * @brief Operaciones de punto flotante de las factorizaciones (2k³/3 por bloque de k incógnitas).
+     */
+    double operacionesFactorizacion() const {
+        double total = 0.0;
+        for (int k = 0; k < numBloques; k++) {
+            double tam = particion.getTamanoBloque(k);
+            total += 2.0 * tam * tam * tam / 3.0;
+        }
+        return total;
+    }
+
+    /**
+     * @brief Operaciones de punto flotante de un barrido: el producto por A, las sustituciones de cada bloque y,
+     *        si se pide, el residuo completo b - A·x.
+     */
+    double operacionesBarrido(bool residuoCompleto) const {
+        double densas = static_cast<double>(totalDenso);
+        return 2.0 * A.getNoCeros() * (residuoCompleto ? 2 : 1) + 2.0 * densas * (copias == nullptr ? 1 : 2);
+    }
+};
+
+/**
+ * @brief Hilos de una resolución: esperan en la barrera de inicio y se terminan y reúnen al destruirse.
+ */
+struct EquipoHilos {
+    BarreraHilos barrera;
+    int numHilos;
+    std::unique_ptr<std::thread[]> hilos;
+    bool terminar = false;
+
+    explicit EquipoHilos(int numHilos)
+        : barrera(numHilos + 1), numHilos(numHilos), hilos(std::make_unique<std::thread[]>(numHilos)) {}
+
+    ~EquipoHilos() {
+        terminar = true;
+        barrera.esperar();
+        for (int h = 0; h < numHilos; h++) {
+            if (hilos[h].joinable()) hilos[h].join();
+        }
+    }
+};
+
+} // namespace
+
+ParticionBloques::ParticionBloques() : n(0), numBloques(0) {}
+
+ParticionBloques ParticionBloques::uniforme(int n, int tamano) {
+    if (n <= 0 || tamano <= 0) {
+        throw std::invalid_argument("El número de incógnitas y el tamaño de bloque deben ser positivos.");
+    }
+    std::unique_ptr<int[]> asignacion = std::make_unique<int[]>(n);
+    for (int i = 0; i < n; i++) asignacion[i] = i / tamano;
+    return desdeAsignacion(n, asignacion.get());
+}
+
+ParticionBloques ParticionBloques::desdeAsignacion(int n, const int* bloqueDe) {
+    if (n <= 0) {
+        throw std::invalid_argument("El número de incógnitas debe ser positivo.");
+    }
+    int mayor = 0;
+    for (int i = 0; i < n; i++) {
+        if (bloqueDe[i] < 0) {
+            String pos; pos.fromInt(i);
+            String msg = String("Número de bloque negativo para la incógnita ") + pos + String(".");
+            throw std::invalid_argument(msg.c_str());
+        }
+        mayor = std::max(mayor, bloqueDe[i]);
+    }
+    // Se renumeran los bloques no vacíos en orden
+    std::unique_ptr<int[]> numero = std::make_unique<int[]>(mayor + 1);
+    std::fill(numero.get(), numero.get() + mayor + 1, -1);
+    for (int i = 0; i < n; i++) numero[bloqueDe[i]] = 0;
+    ParticionBloques particion;
+    particion.n = n;
+    for (int k = 0; k <= mayor; k++) {
+        if (numero[k] == 0) numero[k] = particion.numBloques++;
+    }
+    particion.inicio = std::make_unique<int[]>(particion.numBloques + 1);
+    particion.indices = std::make_unique<int[]>(n);
+    particion.bloqueDe = std::make_unique<int[]>(n);
+    for (int i = 0; i < n; i++) {
+        particion.bloqueDe[i] = numero[bloqueDe[i]];
+        particion.inicio[particion.bloqueDe[i] + 1]++;
+    }
+    for (int k = 0; k < particion.numBloques; k++) particion.inicio[k + 1] += particion.inicio[k];
+    std::unique_ptr<int[]> siguiente = std::make_unique<int[]>(particion.numBloques);
+    std::copy(particion.inicio.get(), particion.inicio.get() + particion.numBloques, siguiente.get());
+    for (int i = 0; i < n; i++) particion.indices[siguiente[particion.bloqueDe[i]]++] = i;
+    return particion;
+}
+
+ParticionBloques ParticionBloques::automatica(const SparseMatrix& A, int tamanoMaximo, double umbralFuerza) {
+    int n = A.getRows();
+    if (A.getCols() != n || n <= 0) {
+        throw std::invalid_argument("La partición automática requiere una matriz cuadrada.");
+    }
+    if (tamanoMaximo <= 0) {
+        throw std::invalid_argument("El tamaño máximo de bloque debe ser positivo.");
+    }
+    const int* inicio = A.getInicioFila();
+    const int* columnas = A.getColumnas();
+    const double* valores = A.getValores();
+    std::unique_ptr<double[]> diagonal = std::make_unique<double[]>(n);
+    A.diagonal(diagonal.get());
+
+    std::unique_ptr<int[]> bloque = std::make_unique<int[]>(n);
+    std::fill(bloque.get(), bloque.get() + n, -1);
+    std::unique_ptr<int[]> cola = std::make_unique<int[]>(std::min(n, tamanoMaximo));
+    int numBloques = 0;
+    for (int semilla = 0; semilla < n; semilla++) {
+        if (bloque[semilla] >= 0) continue;
+        int largo = 0;
+        cola[largo++] = semilla;
+        bloque[semilla] = numBloques;
+        for (int frente = 0; frente < largo && largo < tamanoMaximo; frente++) {
+            int i = cola[frente];
+            for (int p = inicio[i]; p < inicio[i + 1] && largo < tamanoMaximo; p++) {
+                int j = columnas[p];
+                if (j == i || bloque[j] >= 0) continue;
+                if (std::abs(valores[p]) < umbralFuerza * std::sqrt(std::abs(diagonal[i] * diagonal[j]))) continue;
+                bloque[j] = numBloques;
+                cola[largo++] = j;
+            }
+        }
+        numBloques++;
+    }
+    return desdeAsignacion(n, bloque.get());
+}
+
+ParticionBloques::ParticionBloques(const ParticionBloques& other) : n(other.n), numBloques(other.numBloques) {
+    if (n == 0) return;
+    inicio = std::make_unique<int[]>(numBloques + 1);
+    indices = std::make_unique<int[]>(n);
+    bloqueDe = std::make_unique<int[]>(n);
+    std::copy(other.inicio.get(), other.inicio.get() + numBloques + 1, inicio.get());
+    std::copy(other.indices.get(), other.indices.get() + n, indices.get());
+    std::copy(other.bloqueDe.get(), other.bloqueDe.get() + n, bloqueDe.get());
+}
+
+ParticionBloques& ParticionBloques::operator=(const ParticionBloques& other) {
+    if (this != &other) {
+        ParticionBloques copia(other);
+        *this = std::move(copia);
+    }
+    return *this;
+}
+
+int ParticionBloques::getSize() const {
+    return n;
+}
+
+int ParticionBloques::getNumBloques() const {
+    return numBloques;
+}
+
+int ParticionBloques::getTamanoBloque(int k) const {
+    if (k < 0 || k >= numBloques) {
+        throw std::out_of_range("Índice de bloque fuera de rango");
+    }
+    return inicio[k + 1] - inicio[k];
+}
+
+const int* ParticionBloques::getIndices(int k) const {
+    if (k < 0 || k >= numBloques) {
+        throw std::out_of_range("Índice de bloque fuera de rango");
+    }
+    return indices.get() + inicio[k];
+}
+
+int ParticionBloques::getBloque(int i) const {
+    if (i < 0 || i >= n) {
+        throw std::out_of_range("Índice de incógnita fuera de rango");
+    }
+    return bloqueDe[i];
+}
+
+Matrix metodoIterativoBloques(const SparseMatrix& A, const Matrix& b, const ParticionBloques& particion,
+                              const OpcionesIterativas& opciones, bool usarValoresActuales, int hilos,
+                              PoliticaAfinidad afinidad) {
+    int n = A.getRows();
+    if (A.getCols() != n || b.getRows() != n || b.getCols() != 1) {
+        throw std::invalid_argument("Las dimensiones de A y b no son compatibles.");
+    }
+    if (particion.getSize() != n) {
+        throw std::invalid_argument("La partición de bloques no coincide con el tamaño del sistema.");
+    }
+    if (opciones.aceleracion != Aceleracion::Ninguna) {
+        throw std::invalid_argument("Los métodos por bloques no admiten aceleración.");
+    }
+    const Matrix* inicial = opciones.aproximacionInicial;
+    if (inicial != nullptr && (inicial->getRows() != n || inicial->getCols() != 1)) {
+        throw std::invalid_argument("La aproximación inicial no coincide con el tamaño del sistema.");
+    }
+
+    std::unique_ptr<double[]> terminos = std::make_unique<double[]>(n);
+    double normaB = 0.0;
+    for (int i = 0; i < n; i++) {
+        terminos[i] = b.at(i, 0);
+        normaB = std::max(normaB, std::abs(terminos[i]));
+    }
+    std::unique_ptr<double[]> actual = std::make_unique<double[]>(n);
+    if (inicial != nullptr) {
+        for (int i = 0; i < n; i++) actual[i] = inicial->at(i, 0);
+    }
+    // Jacobi escribe en un segundo arreglo; Gauss-Seidel actualiza en el lugar
+    std::unique_ptr<double[]> siguiente;
+    if (!usarValoresActuales) siguiente = std::make_unique<double[]>(n);
+    double* origen = actual.get();
+    double* destino = usarValoresActuales ? actual.get() : siguiente.get();
+
+    ControlParada control(opciones, normaB);
+    SesionRendimiento sesion(destinoRendimiento(opciones));
+    // Con un criterio de residuo, Jacobi lo obtiene de los bloques diagonales para su punto de partida y devuelve
+    // ese punto; Gauss-Seidel mezcla valores de dos barridos, así que mide b - A·x del resultado tras cada barrido
+    bool medirResiduo = opciones.criterio != CriterioParada::Actualizacion;
+    bool residuoCompleto = medirResiduo && usarValoresActuales;
+    bool devolverMedido = medirResiduo && !usarValoresActuales;
+    BloquesFactorizados bloques(A, particion, usarValoresActuales, devolverMedido);
+    int numColores = bloques.numColores;
+    const double operaciones = bloques.operacionesBarrido(residuoCompleto);
+
+    if (hilos <= 0) {
+        hilos = static_cast<int>(std::thread::hardware_concurrency());
+        if (hilos <= 0) hilos = 1;
+    }
+    hilos = std::min(hilos, bloques.numBloques);
+    std::unique_ptr<MedidaHilo[]> medidas = std::make_unique<MedidaHilo[]>(hilos);
+
+    auto terminarBarrido = [&]() {
+        ResultadoBarrido resultado{0.0, 0.0};
+        for (int h = 0; h < hilos; h++) {
+            resultado.cambio = std::max(resultado.cambio, medidas[h].cambio);
+            resultado.residuo = std::max(resultado.residuo, medidas[h].residuo);
+        }
+        if (!usarValoresActuales) std::swap(origen, destino);
+        return control.evaluar(resultado);
+    };
+    auto solucion = [&]() {
+        // Tras el intercambio de Jacobi, destino conserva el punto de partida del último barrido
+        const double* devuelto = devolverMedido ? destino : origen;
+        Matrix x(n, 1);
+        for (int i = 0; i < n; i++) x.at(i, 0) = devuelto[i];
+        return x;
+    };
+
+    if (hilos <= 1 && afinidad == PoliticaAfinidad::Ninguna) {
+        std::unique_ptr<double[]> trabajo = std::make_unique<double[]>(2 * bloques.tamanoMaximo);
+        {
+            RegionRendimiento region(RegionMedida::Eliminacion, bloques.operacionesFactorizacion());
+            for (int k = 0; k < bloques.numBloques; k++) {
+                verificarInterrupcion(RegionMedida::Eliminacion, k, bloques.numBloques);
+                bloques.factorizar(k);
+            }
+        }
+        for (int iter = 0; iter < opciones.maxIter; iter++) {
+            RegionRendimiento region(RegionMedida::Iteracion, operaciones);
+            medidas[0] = MedidaHilo();
+            for (int c = 0; c < numColores; c++) {
+                bloques.actualizarColor(c, 0, 1, terminos.get(), origen, destino, trabajo.get(), medidas[0]);
+            }
+            if (residuoCompleto) {
+                for (int c = 0; c < numColores; c++) bloques.residuoColor(c, 0, 1, terminos.get(), destino, medidas[0]);
+            }
+            if (terminarBarrido()) return solucion();
+        }
+        control.noConvergio();
+    }
+
+    // El hilo que llama solo coordina, para no alterar su afinidad; los trabajadores solo consultan el control
+    ControlEjecucion* ejecucion = SesionControl::activo();
+    EquipoHilos equipo(hilos);
+    for (int h = 0; h < hilos; h++) {
+        equipo.hilos[h] = std::thread([&, h]() {
+            fijarHilo(afinidad, h);
+            std::unique_ptr<double[]> trabajo = std::make_unique<double[]>(2 * bloques.tamanoMaximo);
+            try {
+                // Cada hilo factoriza los bloques que actualizará en los barridos (primer toque en su nodo)
+                for (int c = 0; c < numColores; c++) {
+                    int desde = 0;
+                    int hasta = 0;
+                    bloques.rangoColor(c, h, hilos, desde, hasta);
+                    for (int q = desde; q < hasta; q++) {
+                        EstadoEjecucion estado = ejecucion != nullptr ? ejecucion->comprobar() : EstadoEjecucion::Activa;
+                        if (estado != EstadoEjecucion::Activa) throw std::runtime_error(mensajeInterrupcion(estado));
+                        bloques.factorizar(bloques.orden[q]);
+                    }
+                }
+            } catch (...) {
+                medidas[h].error = std::current_exception();
+            }
+            equipo.barrera.esperar();
+            while (true) {
+                equipo.barrera.esperar();
+                if (equipo.terminar) break;
+                medidas[h].cambio = 0.0;
+                medidas[h].residuo = 0.0;
+                for (int c = 0; c < numColores; c++) {
+                    bloques.actualizarColor(c, h, hilos, terminos.get(), origen, destino, trabajo.get(), medidas[h]);
+                    equipo.barrera.esperar();
+                }
+                if (residuoCompleto) {
+                    for (int c = 0; c < numColores; c++) {
+                        bloques.residuoColor(c, h, hilos, terminos.get(), destino, medidas[h]);
+                    }
+                    equipo.barrera.esperar();
+                }
+            }
+        });
+    }
+    {
+        RegionRendimiento region(RegionMedida::Eliminacion, bloques.operacionesFactorizacion());
+        equipo.barrera.esperar();
+    }
+    for (int h = 0; h < hilos; h++) {
+        if (medidas[h].error) std::rethrow_exception(medidas[h].error);
+    }
+    for (int iter = 0; iter < opciones.maxIter; iter++) {
+        RegionRendimiento region(RegionMedida::Iteracion, operaciones);
+        equipo.barrera.esperar();
+        for (int c = 0; c < numColores; c++) equipo.barrera.esperar();
+        if (residuoCompleto) equipo.barrera.esperar();
+        if (terminarBarrido()) return solucion();
+    }
+    control.noConvergio();
+}
+
+Matrix jacobiPorBloques(const SparseMatrix& A, const Matrix& b, const ParticionBloques& particion,
+                        const OpcionesIterativas& opciones, int hilos) {
+    return metodoIterativoBloques(A, b, particion, opciones, false, hilos);
+}
+
+Matrix gaussSeidelPorBloques(const SparseMatrix& A, const Matrix& b, const ParticionBloques& particion,
+                             const OpcionesIterativas& opciones, int hilos) {
+    return metodoIterativoBloques(A, b, particion, opciones, true, hilos);
+}
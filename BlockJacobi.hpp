@@ -0,0 +1,146 @@
+/**
+ * @file BlockJacobi.hpp
+ * @brief Declaración de los métodos de Jacobi y Gauss-Seidel por bloques.
+ *
+ * En problemas con varias incógnitas por nodo (por ejemplo, velocidad y presión, o varias especies
+ * químicas) el acoplamiento más fuerte está entre las incógnitas de un mismo nodo. Jacobi y Gauss-Seidel
+ * puntuales solo invierten la diagonal y tratan ese acoplamiento como si fuera externo, por lo que
+ * convergen lentamente o no convergen. Los métodos por bloques resuelven de forma exacta cada bloque
+ * diagonal A_II (factorizado una sola vez) e iteran solo sobre el acoplamiento entre bloques:
+ * @code
+ *   x_I ← A_II⁻¹·(b_I - Σ_{J≠I} A_IJ·x_J)
+ * @endcode
+ * Los bloques de una misma iteración (o de un mismo color en Gauss-Seidel) se resuelven en paralelo.
+ */
+#ifndef BLOCK_JACOBI_HPP
+#define BLOCK_JACOBI_HPP
+
+#include <memory>
+#include "Matrix.hpp"
+#include "SparseMatrix.hpp"
+#include "IterativeOptions.hpp"
+#include "Numa.hpp"
+
+/**
+ * @class ParticionBloques
+ * @brief Reparto de las n incógnitas de un sistema en bloques disjuntos.
+ *
+ * Las incógnitas de un bloque no tienen que ser contiguas; dentro de cada bloque se guardan en orden creciente.
+ */
+class ParticionBloques {
+    private:
+        int n;
+        int numBloques;
+        std::unique_ptr<int[]> inicio;   // Las incógnitas del bloque k son indices[inicio[k] .. inicio[k+1]). //
+        std::unique_ptr<int[]> indices;
+        std::unique_ptr<int[]> bloqueDe; // Bloque al que pertenece cada incógnita. //
+
+        ParticionBloques();
+    public:
+        /**
+        * @brief Bloques contiguos de `tamano` incógnitas (el último puede ser menor).
+        *
+        * Es la partición natural cuando las incógnitas de cada nodo están numeradas juntas.
+        *
+        * @throws std::invalid_argument Si n o el tamaño no son positivos.
+        */
+        static ParticionBloques uniforme(int n, int tamano);
+
+        /**
+        * @brief Partición definida por el usuario: la incógnita i pertenece al bloque `bloqueDe[i]`.
+        *
+        * Los números de bloque sin incógnitas se descartan y los demás se renumeran en orden.
+        *
+        * @throws std::invalid_argument Si n no es positivo o algún número de bloque es negativo.
+        */
+        static ParticionBloques desdeAsignacion(int n, const int* bloqueDe);
+
+        /**
+        * @brief Agrupa las incógnitas fuertemente acopladas en bloques de a lo más `tamanoMaximo`.
+        *
+        * a_ij es fuerte si |a_ij| ≥ umbralFuerza·sqrt(|a_ii·a_jj|), el mismo criterio que la agregación del
+        * multigrida. Cada bloque crece por búsqueda en anchura sobre las conexiones fuertes a partir de la
+        * primera incógnita libre.
+        *
+        * @throws std::invalid_argument Si A no es cuadrada o el tamaño máximo no es positivo.
+        */
+        static ParticionBloques automatica(const SparseMatrix& A, int tamanoMaximo, double umbralFuerza = 0.25);
+
+        ParticionBloques(const ParticionBloques& other);
+        ParticionBloques& operator=(const ParticionBloques& other);
+        ParticionBloques(ParticionBloques&& other) noexcept = default;
+        ParticionBloques& operator=(ParticionBloques&& other) noexcept = default;
+
+        /**
+        * @brief Número de incógnitas.
+        */
+        int getSize() const;
+
+        int getNumBloques() const;
+
+        /**
+        * @brief Número de incógnitas del bloque k.
+        *
+        * @throws std::out_of_range Si k está fuera de rango.
+        */
+        int getTamanoBloque(int k) const;
+
+        /**
+        * @brief Incógnitas del bloque k, en orden creciente (getTamanoBloque(k) elementos).
+        *
+        * @throws std::out_of_range Si k está fuera de rango.
+        */
+        const int* getIndices(int k) const;
+
+        /**
+        * @brief Bloque al que pertenece la incógnita i.
+        *
+        * @throws std::out_of_range Si i está fuera de rango.
+        */
+        int getBloque(int i) const;
+};
+
+/**
+ * @brief Jacobi o Gauss-Seidel por bloques sobre una matriz dispersa.
+ *
+ * Cada bloque diagonal se factoriza una vez con factorizarLURecursiva (pivoteo parcial). Jacobi resuelve todos
+ * los bloques con los valores de la iteración anterior. Gauss-Seidel colorea el grafo de bloques de modo que
+ * dos bloques acoplados tengan colores distintos y recorre los colores en orden, usando los valores ya
+ * actualizados de los colores anteriores; así los bloques de un color se resuelven en paralelo y el resultado
+ * no depende del número de hilos.
+ *
+ * Se aplican el criterio de parada, las detecciones de divergencia y estancamiento, la aproximación inicial y
+ * las estadísticas de OpcionesIterativas. Con un criterio de residuo, Jacobi lo obtiene sin otro producto como
+ * A_II·(x_I nuevo - x_I anterior), que es el residuo exacto del punto de partida del barrido, y devuelve ese
+ * punto; Gauss-Seidel calcula b - A·x del resultado de cada barrido, que es el que devuelve.
+ *
+ * @param A Matriz dispersa cuadrada.
+ * @param b Vector columna de términos independientes.
+ * @param particion Bloques de incógnitas (del tamaño de A).
+ * @param opciones Tolerancia, criterio, iteraciones máximas y aproximación inicial; no admite aceleración.
+ * @param usarValoresActuales Si es true, Gauss-Seidel por bloques; si es false, Jacobi por bloques.
+ * @param hilos Número de hilos; 0 usa todos los núcleos disponibles.
+ * @param afinidad Política para fijar cada hilo a un núcleo.
+ * @return Matrix Vector solución del sistema.
+ *
+ * @throw std::invalid_argument Si las dimensiones no son compatibles o se pide aceleración.
+ * @throw std::runtime_error Si algún bloque diagonal es singular, la solución se interrumpe mientras se factorizan
+ *        los bloques (todavía no hay una iteración que devolver), o el método no converge, diverge o se estanca.
+ */
+Matrix metodoIterativoBloques(const SparseMatrix& A, const Matrix& b, const ParticionBloques& particion,
+                              const OpcionesIterativas& opciones, bool usarValoresActuales, int hilos = 0,
+                              PoliticaAfinidad afinidad = PoliticaAfinidad::Ninguna);
+
+/**
+ * @brief Jacobi por bloques; ver metodoIterativoBloques.
+ */
+Matrix jacobiPorBloques(const SparseMatrix& A, const Matrix& b, const ParticionBloques& particion,
+                        const OpcionesIterativas& opciones = OpcionesIterativas(), int hilos = 0);
+
+/**
+ * @brief Gauss-Seidel por bloques (ordenado por colores); ver metodoIterativoBloques.
+ */
+Matrix gaussSeidelPorBloques(const SparseMatrix& A, const Matrix& b, const ParticionBloques& particion,
+                             const OpcionesIterativas& opciones = OpcionesIterativas(), int hilos = 0);
+
+#endif
@@ -0,0 +1,702 @@
+/**
+ * @file DomainDecomposition.cpp
+ * @brief Implementación de los métodos iterativos por descomposición del dominio.
+ *
+ * @section features_sec Características principales
+ * -Núcleo de Jacobi y de gradiente conjugado por bloques de filas, independiente del medio de comunicación.
+ * -Cada proceso intercambia solo las incógnitas del halo de su bloque.
+ * -Comunicador en memoria compartida POSIX (shm_open y mmap) con barreras y reducciones entre procesos.
+ * -Aislamiento de fallos: si un proceso termina de forma anormal los demás se detienen y se informa el error.
+ * -Fijación opcional de cada proceso a un núcleo según la topología NUMA.
+ */
+#include "DomainDecomposition.hpp"
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include "String.hpp"
+#include "utils.hpp"
+#include "ExecutionControl.hpp"
+
+#ifdef __linux__
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <new>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+/**
+ * @brief Canal en el que cada proceso deja su parte de la solución al terminar.
+ */
+const int CANAL_SOLUCION = CANALES_DOMINIO - 1;
+
+/**
+ * @brief Datos locales de un bloque de filas: límites, halo, diagonal, término independiente y vectores de trabajo.
+ */
+struct Subdominio {
+    int n;
+    int inicio;
+    int fin;
+    int numHalo;
+    std::unique_ptr<int[]> halo;          // Columnas de otros bloques que leen las filas locales, en orden. //
+    std::unique_ptr<double[]> diagonal;   // Indexada desde `inicio`. //
+    std::unique_ptr<double[]> terminos;   // Indexado desde `inicio`. //
+    std::unique_ptr<double[]> x;          // Indexado globalmente; solo se usan el bloque propio y el halo. //
+    std::unique_ptr<double[]> direccion;  // Gradiente conjugado: p, indexado globalmente como x. //
+    std::unique_ptr<double[]> trabajo;    // Jacobi: valores nuevos; gradiente conjugado: r, z y A·p, uno tras otro. //
+};
+
+/**
+ * @brief Reserva y llena los datos del bloque `rango` de `procesos`.
+ *
+ * Los vectores de trabajo se reservan sin inicializar: los escribe primero el proceso que resuelve el bloque,
+ * de modo que sus páginas quedan en la memoria de su nodo, y la solución ya no reserva memoria.
+ */
+Subdominio prepararSubdominio(int procesos, int rango, const SparseMatrix& A, const Matrix& b, MetodoDominio metodo) {
+    Subdominio dominio;
+    dominio.n = A.getRows();
+    dominio.inicio = inicioBloque(dominio.n, procesos, rango);
+    dominio.fin = inicioBloque(dominio.n, procesos, rango + 1);
+
+    const int* inicioFila = A.getInicioFila();
+    const int* columnas = A.getColumnas();
+    const double* valores = A.getValores();
+    int locales = dominio.fin - dominio.inicio;
+    dominio.diagonal = std::make_unique<double[]>(locales);
+    dominio.terminos = std::make_unique<double[]>(locales);
+    std::unique_ptr<char[]> marcado = std::make_unique<char[]>(dominio.n);
+    dominio.numHalo = 0;
+    for (int i = dominio.inicio; i < dominio.fin; i++) {
+        double diagonal = 0.0;
+        for (int k = inicioFila[i]; k < inicioFila[i + 1]; k++) {
+            int j = columnas[k];
+            if (j == i) {
+                diagonal = valores[k];
+            } else if ((j < dominio.inicio || j >= dominio.fin) && !marcado[j]) {
+                marcado[j] = 1;
+                dominio.numHalo++;
+            }
+        }
+        dominio.diagonal[i - dominio.inicio] = diagonal;
+        dominio.terminos[i - dominio.inicio] = b.at(i, 0);
+    }
+    // Recorrer las marcas deja el halo ordenado
+    dominio.halo = std::make_unique<int[]>(dominio.numHalo);
+    int cuenta = 0;
+    for (int j = 0; j < dominio.n; j++) {
+        if (marcado[j]) dominio.halo[cuenta++] = j;
+    }
+
+    dominio.x.reset(new double[dominio.n]);
+    if (metodo == MetodoDominio::Jacobi) {
+        dominio.trabajo.reset(new double[locales]);
+    } else {
+        dominio.direccion.reset(new double[dominio.n]);
+        dominio.trabajo.reset(new double[static_cast<size_t>(3) * locales]);
+    }
+    return dominio;
+}
+
+/**
+ * @class InterrupcionAcordada
+ * @brief Hace que todos los procesos se detengan en la misma iteración cuando la solución se interrumpe.
+ *
+ * Cada proceso puede ver la cancelación o el plazo de su control en un momento distinto, y si uno se detuviera
+ * antes que los demás estos quedarían esperando en la siguiente barrera. Por eso el estado del control de cada
+ * proceso se reduce junto con las medidas de la iteración y solo el resultado se refleja en un control local,
+ * que es el que consulta ControlParada.
+ */
+class InterrupcionAcordada {
+    private:
+        ControlEjecucion* externo;
+        ControlEjecucion local;
+        SesionControl sesion;
+    public:
+        InterrupcionAcordada() : externo(SesionControl::activo()), sesion(&local) {}
+
+        /**
+        * @brief Estado del control de este proceso, como valor para la reducción con máximo.
+        */
+        double solicitud() const {
+            return externo != nullptr ? static_cast<double>(externo->comprobar()) : 0.0;
+        }
+
+        /**
+        * @brief Aplica al control local el estado reducido entre todos los procesos.
+        */
+        void acordar(double reducido) {
+            EstadoEjecucion estado = static_cast<EstadoEjecucion>(static_cast<int>(reducido));
+            if (estado == EstadoEjecucion::Cancelada) {
+                local.cancelar();
+            } else if (estado == EstadoEjecucion::PlazoVencido) {
+                local.fijarPlazo(std::chrono::steady_clock::now());
+            }
+        }
+};
+
+/**
+ * @brief Jacobi por bloques: cada proceso actualiza sus filas con los valores de la iteración anterior.
+ *
+ * Los vectores se alternan entre los canales 0 y 1, de modo que nadie sobrescribe valores que otro proceso
+ * aún puede estar leyendo. El cambio y el residuo (|a_ii|·cambio, como en metodoIterativoGeneral) se
+ * reducen con el máximo entre todos los procesos.
+ */
+void jacobiSubdominio(ComunicadorDominio& comunicador, const SparseMatrix& A, const Subdominio& dominio,
+                      ControlParada& control, InterrupcionAcordada& interrupcion, int maxIter) {
+    const int* inicioFila = A.getInicioFila();
+    const int* columnas = A.getColumnas();
+    const double* valores = A.getValores();
+    int locales = dominio.fin - dominio.inicio;
+    double* x = dominio.x.get();
+    double* nuevo = dominio.trabajo.get();
+
+    int canal = 0;
+    comunicador.publicar(canal, x + dominio.inicio, dominio.inicio, locales);
+    comunicador.barrera();
+    for (int iter = 0; iter < maxIter; iter++) {
+        comunicador.recibirHalo(canal, dominio.halo.get(), dominio.numHalo, x);
+        double medidas[3] = {0.0, 0.0, interrupcion.solicitud()};
+        for (int i = dominio.inicio; i < dominio.fin; i++) {
+            double suma = 0.0;
+            for (int k = inicioFila[i]; k < inicioFila[i + 1]; k++) {
+                if (columnas[k] != i) suma += valores[k] * x[columnas[k]];
+            }
+            double diagonal = dominio.diagonal[i - dominio.inicio];
+            double valor = (dominio.terminos[i - dominio.inicio] - suma) / diagonal;
+            double cambio = std::abs(valor - x[i]);
+            medidas[0] = std::max(medidas[0], cambio);
+            medidas[1] = std::max(medidas[1], std::abs(diagonal) * cambio);
+            nuevo[i - dominio.inicio] = valor;
+        }
+        std::copy(nuevo, nuevo + locales, x + dominio.inicio);
+        canal = 1 - canal;
+        comunicador.publicar(canal, x + dominio.inicio, dominio.inicio, locales);
+        comunicador.reducirMaximo(medidas, 3);
+        interrupcion.acordar(medidas[2]);
+        if (control.evaluar(ResultadoBarrido{medidas[0], medidas[1]})) return;
+    }
+    control.noConvergio();
+}
+
+/**
+ * @brief Gradiente conjugado por bloques con precondicionador diagonal.
+ *
+ * Solo la dirección p necesita el halo (canal 1); los productos internos se reducen con suma.
+ */
+void gradienteConjugadoSubdominio(ComunicadorDominio& comunicador, const SparseMatrix& A, const Subdominio& dominio,
+                                  ControlParada& control, InterrupcionAcordada& interrupcion, int maxIter) {
+    const int* inicioFila = A.getInicioFila();
+    const int* columnas = A.getColumnas();
+    const double* valores = A.getValores();
+    int locales = dominio.fin - dominio.inicio;
+    double* x = dominio.x.get();
+    double* r = dominio.trabajo.get();
+    double* z = r + locales;
+    double* Ap = z + locales;
+    double* p = dominio.direccion.get(); // Indexado globalmente para leer el halo en su lugar. //
+
+    auto multiplicarBloque = [&](const double* v, double* salida) {
+        for (int i = dominio.inicio; i < dominio.fin; i++) {
+            double suma = 0.0;
+            for (int k = inicioFila[i]; k < inicioFila[i + 1]; k++) suma += valores[k] * v[columnas[k]];
+            salida[i - dominio.inicio] = suma;
+        }
+    };
+
+    comunicador.publicar(0, x + dominio.inicio, dominio.inicio, locales);
+    comunicador.barrera();
+    comunicador.recibirHalo(0, dominio.halo.get(), dominio.numHalo, x);
+    multiplicarBloque(x, Ap);
+    double sumas[1] = {0.0};
+    double maximos[1] = {0.0};
+    for (int k = 0; k < locales; k++) {
+        r[k] = dominio.terminos[k] - Ap[k];
+        z[k] = r[k] / dominio.diagonal[k];
+        p[dominio.inicio + k] = z[k];
+        sumas[0] += r[k] * z[k];
+        maximos[0] = std::max(maximos[0], std::abs(r[k]));
+    }
+    comunicador.reducirSuma(sumas, 1);
+    comunicador.reducirMaximo(maximos, 1);
+    double rz = sumas[0];
+    if (maximos[0] == 0.0) return; // La aproximación inicial ya es la solución exacta
+
+    for (int iter = 0; iter < maxIter; iter++) {
+        comunicador.publicar(1, p + dominio.inicio, dominio.inicio, locales);
+        comunicador.barrera();
+        comunicador.recibirHalo(1, dominio.halo.get(), dominio.numHalo, p);
+        multiplicarBloque(p, Ap);
+        sumas[0] = 0.0;
+        for (int k = 0; k < locales; k++) sumas[0] += p[dominio.inicio + k] * Ap[k];
+        comunicador.reducirSuma(sumas, 1);
+        if (!(sumas[0] > 0.0)) {
+            throw std::runtime_error("El gradiente conjugado requiere una matriz (y precondicionador) definida positiva.");
+        }
+        double alfa = rz / sumas[0];
+        double medidas[3] = {0.0, 0.0, interrupcion.solicitud()};
+        for (int k = 0; k < locales; k++) {
+            x[dominio.inicio + k] += alfa * p[dominio.inicio + k];
+            r[k] -= alfa * Ap[k];
+            medidas[0] = std::max(medidas[0], std::abs(alfa * p[dominio.inicio + k]));
+            medidas[1] = std::max(medidas[1], std::abs(r[k]));
+        }
+        comunicador.reducirMaximo(medidas, 3);
+        interrupcion.acordar(medidas[2]);
+        if (control.evaluar(ResultadoBarrido{medidas[0], medidas[1]})) return;
+
+        sumas[0] = 0.0;
+        for (int k = 0; k < locales; k++) {
+            z[k] = r[k] / dominio.diagonal[k];
+            sumas[0] += r[k] * z[k];
+        }
+        comunicador.reducirSuma(sumas, 1);
+        double beta = sumas[0] / rz;
+        rz = sumas[0];
+        for (int k = 0; k < locales; k++) p[dominio.inicio + k] = z[k] + beta * p[dominio.inicio + k];
+    }
+    control.noConvergio();
+}
+
+/**
+ * @brief Resuelve un bloque ya preparado con prepararSubdominio y publica su parte de la solución.
+ */
+void resolverPreparado(ComunicadorDominio& comunicador, const SparseMatrix& A, Subdominio& dominio,
+                       const OpcionesIterativas& opciones, MetodoDominio metodo) {
+    comunicador.registrarHalo(dominio.halo.get(), dominio.numHalo);
+    double* x = dominio.x.get();
+    for (int i = dominio.inicio; i < dominio.fin; i++) {
+        x[i] = opciones.aproximacionInicial != nullptr ? opciones.aproximacionInicial->at(i, 0) : 0.0;
+    }
+
+    double normaB = 0.0;
+    for (int k = 0; k < dominio.fin - dominio.inicio; k++) normaB = std::max(normaB, std::abs(dominio.terminos[k]));
+    comunicador.reducirMaximo(&normaB, 1);
+    ControlParada control(opciones, normaB);
+    InterrupcionAcordada interrupcion;
+
+    if (metodo == MetodoDominio::Jacobi) {
+        jacobiSubdominio(comunicador, A, dominio, control, interrupcion, opciones.maxIter);
+    } else {
+        gradienteConjugadoSubdominio(comunicador, A, dominio, control, interrupcion, opciones.maxIter);
+    }
+    comunicador.publicar(CANAL_SOLUCION, x + dominio.inicio, dominio.inicio, dominio.fin - dominio.inicio);
+}
+
+} // namespace
+
+int inicioBloque(int n, int procesos, int rango) {
+    return static_cast<int>(static_cast<long long>(n) * rango / procesos);
+}
+
+void resolverSubdominio(ComunicadorDominio& comunicador, const SparseMatrix& A, const Matrix& b,
+                        const OpcionesIterativas& opciones, MetodoDominio metodo) {
+    Subdominio dominio = prepararSubdominio(comunicador.getProcesos(), comunicador.getRango(), A, b, metodo);
+    resolverPreparado(comunicador, A, dominio, opciones, metodo);
+}
+
+#ifdef __linux__
+
+namespace {
+
+/**
+ * @brief Copia de EstadisticasIterativas sin memoria dinámica, que puede vivir en la región compartida.
+ */
+struct EstadisticasCompartidas {
+    int iteraciones;
+    double medidaFinal;
+    MotivoParada motivo;
+    bool disponible[CANTIDAD_CONTADORES];
+    ContadoresRegion regiones[CANTIDAD_REGIONES_MEDIDAS];
+
+    void guardar(const EstadisticasIterativas& estadisticas) {
+        iteraciones = estadisticas.iteraciones;
+        medidaFinal = estadisticas.medidaFinal;
+        motivo = estadisticas.motivo;
+        for (int k = 0; k < CANTIDAD_CONTADORES; k++) disponible[k] = estadisticas.rendimiento.disponible[k];
+        for (int k = 0; k < CANTIDAD_REGIONES_MEDIDAS; k++) regiones[k] = estadisticas.rendimiento.regiones[k];
+    }
+
+    void recuperar(EstadisticasIterativas& estadisticas) const {
+        estadisticas.iteraciones = iteraciones;
+        estadisticas.medidaFinal = medidaFinal;
+        estadisticas.motivo = motivo;
+        for (int k = 0; k < CANTIDAD_CONTADORES; k++) estadisticas.rendimiento.disponible[k] = disponible[k];
+        for (int k = 0; k < CANTIDAD_REGIONES_MEDIDAS; k++) estadisticas.rendimiento.regiones[k] = regiones[k];
+    }
+};
+
+/**
+ * @brief Estado compartido por todos los procesos al inicio de la región de memoria compartida.
+ */
+struct CabeceraCompartida {
+    pthread_mutex_t mutex;
+    pthread_cond_t condicion;
+    int esperando;                       // Procesos detenidos en la barrera actual.
+    unsigned generacion;                 // Cambia cada vez que la barrera se libera.
+    int abortado;                        // 1 si la comunicación se interrumpió.
+    int conError;                        // 1 si `mensaje` contiene el error a informar.
+    EstadisticasCompartidas estadisticas; // Resumen que deja el proceso 0.
+    char mensaje[256];
+    ControlEjecucion solicitud;          // Cancelación o plazo que el padre transmite a los procesos.
+};
+
+/**
+ * @class ComunicadorMemoriaCompartida
+ * @brief ComunicadorDominio sobre un segmento de memoria compartida POSIX heredado por los procesos hijos.
+ *
+ * Los canales son vectores completos de n elementos: publicar escribe el bloque propio y recibirHalo lee
+ * directamente las posiciones del halo. Las reducciones usan dos juegos de casillas alternados, de modo
+ * que basta una barrera por reducción.
+ */
+class ComunicadorMemoriaCompartida : public ComunicadorDominio {
+    private:
+        int procesos;
+        int n;
+        int rango;
+        unsigned secuenciaReduccion;
+        size_t tamanoRegion;
+        void* region;
+        CabeceraCompartida* cabecera;
+        double* reducciones;
+        double* canales;
+
+        void bloquear() {
+            int codigo = pthread_mutex_lock(&cabecera->mutex);
+            if (codigo == EOWNERDEAD) {
+                // Un proceso murió con el mutex tomado: se recupera y se interrumpe la comunicación
+                pthread_mutex_consistent(&cabecera->mutex);
+                cabecera->abortado = 1;
+                pthread_cond_broadcast(&cabecera->condicion);
+            } else if (codigo != 0) {
+                throw std::runtime_error("No se pudo sincronizar los procesos.");
+            }
+        }
+
+        void desbloquear() {
+            pthread_mutex_unlock(&cabecera->mutex);
+        }
+
+        template<typename Operacion>
+        void reducir(double* valores, int cantidad, Operacion operacion) {
+            if (cantidad > MAX_VALORES_REDUCCION) {
+                throw std::invalid_argument("Demasiados valores para una sola reducción.");
+            }
+            double* juego = reducciones + static_cast<size_t>(secuenciaReduccion % 2) * procesos * MAX_VALORES_REDUCCION;
+            secuenciaReduccion++;
+            std::copy(valores, valores + cantidad, juego + static_cast<size_t>(rango) * MAX_VALORES_REDUCCION);
+            barrera();
+            // Todos combinan en el mismo orden para obtener exactamente el mismo resultado
+            for (int k = 0; k < cantidad; k++) {
+                double resultado = juego[k];
+                for (int p = 1; p < procesos; p++) {
+                    resultado = operacion(resultado, juego[static_cast<size_t>(p) * MAX_VALORES_REDUCCION + k]);
+                }
+                valores[k] = resultado;
+            }
+        }
+
+    public:
+        ComunicadorMemoriaCompartida(int procesos, int n)
+            : procesos(procesos), n(n), rango(0), secuenciaReduccion(0), region(MAP_FAILED) {
+            size_t cabeceraAlineada = (sizeof(CabeceraCompartida) + 63) / 64 * 64;
+            size_t casillas = static_cast<size_t>(2) * procesos * MAX_VALORES_REDUCCION;
+            tamanoRegion = cabeceraAlineada + (casillas + static_cast<size_t>(CANALES_DOMINIO) * n) * sizeof(double);
+
+            static std::atomic<int> contador(0);
+            String pidStr; pidStr.fromInt(static_cast<int>(getpid()));
+            String numeroStr; numeroStr.fromInt(contador++);
+            String nombre = String("/linsys-dominio-") + pidStr + String("-") + numeroStr;
+            int descriptor = shm_open(nombre.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+            if (descriptor < 0) {
+                throw std::runtime_error("No se pudo crear el segmento de memoria compartida.");
+            }
+            // El nombre se elimina de inmediato: los procesos hijos heredan la proyección y no queda nada que limpiar
+            shm_unlink(nombre.c_str());
+            if (ftruncate(descriptor, static_cast<off_t>(tamanoRegion)) == 0) {
+                region = mmap(nullptr, tamanoRegion, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+            }
+            close(descriptor);
+            if (region == MAP_FAILED) {
+                throw std::runtime_error("No se pudo proyectar el segmento de memoria compartida.");
+            }
+
+            cabecera = new (region) CabeceraCompartida();
+            reducciones = reinterpret_cast<double*>(static_cast<char*>(region) + cabeceraAlineada);
+            canales = reducciones + casillas;
+
+            pthread_mutexattr_t atributosMutex;
+            pthread_mutexattr_init(&atributosMutex);
+            pthread_mutexattr_setpshared(&atributosMutex, PTHREAD_PROCESS_SHARED);
+            pthread_mutexattr_setrobust(&atributosMutex, PTHREAD_MUTEX_ROBUST);
+            pthread_mutex_init(&cabecera->mutex, &atributosMutex);
+            pthread_mutexattr_destroy(&atributosMutex);
+            pthread_condattr_t atributosCondicion;
+            pthread_condattr_init(&atributosCondicion);
+            pthread_condattr_setpshared(&atributosCondicion, PTHREAD_PROCESS_SHARED);
+            pthread_cond_init(&cabecera->condicion, &atributosCondicion);
+            pthread_condattr_destroy(&atributosCondicion);
+        }
+
+        ~ComunicadorMemoriaCompartida() override {
+            pthread_cond_destroy(&cabecera->condicion);
+            pthread_mutex_destroy(&cabecera->mutex);
+            cabecera->~CabeceraCompartida();
+            munmap(region, tamanoRegion);
+        }
+
+        ComunicadorMemoriaCompartida(const ComunicadorMemoriaCompartida&) = delete;
+        ComunicadorMemoriaCompartida& operator=(const ComunicadorMemoriaCompartida&) = delete;
+
+        /**
+        * @brief Fija el rango de este proceso (se llama en cada hijo después de fork).
+        */
+        void asignarRango(int r) {
+            rango = r;
+        }
+
+        int getRango() const override {
+            return rango;
+        }
+
+        int getProcesos() const override {
+            return procesos;
+        }
+
+        void registrarHalo(const int* indices, int cantidad) override {
+            (void)indices;
+            (void)cantidad;
+        }
+
+        void publicar(int canal, const double* valores, int inicio, int cantidad) override {
+            std::copy(valores, valores + cantidad, canales + static_cast<size_t>(canal) * n + inicio);
+        }
+
+        void recibirHalo(int canal, const int* indices, int cantidad, double* destino) override {
+            const double* vector = canales + static_cast<size_t>(canal) * n;
+            for (int k = 0; k < cantidad; k++) destino[indices[k]] = vector[indices[k]];
+        }
+
+        void barrera() override {
+            bloquear();
+            if (!cabecera->abortado) {
+                unsigned generacion = cabecera->generacion;
+                if (++cabecera->esperando == procesos) {
+                    cabecera->esperando = 0;
+                    cabecera->generacion++;
+                    pthread_cond_broadcast(&cabecera->condicion);
+                } else {
+                    while (generacion == cabecera->generacion && !cabecera->abortado) {
+                        if (pthread_cond_wait(&cabecera->condicion, &cabecera->mutex) == EOWNERDEAD) {
+                            pthread_mutex_consistent(&cabecera->mutex);
+                            cabecera->abortado = 1;
+                        }
+                    }
+                }
+            }
+            bool abortado = cabecera->abortado != 0;
+            desbloquear();
+            if (abortado) {
+                throw std::runtime_error("Se interrumpió la comunicación entre los procesos.");
+            }
+        }
+
+        void reducirSuma(double* valores, int cantidad) override {
+            reducir(valores, cantidad, [](double a, double b) { return a + b; });
+        }
+
+        void reducirMaximo(double* valores, int cantidad) override {
+            reducir(valores, cantidad, [](double a, double b) { return std::max(a, b); });
+        }
+
+        /**
+        * @brief Interrumpe la comunicación y despierta a los procesos detenidos en la barrera.
+        */
+        void abortar() {
+            bloquear();
+            cabecera->abortado = 1;
+            pthread_cond_broadcast(&cabecera->condicion);
+            desbloquear();
+        }
+
+        /**
+        * @brief Guarda el mensaje de error si todavía no hay otro registrado.
+        */
+        void registrarError(const char* mensaje) {
+            bloquear();
+            if (!cabecera->conError) {
+                cabecera->conError = 1;
+                std::strncpy(cabecera->mensaje, mensaje, sizeof(cabecera->mensaje) - 1);
+                cabecera->mensaje[sizeof(cabecera->mensaje) - 1] = '\0';
+            }
+            desbloquear();
+        }
+
+        bool tieneError() const {
+            return cabecera->conError != 0;
+        }
+
+        const char* getMensaje() const {
+            return cabecera->mensaje;
+        }
+
+        EstadisticasCompartidas* getEstadisticas() {
+            return &cabecera->estadisticas;
+        }
+
+        /**
+        * @brief Control que comparten los procesos; sus variables atómicas viven en la región compartida.
+        */
+        ControlEjecucion* getSolicitud() {
+            return &cabecera->solicitud;
+        }
+
+        const double* getSolucion() const {
+            return canales + static_cast<size_t>(CANAL_SOLUCION) * n;
+        }
+};
+
+/**
+ * @brief Cuerpo de cada proceso hijo; nunca regresa.
+ *
+ * Trabaja sobre el subdominio que el padre preparó antes de fork, así que no reserva memoria salvo para
+ * informar un error.
+ */
+[[noreturn]] void ejecutarProceso(ComunicadorMemoriaCompartida& comunicador, int rango, const SparseMatrix& A,
+                                  Subdominio& dominio, const OpcionesIterativas& opciones, MetodoDominio metodo) {
+    int codigo = 0;
+    EstadisticasIterativas estadisticas;
+    // El control de ejecución del padre no es visible desde este proceso; el padre lo verifica mientras espera
+    // y transmite la interrupción por el control de la región compartida
+    SesionControl sesion(comunicador.getSolicitud());
+    try {
+        comunicador.asignarRango(rango);
+        OpcionesIterativas opcionesProceso = opciones;
+        opcionesProceso.estadisticas = rango == 0 ? &estadisticas : nullptr;
+        resolverPreparado(comunicador, A, dominio, opcionesProceso, metodo);
+    } catch (const std::exception& e) {
+        comunicador.registrarError(e.what());
+        codigo = 1;
+    } catch (...) {
+        comunicador.registrarError("Error desconocido en un proceso del dominio.");
+        codigo = 1;
+    }
+    // Las estadísticas se copian sin punteros: el heap de este proceso no es visible para el padre
+    if (rango == 0) comunicador.getEstadisticas()->guardar(estadisticas);
+    // _exit evita ejecutar destructores y manejadores de salida heredados del proceso padre
+    _exit(codigo);
+}
+
+} // namespace
+
+#endif
+
+Matrix resolverPorDominios(const SparseMatrix& A, const Matrix& b, const OpcionesIterativas& opciones,
+                           int procesos, MetodoDominio metodo, PoliticaAfinidad afinidad) {
+    int n = A.getRows();
+    if (A.getCols() != n || b.getRows() != n || b.getCols() != 1) {
+        throw std::invalid_argument("Las dimensiones de A y b no son compatibles.");
+    }
+    if (procesos <= 0) {
+        throw std::invalid_argument("El número de procesos debe ser positivo.");
+    }
+    const Matrix* inicial = opciones.aproximacionInicial;
+    if (inicial != nullptr && (inicial->getRows() != n || inicial->getCols() != 1)) {
+        throw std::invalid_argument("La aproximación inicial no coincide con el tamaño del sistema.");
+    }
+    std::unique_ptr<double[]> diagonal = std::make_unique<double[]>(n);
+    A.diagonal(diagonal.get());
+    for (int i = 0; i < n; i++) {
+        if (std::abs(diagonal[i]) < 1e-12) {
+            String pos; pos.fromInt(i);
+            String msg = String("Cero en la diagonal principal en (") + pos + String(",") + pos + String(").");
+            throw std::runtime_error(msg.c_str());
+        }
+    }
+
+#ifdef __linux__
+    procesos = std::min(procesos, n);
+    ComunicadorMemoriaCompartida comunicador(procesos, n);
+    topologiaSistema(); // Se detecta antes de fork para que los hijos no relean /sys
+    // Todo lo que reservan los hijos se reserva aquí: un hijo de un proceso con varios hilos no puede llamar a
+    // malloc con seguridad, porque otro hilo pudo tener tomado su candado en el momento de fork
+    std::unique_ptr<Subdominio[]> dominios = std::make_unique<Subdominio[]>(procesos);
+    for (int rango = 0; rango < procesos; rango++) dominios[rango] = prepararSubdominio(procesos, rango, A, b, metodo);
+    std::unique_ptr<pid_t[]> hijos = std::make_unique<pid_t[]>(procesos);
+    for (int rango = 0; rango < procesos; rango++) {
+        pid_t pid = fork();
+        if (pid == 0) {
+            // Fijado antes de tocar los vectores de trabajo, que así quedan en la memoria del nodo del proceso
+            fijarHilo(afinidad, rango);
+            ejecutarProceso(comunicador, rango, A, dominios[rango], opciones, metodo);
+        }
+        if (pid < 0) {
+            comunicador.abortar();
+            for (int creado = 0; creado < rango; creado++) waitpid(hijos[creado], nullptr, 0);
+            throw std::runtime_error("No se pudieron crear los procesos del dominio.");
+        }
+        hijos[rango] = pid;
+    }
+
+    // Se espera a todos los hijos; si uno termina de forma anormal se interrumpe a los demás
+    std::unique_ptr<char[]> terminado = std::make_unique<char[]>(procesos);
+    int pendientes = procesos;
+    ControlEjecucion* ejecucion = SesionControl::activo();
+    bool interrumpido = false;
+    while (pendientes > 0) {
+        bool alguno = false;
+        for (int p = 0; p < procesos; p++) {
+            if (terminado[p]) continue;
+            int estado = 0;
+            pid_t resultado = waitpid(hijos[p], &estado, WNOHANG);
+            if (resultado == 0 || (resultado < 0 && errno == EINTR)) continue;
+            terminado[p] = 1;
+            pendientes--;
+            alguno = true;
+            bool correcto = resultado == hijos[p] && WIFEXITED(estado) && WEXITSTATUS(estado) == 0;
+            if (!correcto) {
+                if (resultado != hijos[p] || !WIFEXITED(estado)) {
+                    comunicador.registrarError("Un proceso del dominio terminó de forma anormal.");
+                }
+                comunicador.abortar();
+            }
+        }
+        EstadoEjecucion estado = ejecucion != nullptr ? ejecucion->comprobar() : EstadoEjecucion::Activa;
+        if (estado != EstadoEjecucion::Activa && !interrumpido) {
+            // Los procesos se detienen juntos en su siguiente iteración y publican la solución que llevan
+            if (estado == EstadoEjecucion::Cancelada) {
+                comunicador.getSolicitud()->cancelar();
+            } else {
+                comunicador.getSolicitud()->fijarPlazo(std::chrono::steady_clock::now());
+            }
+            interrumpido = true;
+        }
+        if (!alguno && pendientes > 0) {
+            timespec pausa{0, 200000};
+            nanosleep(&pausa, nullptr);
+        }
+    }
+
+    if (opciones.estadisticas != nullptr) {
+        comunicador.getEstadisticas()->recuperar(*opciones.estadisticas);
+    }
+    if (comunicador.tieneError()) {
+        throw std::runtime_error(comunicador.getMensaje());
+    }
+    Matrix x(n, 1);
+    const double* solucion = comunicador.getSolucion();
+    for (int i = 0; i < n; i++) x.at(i, 0) = solucion[i];
+    return x;
+#else
+    (void)metodo;
+    throw std::runtime_error("La resolución por dominios con memoria compartida solo está disponible en Linux.");
+#endif
+}
@@ -0,0 +1,159 @@
+/**
+ * @file DomainDecomposition.hpp
+ * @brief Declaración de los métodos iterativos por descomposición del dominio en bloques de filas.
+ *
+ * Cada proceso es dueño de un bloque contiguo de filas de A y de las incógnitas correspondientes; en cada
+ * iteración solo necesita los valores de las incógnitas ajenas que aparecen en sus filas (el halo). Toda la
+ * comunicación pasa por la interfaz ComunicadorDominio, de modo que el mismo núcleo (resolverSubdominio)
+ * sirve con memoria compartida entre procesos de una máquina o con un backend de paso de mensajes.
+ *
+ * Usar procesos en lugar de hilos aísla los fallos (un proceso que aborta no corrompe la memoria de los
+ * demás) y evita que la asignación de memoria de un solo proceso quede concentrada en un socket.
+ */
+#ifndef DOMAIN_DECOMPOSITION_HPP
+#define DOMAIN_DECOMPOSITION_HPP
+
+#include "Matrix.hpp"
+#include "SparseMatrix.hpp"
+#include "IterativeOptions.hpp"
+#include "Numa.hpp"
+
+/**
+ * @brief Método que resuelve cada subdominio.
+ */
+enum class MetodoDominio {
+    Jacobi,            ///< Barrido de Jacobi por bloques (la misma regla que metodoIterativoGeneral).
+    GradienteConjugado ///< Gradiente conjugado con precondicionador diagonal (A simétrica definida positiva).
+};
+
+/**
+ * @class ComunicadorDominio
+ * @brief Interfaz de comunicación entre los procesos que resuelven los subdominios.
+ *
+ * Los vectores distribuidos se identifican por un canal (0 a CANALES_DOMINIO - 1). Un proceso publica los
+ * valores de sus propias filas y, después de la siguiente sincronización (barrera o reducción), los demás
+ * pueden leer los que necesiten. Las reducciones también sincronizan y devuelven el mismo resultado en todos
+ * los procesos, en el mismo orden de suma, para que todos tomen las mismas decisiones de parada.
+ */
+class ComunicadorDominio {
+    public:
+        virtual ~ComunicadorDominio() = default;
+
+        /**
+        * @brief Número de este proceso, de 0 a getProcesos() - 1.
+        */
+        virtual int getRango() const = 0;
+
+        /**
+        * @brief Número total de procesos.
+        */
+        virtual int getProcesos() const = 0;
+
+        /**
+        * @brief Declara las incógnitas ajenas que este proceso leerá en cada iteración.
+        *
+        * Con memoria compartida no hace nada; un backend de paso de mensajes lo usa para armar las listas de envío.
+        */
+        virtual void registrarHalo(const int* indices, int cantidad) = 0;
+
+        /**
+        * @brief Publica los valores de las filas propias del vector `canal`.
+        *
+        * @param valores Valores de las filas [inicio, inicio + cantidad) del bloque propio.
+        */
+        virtual void publicar(int canal, const double* valores, int inicio, int cantidad) = 0;
+
+        /**
+        * @brief Lee las incógnitas ajenas `indices` del vector `canal` publicadas antes de la última sincronización.
+        *
+        * @param destino Arreglo indexado globalmente: se escribe destino[indices[k]].
+        */
+        virtual void recibirHalo(int canal, const int* indices, int cantidad, double* destino) = 0;
+
+        /**
+        * @brief Sincroniza todos los procesos.
+        *
+        * @throws std::runtime_error Si la comunicación se interrumpió (por ejemplo, porque otro proceso falló).
+        */
+        virtual void barrera() = 0;
+
+        /**
+        * @brief Suma elemento a elemento `valores` entre todos los procesos (a lo más MAX_VALORES_REDUCCION).
+        */
+        virtual void reducirSuma(double* valores, int cantidad) = 0;
+
+        /**
+        * @brief Máximo elemento a elemento de `valores` entre todos los procesos (a lo más MAX_VALORES_REDUCCION).
+        */
+        virtual void reducirMaximo(double* valores, int cantidad) = 0;
+};
+
+/**
+ * @brief Número de vectores distribuidos que ofrece un ComunicadorDominio.
+ */
+const int CANALES_DOMINIO = 3;
+
+/**
+ * @brief Número máximo de valores por reducción.
+ */
+const int MAX_VALORES_REDUCCION = 4;
+
+/**
+ * @brief Primera fila del bloque del proceso `rango` (el bloque termina donde empieza el del siguiente).
+ */
+int inicioBloque(int n, int procesos, int rango);
+
+/**
+ * @brief Resuelve el bloque de filas de este proceso; todos los procesos deben llamarla con los mismos datos.
+ *
+ * Al terminar, la solución queda publicada en el último canal (CANALES_DOMINIO - 1). Aplica el control de parada de OpcionesIterativas
+ * con el cambio y el residuo de todo el sistema, por lo que todos los procesos se detienen en la misma iteración.
+ * El estado del ControlEjecucion activo en cada proceso se reduce junto con esas medidas: si la solución se
+ * cancela o vence su plazo en cualquiera de ellos, todos terminan en la misma iteración, publican la solución
+ * que llevan y dejan el motivo en las estadísticas.
+ *
+ * @param comunicador Comunicación con los demás procesos.
+ * @param A Matriz dispersa cuadrada (todas sus filas, aunque solo se usen las del bloque).
+ * @param b Vector columna de términos independientes.
+ * @param opciones Tolerancia, criterio de parada, iteraciones máximas y aproximación inicial (la aceleración se ignora).
+ * @param metodo Jacobi o gradiente conjugado.
+ *
+ * @throw std::runtime_error Si el método no converge, diverge, se estanca o la comunicación se interrumpe.
+ */
+void resolverSubdominio(ComunicadorDominio& comunicador, const SparseMatrix& A, const Matrix& b,
+                        const OpcionesIterativas& opciones, MetodoDominio metodo);
+
+/**
+ * @brief Resuelve A·x = b repartiendo las filas entre `procesos` procesos que comparten memoria POSIX.
+ *
+ * Crea los procesos con fork, los sincroniza con barreras en memoria compartida y reúne la solución al final.
+ * Si un proceso termina de forma anormal, los demás se detienen y se lanza una excepción, sin afectar al
+ * proceso que llamó a la función. Solo está disponible en Linux.
+ *
+ * Los procesos no ven el ControlEjecucion del hilo que llama; este lo verifica mientras espera y, si la
+ * solución se cancela o vence su plazo, se lo transmite a los procesos por la memoria compartida. Como los
+ * demás métodos iterativos, devuelve entonces la última iteración con el motivo Cancelacion o PlazoVencido
+ * en `opciones.estadisticas`.
+ *
+ * Precondición: ningún otro hilo del proceso que llama debe estar en ejecución. Un hijo de fork solo conserva
+ * el hilo que lo creó, y si otro hilo tenía tomado el candado de malloc en ese momento el hijo se bloquearía
+ * al reservar memoria. El padre prepara antes de fork los datos y vectores de trabajo de cada subdominio, así
+ * que los hijos solo reservan memoria para informar un error, pero eso no cubre todos los casos.
+ *
+ * @param A Matriz dispersa cuadrada sin ceros en la diagonal.
+ * @param b Vector columna de términos independientes.
+ * @param opciones Opciones de la iteración; `opciones.estadisticas` recibe el resumen.
+ * @param procesos Número de procesos (se limita al número de filas).
+ * @param metodo Jacobi o gradiente conjugado.
+ * @param afinidad Política para fijar cada proceso a un núcleo; el proceso de rango p se fija como el hilo p.
+ * @return Matrix Vector solución del sistema.
+ *
+ * @throw std::invalid_argument Si las dimensiones no son compatibles o el número de procesos no es positivo.
+ * @throw std::runtime_error Si hay ceros en la diagonal, el método no converge, un proceso falla o la plataforma
+ *        no lo permite.
+ */
+Matrix resolverPorDominios(const SparseMatrix& A, const Matrix& b, const OpcionesIterativas& opciones,
+                           int procesos, MetodoDominio metodo = MetodoDominio::Jacobi,
+                           PoliticaAfinidad afinidad = PoliticaAfinidad::Ninguna);
+
+#endif
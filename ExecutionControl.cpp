@@ -0,0 +1,115 @@
+/**
+ * @file ExecutionControl.cpp
+ * @brief Implementación del control de ejecución de los métodos.
+ *
+ * @section features_sec Características principales
+ * -Cancelación cooperativa desde cualquier hilo con una variable atómica.
+ * -Plazo de tiempo de pared con reloj monótono, consultado en cada punto de verificación.
+ * -Avisos de progreso con un intervalo mínimo entre ellos.
+ * -Sesiones por hilo y anidables, como las de medición de rendimiento.
+ */
+#include "ExecutionControl.hpp"
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+
+thread_local ControlEjecucion* controlActivo = nullptr;
+
+const long long SIN_PLAZO = std::numeric_limits<long long>::max();
+
+} // namespace
+
+ControlEjecucion::ControlEjecucion()
+    : creacion(Reloj::now()), cancelado(false), plazo(SIN_PLAZO),
+      interrupcion(static_cast<int>(EstadoEjecucion::Activa)), intervaloProgreso(0.0), ultimoAviso(-INFINITY) {}
+
+void ControlEjecucion::cancelar() {
+    cancelado.store(true);
+}
+
+void ControlEjecucion::fijarPlazo(std::chrono::steady_clock::time_point limite) {
+    plazo.store(std::chrono::duration_cast<std::chrono::nanoseconds>(limite - creacion).count());
+}
+
+void ControlEjecucion::fijarPresupuesto(double segundos) {
+    if (!(segundos > 0.0)) {
+        throw std::invalid_argument("El presupuesto de tiempo debe ser positivo.");
+    }
+    fijarPlazo(Reloj::now() + std::chrono::duration_cast<Reloj::duration>(std::chrono::duration<double>(segundos)));
+}
+
+void ControlEjecucion::fijarProgreso(std::function<void(const ProgresoSolucion&)> funcion, double intervaloSegundos) {
+    progreso = std::move(funcion);
+    intervaloProgreso = intervaloSegundos;
+}
+
+EstadoEjecucion ControlEjecucion::estado() const {
+    if (cancelado.load(std::memory_order_relaxed)) {
+        return EstadoEjecucion::Cancelada;
+    }
+    long long limite = plazo.load(std::memory_order_relaxed);
+    if (limite != SIN_PLAZO &&
+        std::chrono::duration_cast<std::chrono::nanoseconds>(Reloj::now() - creacion).count() >= limite) {
+        return EstadoEjecucion::PlazoVencido;
+    }
+    return EstadoEjecucion::Activa;
+}
+
+EstadoEjecucion ControlEjecucion::verificar(RegionMedida etapa, int paso, int total, double medida) {
+    if (progreso) {
+        double ahora = segundosTranscurridos();
+        if (ahora - ultimoAviso >= intervaloProgreso) {
+            ultimoAviso = ahora;
+            progreso(ProgresoSolucion{etapa, paso, total, medida, ahora});
+        }
+    }
+    return comprobar();
+}
+
+EstadoEjecucion ControlEjecucion::comprobar() {
+    EstadoEjecucion actual = estado();
+    if (actual != EstadoEjecucion::Activa) {
+        int esperado = static_cast<int>(EstadoEjecucion::Activa);
+        interrupcion.compare_exchange_strong(esperado, static_cast<int>(actual));
+    }
+    return actual;
+}
+
+EstadoEjecucion ControlEjecucion::getInterrupcion() const {
+    return static_cast<EstadoEjecucion>(interrupcion.load());
+}
+
+double ControlEjecucion::segundosTranscurridos() const {
+    return std::chrono::duration<double>(Reloj::now() - creacion).count();
+}
+
+SesionControl::SesionControl(ControlEjecucion* control) : anterior(controlActivo) {
+    controlActivo = control;
+}
+
+SesionControl::~SesionControl() {
+    controlActivo = anterior;
+}
+
+ControlEjecucion* SesionControl::activo() {
+    return controlActivo;
+}
+
+void verificarInterrupcion(RegionMedida etapa, int paso, int total) {
+    if (controlActivo == nullptr) return;
+    EstadoEjecucion estado = controlActivo->verificar(etapa, paso, total, NAN);
+    if (estado != EstadoEjecucion::Activa) {
+        throw std::runtime_error(mensajeInterrupcion(estado));
+    }
+}
+
+const char* mensajeInterrupcion(EstadoEjecucion estado) {
+    switch (estado) {
+        case EstadoEjecucion::Cancelada: return "La solución fue cancelada.";
+        case EstadoEjecucion::PlazoVencido: return "La solución se interrumpió al vencer su plazo.";
+        default: return "La solución no fue interrumpida.";
+    }
+}
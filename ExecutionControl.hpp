@@ -0,0 +1,156 @@
+/**
+ * @file ExecutionControl.hpp
+ * @brief Declaración del control de ejecución de los métodos: cancelación, plazo y avisos de progreso.
+ *
+ * Una vez iniciada, una solución solo terminaba al converger, al agotar las iteraciones o con una excepción,
+ * y la eliminación de Gauss de un sistema grande no podía interrumpirse. Un ControlEjecucion permite cancelar
+ * la solución desde otro hilo, fijarle un plazo de tiempo de pared y recibir avisos de su avance.
+ *
+ * Igual que la medición de rendimiento, el control se activa para el hilo actual con una SesionControl y los
+ * métodos lo consultan en puntos baratos (una vez por columna de pivoteo o por iteración) sin que cambien sus
+ * parámetros. Los métodos iterativos interrumpidos devuelven la última iteración y dejan el motivo en sus
+ * estadísticas; los métodos directos, que no tienen una solución parcial útil, lanzan una excepción.
+ */
+#ifndef EXECUTION_CONTROL_HPP
+#define EXECUTION_CONTROL_HPP
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include "PerfCounters.hpp"
+
+/**
+ * @brief Situación de una solución respecto a su control de ejecución.
+ */
+enum class EstadoEjecucion {
+    Activa,       ///< La solución puede continuar.
+    Cancelada,    ///< Se llamó a ControlEjecucion::cancelar.
+    PlazoVencido  ///< Se alcanzó el plazo fijado.
+};
+
+/**
+ * @brief Aviso de avance de un método.
+ */
+struct ProgresoSolucion {
+    RegionMedida etapa; ///< Eliminacion o Sustitucion en los métodos directos, Iteracion en los iterativos.
+    int paso;           ///< Columna de pivoteo procesada o iteración completada.
+    int total;          ///< Número de columnas o iteraciones máximas.
+    double medida;      ///< Medida del criterio de parada en los iterativos (NaN en los directos).
+    double segundos;    ///< Tiempo transcurrido desde que se creó el control.
+};
+
+/**
+ * @class ControlEjecucion
+ * @brief Token de cancelación, plazo y función de progreso de una o varias soluciones.
+ *
+ * `cancelar`, `fijarPlazo`, `fijarPresupuesto` y `getInterrupcion` pueden llamarse desde cualquier hilo.
+ * `fijarProgreso` debe llamarse antes de empezar a resolver, y `verificar` solo desde el hilo que resuelve.
+ */
+class ControlEjecucion {
+    private:
+        using Reloj = std::chrono::steady_clock;
+
+        Reloj::time_point creacion;
+        std::atomic<bool> cancelado;
+        std::atomic<long long> plazo;        // Nanosegundos desde `creacion`; sin plazo si vale el máximo. //
+        std::atomic<int> interrupcion;       // Primer EstadoEjecucion distinto de Activa que detuvo un método. //
+        std::function<void(const ProgresoSolucion&)> progreso;
+        double intervaloProgreso;
+        double ultimoAviso;
+    public:
+        ControlEjecucion();
+
+        ControlEjecucion(const ControlEjecucion&) = delete;
+        ControlEjecucion& operator=(const ControlEjecucion&) = delete;
+
+        /**
+        * @brief Pide que las soluciones controladas se detengan en su siguiente punto de verificación.
+        */
+        void cancelar();
+
+        /**
+        * @brief Fija el instante a partir del cual las soluciones controladas deben detenerse.
+        */
+        void fijarPlazo(std::chrono::steady_clock::time_point limite);
+
+        /**
+        * @brief Fija el plazo a `segundos` desde ahora.
+        *
+        * @throws std::invalid_argument Si los segundos no son positivos.
+        */
+        void fijarPresupuesto(double segundos);
+
+        /**
+        * @brief Registra la función que recibe los avisos de progreso.
+        *
+        * @param funcion Función a llamar desde el hilo que resuelve; sus excepciones interrumpen la solución.
+        * @param intervaloSegundos Tiempo mínimo entre dos avisos (0 avisa en cada punto de verificación).
+        */
+        void fijarProgreso(std::function<void(const ProgresoSolucion&)> funcion, double intervaloSegundos = 0.0);
+
+        /**
+        * @brief Indica si se pidió la cancelación o venció el plazo, sin registrar nada.
+        */
+        EstadoEjecucion estado() const;
+
+        /**
+        * @brief Devuelve el estado y, si no es Activa, lo registra como la interrupción del control.
+        */
+        EstadoEjecucion comprobar();
+
+        /**
+        * @brief Punto de verificación de un método: envía el aviso de progreso si corresponde y llama a comprobar.
+        */
+        EstadoEjecucion verificar(RegionMedida etapa, int paso, int total, double medida);
+
+        /**
+        * @brief Motivo por el que un método controlado se detuvo, o Activa si ninguno fue interrumpido.
+        */
+        EstadoEjecucion getInterrupcion() const;
+
+        /**
+        * @brief Segundos transcurridos desde que se creó el control.
+        */
+        double segundosTranscurridos() const;
+};
+
+/**
+ * @class SesionControl
+ * @brief Activa un ControlEjecucion para los métodos que se ejecuten en el hilo actual mientras existe.
+ *
+ * Las sesiones pueden anidarse: al destruirse se reactiva la anterior. Con control nullptr los métodos corren
+ * sin control. Los hilos que crean los propios métodos no heredan la sesión; los métodos paralelos verifican
+ * el control desde el hilo que los llamó.
+ */
+class SesionControl {
+    private:
+        ControlEjecucion* anterior;
+    public:
+        explicit SesionControl(ControlEjecucion* control);
+        ~SesionControl();
+
+        SesionControl(const SesionControl&) = delete;
+        SesionControl& operator=(const SesionControl&) = delete;
+
+        /**
+        * @brief Control activo del hilo actual, o nullptr si no hay ninguno.
+        */
+        static ControlEjecucion* activo();
+};
+
+/**
+ * @brief Punto de verificación de los métodos directos.
+ *
+ * Sin control activo solo consulta una variable del hilo. Los datos que el método modifica en el lugar
+ * quedan en un estado intermedio si la solución se interrumpe.
+ *
+ * @throw std::runtime_error Si la solución fue cancelada o venció su plazo.
+ */
+void verificarInterrupcion(RegionMedida etapa, int paso, int total);
+
+/**
+ * @brief Mensaje de la excepción de una solución interrumpida con el estado dado.
+ */
+const char* mensajeInterrupcion(EstadoEjecucion estado);
+
+#endif
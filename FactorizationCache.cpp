@@ -0,0 +1,239 @@
+/**
+ * @file FactorizationCache.cpp
+ * @brief Implementación de la caché de factorizaciones LU indexada por el contenido de la matriz.
+ *
+ * @section features_sec Características principales
+ * -Hash rápido de la matriz procesando cada elemento como una palabra de 64 bits.
+ * -Política LRU con presupuesto de memoria configurable, sobre un arreglo fijo de ranuras enlazadas por índices
+ *  y un índice de direccionamiento abierto por el hash.
+ * -Contadores de aciertos y fallos, protegidos por un mutex junto con el resto del estado.
+ */
+#include "FactorizationCache.hpp"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+CacheFactorizaciones::CacheFactorizaciones(std::size_t presupuesto, int maximoEntradas)
+    : presupuestoBytes(presupuesto), bytesUsados(0), aciertos(0), fallos(0), capacidad(maximoEntradas),
+      numEntradas(0), primera(-1), ultima(-1), libre(0) {
+    if (maximoEntradas <= 0) {
+        throw std::invalid_argument("El número máximo de entradas de la caché debe ser positivo.");
+    }
+    entradas = std::make_unique<Entrada[]>(capacidad);
+    for (int r = 0; r < capacidad; r++) entradas[r].siguiente = r + 1 < capacidad ? r + 1 : -1;
+    // Con el índice a lo más medio lleno las búsquedas recorren pocas posiciones
+    int tamanoIndice = 1;
+    while (tamanoIndice < 2 * capacidad) tamanoIndice *= 2;
+    mascaraIndice = tamanoIndice - 1;
+    indice.reset(new int[tamanoIndice]);
+    std::fill(indice.get(), indice.get() + tamanoIndice, -1);
+}
+
+/**
+ * @brief Hash de 64 bits de las dimensiones y el contenido de A.
+ *
+ * Combina cada elemento (como patrón de bits) con una multiplicación y un desplazamiento, lo que cuesta
+ * unas pocas instrucciones por elemento, muy por debajo del costo de la factorización que se evita.
+ */
+std::uint64_t CacheFactorizaciones::hashMatriz(const Matrix& A) {
+    const std::uint64_t PRIMO = 0x100000001b3ULL;
+    std::uint64_t hash = 0xcbf29ce484222325ULL;
+    auto mezclar = [&](std::uint64_t palabra) {
+        hash ^= palabra;
+        hash *= PRIMO;
+        hash ^= hash >> 29;
+    };
+    mezclar(static_cast<std::uint64_t>(A.getRows()));
+    mezclar(static_cast<std::uint64_t>(A.getCols()));
+    for (int i = 0; i < A.getRows(); i++) {
+        for (int j = 0; j < A.getCols(); j++) {
+            std::uint64_t bits;
+            std::memcpy(&bits, &A.at(i, j), sizeof(bits));
+            mezclar(bits);
+        }
+    }
+    return hash;
+}
+
+/**
+ * @brief Memoria aproximada de una FactorizacionLU de rango máximo 1: matriz vigente, factores y vectores auxiliares.
+ */
+std::size_t CacheFactorizaciones::bytesFactorizacion(int n) {
+    std::size_t dn = static_cast<std::size_t>(n);
+    return (2 * dn * dn + 3 * dn + 1) * sizeof(double) + dn * sizeof(int);
+}
+
+/**
+ * @brief Posición del índice que apunta a la entrada con este hash, o -1 si no está guardado.
+ * Debe llamarse con el mutex tomado, igual que los demás métodos privados.
+ */
+int CacheFactorizaciones::buscar(std::uint64_t hash) const {
+    int posicion = static_cast<int>(hash & static_cast<std::uint64_t>(mascaraIndice));
+    while (indice[posicion] != -1) {
+        if (entradas[indice[posicion]].hash == hash) return posicion;
+        posicion = (posicion + 1) & mascaraIndice;
+    }
+    return -1;
+}
+
+/**
+ * @brief Vacía una posición del índice y recorre hacia atrás las siguientes de su racha de sondeo,
+ * para que ninguna búsqueda se detenga antes de tiempo (no se necesitan marcas de borrado).
+ */
+void CacheFactorizaciones::quitarDelIndice(int posicion) {
+    int hueco = posicion;
+    int actual = posicion;
+    while (true) {
+        actual = (actual + 1) & mascaraIndice;
+        if (indice[actual] == -1) break;
+        int propia = static_cast<int>(entradas[indice[actual]].hash & static_cast<std::uint64_t>(mascaraIndice));
+        // Se queda si su posición propia está en (hueco, actual], contando la vuelta del arreglo
+        bool quedarse = hueco <= actual ? (hueco < propia && propia <= actual) : (hueco < propia || propia <= actual);
+        if (quedarse) continue;
+        indice[hueco] = indice[actual];
+        hueco = actual;
+    }
+    indice[hueco] = -1;
+}
+
+/**
+ * @brief Saca una ranura de la lista LRU.
+ */
+void CacheFactorizaciones::desenlazar(int ranura) {
+    Entrada& entrada = entradas[ranura];
+    if (entrada.anterior != -1) entradas[entrada.anterior].siguiente = entrada.siguiente; else primera = entrada.siguiente;
+    if (entrada.siguiente != -1) entradas[entrada.siguiente].anterior = entrada.anterior; else ultima = entrada.anterior;
+}
+
+/**
+ * @brief Coloca una ranura al frente de la lista LRU, como la más reciente.
+ */
+void CacheFactorizaciones::enlazarAlFrente(int ranura) {
+    entradas[ranura].anterior = -1;
+    entradas[ranura].siguiente = primera;
+    if (primera != -1) entradas[primera].anterior = ranura; else ultima = ranura;
+    primera = ranura;
+}
+
+/**
+ * @brief Saca una entrada de la lista LRU y del índice y devuelve su ranura a la lista de libres.
+ */
+void CacheFactorizaciones::descartar(int ranura) {
+    Entrada& entrada = entradas[ranura];
+    quitarDelIndice(buscar(entrada.hash));
+    desenlazar(ranura);
+    bytesUsados -= entrada.bytes;
+    entrada.factorizacion.reset();
+    entrada.siguiente = libre;
+    libre = ranura;
+    numEntradas--;
+}
+
+/**
+ * @brief Descarta las entradas menos recientes hasta que la memoria usada sea a lo más `limite`.
+ * Debe llamarse con el mutex tomado.
+ */
+void CacheFactorizaciones::liberarHasta(std::size_t limite) {
+    while (bytesUsados > limite && ultima != -1) descartar(ultima);
+}
+
+/**
+ * @brief Compara elemento por elemento dos matrices del mismo tamaño.
+ */
+static bool mismaMatriz(const Matrix& A, const Matrix& B) {
+    if (A.getRows() != B.getRows() || A.getCols() != B.getCols()) return false;
+    for (int i = 0; i < A.getRows(); i++) {
+        for (int j = 0; j < A.getCols(); j++) {
+            if (A.at(i, j) != B.at(i, j)) return false;
+        }
+    }
+    return true;
+}
+
+std::shared_ptr<FactorizacionLU> CacheFactorizaciones::obtener(const Matrix& A) {
+    std::uint64_t hash = hashMatriz(A);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        int posicion = buscar(hash);
+        if (posicion != -1) {
+            int ranura = indice[posicion];
+            if (mismaMatriz(entradas[ranura].factorizacion->getMatriz(), A)) {
+                desenlazar(ranura);
+                enlazarAlFrente(ranura);
+                aciertos++;
+                return entradas[ranura].factorizacion;
+            }
+        }
+        fallos++;
+    }
+
+    // La factorización O(n³) se hace fuera del mutex para no bloquear a los demás hilos
+    auto factorizacion = std::make_shared<FactorizacionLU>(A, 1, 0.0);
+    std::size_t bytes = bytesFactorizacion(A.getRows());
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (bytes > presupuestoBytes) {
+        return factorizacion;
+    }
+    int existente = buscar(hash);
+    if (existente != -1) {
+        // Otro hilo guardó la misma matriz mientras tanto, o hay una colisión: se reemplaza la entrada
+        descartar(indice[existente]);
+    }
+    liberarHasta(presupuestoBytes - bytes);
+    if (numEntradas == capacidad) descartar(ultima);
+
+    int ranura = libre;
+    libre = entradas[ranura].siguiente;
+    entradas[ranura].hash = hash;
+    entradas[ranura].factorizacion = factorizacion;
+    entradas[ranura].bytes = bytes;
+    enlazarAlFrente(ranura);
+    int posicion = static_cast<int>(hash & static_cast<std::uint64_t>(mascaraIndice));
+    while (indice[posicion] != -1) posicion = (posicion + 1) & mascaraIndice;
+    indice[posicion] = ranura;
+    numEntradas++;
+    bytesUsados += bytes;
+    return factorizacion;
+}
+
+Matrix CacheFactorizaciones::resolver(const Matrix& A, const Matrix& b) {
+    return obtener(A)->resolver(b);
+}
+
+void CacheFactorizaciones::setPresupuesto(std::size_t presupuesto) {
+    std::lock_guard<std::mutex> lock(mutex);
+    presupuestoBytes = presupuesto;
+    liberarHasta(presupuestoBytes);
+}
+
+void CacheFactorizaciones::limpiar() {
+    std::lock_guard<std::mutex> lock(mutex);
+    liberarHasta(0);
+}
+
+long long CacheFactorizaciones::getAciertos() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return aciertos;
+}
+
+long long CacheFactorizaciones::getFallos() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return fallos;
+}
+
+std::size_t CacheFactorizaciones::getBytesUsados() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return bytesUsados;
+}
+
+int CacheFactorizaciones::getNumEntradas() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return numEntradas;
+}
+
+CacheFactorizaciones& cacheGlobalFactorizaciones() {
+    static CacheFactorizaciones cache;
+    return cache;
+}
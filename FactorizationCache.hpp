@@ -0,0 +1,120 @@
+/**
+ * @file FactorizationCache.hpp
+ * @brief Declaración de la caché de factorizaciones LU indexada por el contenido de la matriz.
+ *
+ * Cuando el mismo sistema llega varias veces con distintos vectores b, la caché evita volver a factorizar:
+ * la matriz se identifica con un hash de sus dimensiones y contenido (O(n²)) y la solución se obtiene por
+ * sustitución con los factores guardados (O(n²)) en lugar de una eliminación completa (O(n³)).
+ */
+#ifndef FACTORIZATION_CACHE_HPP
+#define FACTORIZATION_CACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include "LU.hpp"
+#include "Matrix.hpp"
+
+/**
+ * @class CacheFactorizaciones
+ * @brief Caché LRU de objetos FactorizacionLU, segura para usarse desde varios hilos.
+ *
+ * El tamaño de la caché está acotado por un presupuesto de memoria en bytes y por un número fijo de entradas;
+ * al superar cualquiera de los dos se descartan las factorizaciones usadas hace más tiempo. Un acierto compara
+ * además la matriz guardada con la solicitada, por lo que una colisión del hash nunca produce una solución
+ * incorrecta. Con el mismo hash se guarda una sola entrada: una colisión reemplaza a la anterior.
+ *
+ * Las factorizaciones de la caché son compartidas: no deben recibir actualizaciones de rango bajo.
+ */
+class CacheFactorizaciones {
+    private:
+        struct Entrada {
+            std::uint64_t hash;
+            std::shared_ptr<FactorizacionLU> factorizacion;
+            std::size_t bytes;
+            int anterior;   // Vecinos en la lista LRU, o en la lista de ranuras libres (solo `siguiente`). //
+            int siguiente;
+        };
+
+        std::size_t presupuestoBytes;
+        std::size_t bytesUsados;
+        long long aciertos;
+        long long fallos;
+        int capacidad;
+        int numEntradas;
+        std::unique_ptr<Entrada[]> entradas;  // `capacidad` ranuras. //
+        int primera;                          // Ranura más reciente, o -1 si la caché está vacía. //
+        int ultima;                           // Ranura menos reciente. //
+        int libre;                            // Primera ranura libre, o -1. //
+        int mascaraIndice;
+        std::unique_ptr<int[]> indice;        // Direccionamiento abierto por el hash: ranura, o -1 si está vacía. //
+        mutable std::mutex mutex;
+
+        static std::size_t bytesFactorizacion(int n);
+        int buscar(std::uint64_t hash) const;
+        void quitarDelIndice(int posicion);
+        void desenlazar(int ranura);
+        void enlazarAlFrente(int ranura);
+        void descartar(int ranura);
+        void liberarHasta(std::size_t limite);
+    public:
+        /**
+        * @brief Crea una caché vacía.
+        * @param presupuesto Memoria máxima, en bytes, que pueden ocupar las factorizaciones guardadas.
+        * @param maximoEntradas Número máximo de factorizaciones guardadas a la vez.
+        *
+        * @throws std::invalid_argument Si el número máximo de entradas no es positivo.
+        */
+        explicit CacheFactorizaciones(std::size_t presupuesto = 256u * 1024u * 1024u, int maximoEntradas = 64);
+
+        /**
+        * @brief Calcula el hash de las dimensiones y el contenido de una matriz en O(filas·columnas).
+        */
+        static std::uint64_t hashMatriz(const Matrix& A);
+
+        /**
+        * @brief Devuelve la factorización de A, tomándola de la caché o factorizando y guardándola.
+        *
+        * Si la factorización no cabe en el presupuesto se devuelve sin guardarla.
+        *
+        * @param A Matriz cuadrada de coeficientes (no se modifica).
+        * @return std::shared_ptr<FactorizacionLU> Factorización de A.
+        *
+        * @throws std::runtime_error Si A es singular.
+        */
+        std::shared_ptr<FactorizacionLU> obtener(const Matrix& A);
+
+        /**
+        * @brief Resuelve A·x = b usando la factorización en caché de A.
+        *
+        * @param A Matriz cuadrada de coeficientes (no se modifica).
+        * @param b Vector columna de términos independientes (no se modifica).
+        * @return Matrix Vector solución del sistema.
+        *
+        * @throws std::runtime_error Si A es singular.
+        */
+        Matrix resolver(const Matrix& A, const Matrix& b);
+
+        /**
+        * @brief Cambia el presupuesto de memoria, descartando entradas si es necesario.
+        */
+        void setPresupuesto(std::size_t presupuesto);
+
+        /**
+        * @brief Descarta todas las factorizaciones guardadas (los contadores se conservan).
+        */
+        void limpiar();
+
+        long long getAciertos() const;     ///< Número de solicitudes atendidas desde la caché.
+        long long getFallos() const;       ///< Número de solicitudes que requirieron factorizar.
+        std::size_t getBytesUsados() const; ///< Memoria ocupada por las factorizaciones guardadas.
+        int getNumEntradas() const;        ///< Número de factorizaciones guardadas.
+};
+
+/**
+ * @brief Caché de factorizaciones compartida por los métodos que reciben `usarCache = true`.
+ */
+CacheFactorizaciones& cacheGlobalFactorizaciones();
+
+#endif
@@ -0,0 +1,354 @@
+/**
+ * @file FixedMatrix.hpp
+ * @brief Declaración e implementación de la plantilla FixedMatrix para matrices de tamaño fijo en tiempo de compilación.
+ *
+ * Proporciona una matriz con almacenamiento en la pila y dimensiones `constexpr`, pensada para resolver
+ * grandes cantidades de sistemas pequeños (de 2x2 a 8x8 aproximadamente) sin asignaciones dinámicas.
+ * Incluye versiones de los métodos de Gauss, Gauss-Jordan y Cholesky cuyos ciclos se desenrollan por completo
+ * en tiempo de compilación, así como conversiones desde y hacia la clase Matrix.
+ *
+ * Al ser una plantilla, toda la implementación vive en este archivo.
+ */
+#ifndef FIXED_MATRIX_HPP
+#define FIXED_MATRIX_HPP
+
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "Matrix.hpp"
+
+namespace detalle {
+
+    /**
+     * @brief Implementación de `desenrollar`: invoca `f` una vez por cada índice de la secuencia.
+     */
+    template <typename F, int... I>
+    inline void desenrollarImpl(F&& f, std::integer_sequence<int, I...>) {
+        (f(std::integral_constant<int, I>{}), ...);
+    }
+
+    /**
+     * @brief Ejecuta `f(0), f(1), ..., f(N-1)` con índices constantes en tiempo de compilación.
+     *
+     * Sustituye a un ciclo `for` de `N` vueltas: cada índice llega como `std::integral_constant`, por lo que
+     * el compilador genera el cuerpo `N` veces sin contador ni saltos. Con `N <= 0` no hace nada.
+     *
+     * @tparam N Número de repeticiones.
+     * @param f Función que recibe el índice como `std::integral_constant<int, i>`.
+     */
+    template <int N, typename F>
+    inline void desenrollar(F&& f) {
+        if constexpr (N > 0) {
+            desenrollarImpl(f, std::make_integer_sequence<int, N>{});
+        }
+    }
+}
+
+/**
+ * @class FixedMatrix
+ * @brief Matriz de dimensiones fijas `N` x `M` con almacenamiento en la pila.
+ *
+ * A diferencia de Matrix, no realiza ninguna asignación dinámica y sus dimensiones son constantes
+ * en tiempo de compilación. El acceso con `at` verifica límites igual que Matrix, mientras que
+ * `operator()` omite la verificación para usarse en los ciclos internos de los métodos.
+ *
+ * @tparam N Número de filas.
+ * @tparam M Número de columnas.
+ */
+template <int N, int M>
+class FixedMatrix {
+    static_assert(N > 0 && M > 0, "FixedMatrix requiere dimensiones positivas.");
+    private:
+        double matriz[N][M]; // Almacén de datos contiguo en la pila. //
+    public:
+        /**
+        * @brief Constructor por defecto, inicializa todos los elementos en cero.
+        */
+        FixedMatrix() : matriz{} {}
+
+        /**
+        * @brief Construye la matriz copiando los valores de una Matrix con las mismas dimensiones.
+        *
+        * @param origen Matriz dinámica de la que se copian los valores.
+        *
+        * @throws std::invalid_argument Si las dimensiones de `origen` no coinciden con `N` x `M`.
+        */
+        explicit FixedMatrix(const Matrix& origen) : matriz{} {
+            if (origen.getRows() != N || origen.getCols() != M) {
+                throw std::invalid_argument("Las dimensiones de la matriz no coinciden con las de FixedMatrix.");
+            }
+            for (int i = 0; i < N; i++) {
+                for (int j = 0; j < M; j++) {
+                    matriz[i][j] = origen.at(i, j);
+                }
+            }
+        }
+
+        /**
+        * @brief Devuelve el número de filas de la matriz.
+        * @return Número de filas
+        */
+        static constexpr int getRows() { return N; }
+
+        /**
+        * @brief Devuelve el número de columnas de la matriz.
+        * @return Número de columnas
+        */
+        static constexpr int getCols() { return M; }
+
+        /**
+        * @brief Acceso seguro a un elemento de la matriz con verificación de límites.
+        *
+        * @param row Índice de fila (0 <= row < N).
+        * @param col Índice de columna (0 <= col < M).
+        * @return double& Referencia al elemento solicitado.
+        *
+        * @throws std::out_of_range Si los índices están fuera de rango.
+        */
+        double& at(int row, int col) {
+            if (row < 0 || row >= N || col < 0 || col >= M) {
+                throw std::out_of_range("Índices fuera de rango");
+            }
+            return matriz[row][col];
+        }
+
+        /**
+        * @brief Acceso seguro a un elemento de la matriz (versión const).
+        */
+        const double& at(int row, int col) const {
+            if (row < 0 || row >= N || col < 0 || col >= M) {
+                throw std::out_of_range("Índices fuera de rango");
+            }
+            return matriz[row][col];
+        }
+
+        /**
+        * @brief Acceso sin verificación de límites, reservado para los ciclos internos de los métodos.
+        */
+        double& operator()(int row, int col) noexcept { return matriz[row][col]; }
+
+        /**
+        * @brief Acceso sin verificación de límites (versión const).
+        */
+        const double& operator()(int row, int col) const noexcept { return matriz[row][col]; }
+
+        /**
+        * @brief Copia el contenido en una nueva Matrix dinámica.
+        * @return Matrix Matriz de `N` x `M` con los mismos valores.
+        */
+        Matrix toMatrix() const {
+            Matrix resultado(N, M);
+            for (int i = 0; i < N; i++) {
+                for (int j = 0; j < M; j++) {
+                    resultado.at(i, j) = matriz[i][j];
+                }
+            }
+            return resultado;
+        }
+
+        /**
+        * @brief Imprime la matriz en la consola con el mismo formato que Matrix::print.
+        */
+        void print() const {
+            for (int i = 0; i < N; i++) {
+                for (int j = 0; j < M; j++) {
+                    std::cout << std::setw(10) << matriz[i][j] << " ";
+                }
+                std::cout << '\n';
+            }
+        }
+};
+
+namespace detalle {
+
+    /**
+     * @brief Eliminación hacia adelante con pivoteo parcial, desenrollada para tamaño fijo.
+     *
+     * Equivalente a forwardElimination para FixedMatrix, sin impresión de pasos.
+     *
+     * @throws std::runtime_error Si algún pivote es menor a la tolerancia.
+     */
+    template <int N>
+    inline void eliminacionAdelanteFija(FixedMatrix<N, N>& A, FixedMatrix<N, 1>& b) {
+        constexpr double TOLERANCIA = 1e-12;
+        desenrollar<N>([&](auto kc) {
+            constexpr int k = decltype(kc)::value;
+
+            // 1. Buscar la fila con el mayor pivote
+            int maxRow = k;
+            double maxVal = std::abs(A(k, k));
+            desenrollar<N - k - 1>([&](auto ic) {
+                constexpr int i = k + 1 + decltype(ic)::value;
+                double valor = std::abs(A(i, k));
+                if (valor > maxVal) {
+                    maxVal = valor;
+                    maxRow = i;
+                }
+            });
+
+            // 2. Verificar si hay solución
+            if (maxVal < TOLERANCIA) {
+                throw std::runtime_error("El sistema es numéricamente inestable o no tiene solución única.");
+            }
+
+            // 3. Intercambiar filas (solo la parte viva, a la izquierda ya hay ceros)
+            if (maxRow != k) {
+                desenrollar<N - k>([&](auto jc) {
+                    constexpr int j = k + decltype(jc)::value;
+                    std::swap(A(k, j), A(maxRow, j));
+                });
+                std::swap(b(k, 0), b(maxRow, 0));
+            }
+
+            // 4. Eliminar hacia abajo
+            const double inversoPivote = 1.0 / A(k, k);
+            desenrollar<N - k - 1>([&](auto ic) {
+                constexpr int i = k + 1 + decltype(ic)::value;
+                const double factor = A(i, k) * inversoPivote;
+                A(i, k) = 0.0;
+                desenrollar<N - k - 1>([&](auto jc) {
+                    constexpr int j = k + 1 + decltype(jc)::value;
+                    A(i, j) -= factor * A(k, j);
+                });
+                b(i, 0) -= factor * b(k, 0);
+            });
+        });
+    }
+}
+
+/**
+ * @brief Resuelve un sistema de tamaño fijo mediante eliminación de Gauss con pivoteo parcial.
+ *
+ * Versión de gaussElimination para FixedMatrix: todos los ciclos se desenrollan en tiempo de compilación
+ * y no se realiza ninguna asignación dinámica. Tanto A como b se modifican en el proceso.
+ *
+ * @param A Matriz cuadrada de coeficientes (modificada durante la ejecución).
+ * @param b Vector columna de términos independientes (modificado durante la ejecución).
+ * @return FixedMatrix<N, 1> Vector solución del sistema.
+ *
+ * @throw std::runtime_error Si el sistema no tiene solución única o puede estar mal condicionado.
+ */
+template <int N>
+FixedMatrix<N, 1> gaussElimination(FixedMatrix<N, N>& A, FixedMatrix<N, 1>& b) {
+    detalle::eliminacionAdelanteFija(A, b);
+
+    // Sustitución regresiva
+    FixedMatrix<N, 1> vectorSolucion;
+    detalle::desenrollar<N>([&](auto rc) {
+        constexpr int row = N - 1 - decltype(rc)::value;
+        double sum {0.0};
+        detalle::desenrollar<N - row - 1>([&](auto cc) {
+            constexpr int col = row + 1 + decltype(cc)::value;
+            sum += A(row, col) * vectorSolucion(col, 0);
+        });
+        vectorSolucion(row, 0) = (b(row, 0) - sum) / A(row, row);
+    });
+    return vectorSolucion;
+}
+
+/**
+ * @brief Resuelve un sistema de tamaño fijo mediante el método de Gauss-Jordan.
+ *
+ * Tras la eliminación hacia adelante, elimina hacia arriba únicamente la columna del pivote y el vector b
+ * (el resto de la fila del pivote ya es cero), por lo que A termina convertida en la identidad.
+ *
+ * @param A Matriz cuadrada de coeficientes (modificada durante la ejecución).
+ * @param b Vector columna de términos independientes (modificado durante la ejecución).
+ * @return FixedMatrix<N, 1> Vector solución del sistema.
+ *
+ * @throw std::runtime_error Si el sistema no tiene solución única o puede estar mal condicionado.
+ */
+template <int N>
+FixedMatrix<N, 1> gaussJordanElimination(FixedMatrix<N, N>& A, FixedMatrix<N, 1>& b) {
+    detalle::eliminacionAdelanteFija(A, b);
+
+    detalle::desenrollar<N>([&](auto cc) {
+        constexpr int column = N - 1 - decltype(cc)::value;
+        b(column, 0) /= A(column, column);
+        A(column, column) = 1.0;
+        detalle::desenrollar<column>([&](auto rc) {
+            constexpr int row = decltype(rc)::value;
+            b(row, 0) -= A(row, column) * b(column, 0);
+            A(row, column) = 0.0;
+        });
+    });
+
+    FixedMatrix<N, 1> vectorSolucion;
+    detalle::desenrollar<N>([&](auto ic) {
+        constexpr int i = decltype(ic)::value;
+        vectorSolucion(i, 0) = b(i, 0);
+    });
+    return vectorSolucion;
+}
+
+/**
+ * @brief Resuelve un sistema simétrico definido positivo de tamaño fijo mediante la factorización de Cholesky.
+ *
+ * Factoriza A = L·Lᵀ sobre la parte triangular inferior de A (que queda sobrescrita con L) y resuelve
+ * los dos sistemas triangulares resultantes. Solo se lee la parte inferior de A, por lo que no se verifica
+ * la simetría. Requiere aproximadamente la mitad de operaciones que la eliminación de Gauss.
+ *
+ * @param A Matriz simétrica definida positiva (su parte inferior se sobrescribe con el factor L).
+ * @param b Vector columna de términos independientes (no se modifica).
+ * @return FixedMatrix<N, 1> Vector solución del sistema.
+ *
+ * @throw std::runtime_error Si la matriz no es definida positiva.
+ */
+template <int N>
+FixedMatrix<N, 1> choleskyMethod(FixedMatrix<N, N>& A, const FixedMatrix<N, 1>& b) {
+    constexpr double TOLERANCIA = 1e-12;
+
+    // Factorización A = L·Lᵀ columna por columna
+    detalle::desenrollar<N>([&](auto jc) {
+        constexpr int j = decltype(jc)::value;
+        double diagonal = A(j, j);
+        detalle::desenrollar<j>([&](auto kc) {
+            constexpr int k = decltype(kc)::value;
+            diagonal -= A(j, k) * A(j, k);
+        });
+        if (diagonal < TOLERANCIA) {
+            throw std::runtime_error("La matriz no es definida positiva; no se puede aplicar Cholesky.");
+        }
+        const double ljj = std::sqrt(diagonal);
+        A(j, j) = ljj;
+        detalle::desenrollar<N - j - 1>([&](auto ic) {
+            constexpr int i = j + 1 + decltype(ic)::value;
+            double suma = A(i, j);
+            detalle::desenrollar<j>([&](auto kc) {
+                constexpr int k = decltype(kc)::value;
+                suma -= A(i, k) * A(j, k);
+            });
+            A(i, j) = suma / ljj;
+        });
+    });
+
+    // Sustitución progresiva L·y = b
+    FixedMatrix<N, 1> y;
+    detalle::desenrollar<N>([&](auto ic) {
+        constexpr int i = decltype(ic)::value;
+        double suma = b(i, 0);
+        detalle::desenrollar<i>([&](auto kc) {
+            constexpr int k = decltype(kc)::value;
+            suma -= A(i, k) * y(k, 0);
+        });
+        y(i, 0) = suma / A(i, i);
+    });
+
+    // Sustitución regresiva Lᵀ·x = y
+    FixedMatrix<N, 1> vectorSolucion;
+    detalle::desenrollar<N>([&](auto ic) {
+        constexpr int i = N - 1 - decltype(ic)::value;
+        double suma = y(i, 0);
+        detalle::desenrollar<N - i - 1>([&](auto kc) {
+            constexpr int k = i + 1 + decltype(kc)::value;
+            suma -= A(k, i) * vectorSolucion(k, 0);
+        });
+        vectorSolucion(i, 0) = suma / A(i, i);
+    });
+    return vectorSolucion;
+}
+
+#endif
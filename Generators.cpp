@@ -0,0 +1,464 @@
+/**
+ * @file Generators.cpp
+ * @brief Implementación de los generadores de problemas de prueba.
+ *
+ * @section features_sec Características principales
+ * -Laplacianos de 1, 2 y 3 dimensiones construidos directamente en CSR, sin pasar por tripletes.
+ * -Matrices aleatorias reproducibles (std::mt19937_64) con diagonal dominante, simétricas definidas positivas o de banda.
+ * -Matrices de Hilbert y con número de condición prescrito para probar la estabilidad numérica.
+ * -Sistemas con solución exacta conocida.
+ */
+#include "Generators.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <memory>
+#include <stdexcept>
+#include "String.hpp"
+
+namespace {
+
+/**
+ * @brief Dimensión de la malla: número de ejes a partir del último con más de un punto.
+ */
+int dimensionMalla(int ny, int nz) {
+    return nz > 1 ? 3 : (ny > 1 ? 2 : 1);
+}
+
+void verificarMalla(int nx, int ny, int nz) {
+    if (nx <= 0 || ny <= 0 || nz <= 0) {
+        throw std::invalid_argument("Las dimensiones de la malla deben ser positivas.");
+    }
+    if (static_cast<long long>(nx) * ny * nz > std::numeric_limits<int>::max() / 7) {
+        throw std::invalid_argument("La malla es demasiado grande para los índices de la matriz dispersa.");
+    }
+}
+
+/**
+ * @brief Laplaciano de 2·d+1 puntos construido fila por fila con las columnas ya ordenadas.
+ */
+SparseMatrix laplaciano(int nx, int ny, int nz) {
+    verificarMalla(nx, ny, nz);
+    int n = nx * ny * nz;
+    int plano = nx * ny;
+    double centro = 2.0 * dimensionMalla(ny, nz);
+
+    // Cada eje aporta dos vecinos por punto menos los que caen fuera de la malla
+    long long noCeros = n;
+    noCeros += 2LL * (nx - 1) * ny * nz;
+    noCeros += 2LL * nx * (ny - 1) * nz;
+    noCeros += 2LL * nx * ny * (nz - 1);
+
+    SparseMatrix A(n, n, static_cast<int>(noCeros));
+    int* inicio = A.datosInicioFila();
+    int* columnas = A.datosColumnas();
+    double* valores = A.datosValores();
+    int k = 0;
+    for (int z = 0; z < nz; z++) {
+        for (int y = 0; y < ny; y++) {
+            for (int x = 0; x < nx; x++) {
+                int i = (z * ny + y) * nx + x;
+                inicio[i] = k;
+                if (z > 0) { columnas[k] = i - plano; valores[k++] = -1.0; }
+                if (y > 0) { columnas[k] = i - nx; valores[k++] = -1.0; }
+                if (x > 0) { columnas[k] = i - 1; valores[k++] = -1.0; }
+                columnas[k] = i; valores[k++] = centro;
+                if (x < nx - 1) { columnas[k] = i + 1; valores[k++] = -1.0; }
+                if (y < ny - 1) { columnas[k] = i + nx; valores[k++] = -1.0; }
+                if (z < nz - 1) { columnas[k] = i + plano; valores[k++] = -1.0; }
+            }
+        }
+    }
+    inicio[n] = k;
+    return A;
+}
+
+/**
+ * @brief Elige `cantidad` columnas distintas al azar en [0, limite) sin incluir `excluida`, ordenadas.
+ *
+ * @param elegidas Arreglo de al menos `cantidad` elementos que recibe las columnas.
+ * @return Número de columnas elegidas (menor que `cantidad` si no hay tantas disponibles).
+ */
+int elegirColumnas(int limite, int excluida, int cantidad, std::mt19937_64& generador, int* elegidas) {
+    int disponibles = limite - (excluida >= 0 && excluida < limite ? 1 : 0);
+    cantidad = std::min(cantidad, disponibles);
+    if (2 * cantidad > disponibles) {
+        // Muchas columnas: barajar todas las candidatas y tomar las primeras
+        std::unique_ptr<int[]> candidatas = std::make_unique<int[]>(disponibles);
+        int numCandidatas = 0;
+        for (int j = 0; j < limite; j++) {
+            if (j != excluida) candidatas[numCandidatas++] = j;
+        }
+        for (int p = 0; p < cantidad; p++) {
+            std::uniform_int_distribution<int> posicion(p, disponibles - 1);
+            std::swap(candidatas[p], candidatas[posicion(generador)]);
+        }
+        std::copy(candidatas.get(), candidatas.get() + cantidad, elegidas);
+    } else {
+        // Pocas columnas: muestreo con rechazo de las repetidas
+        std::uniform_int_distribution<int> columna(0, limite - 1);
+        int numElegidas = 0;
+        while (numElegidas < cantidad) {
+            int j = columna(generador);
+            if (j != excluida && std::find(elegidas, elegidas + numElegidas, j) == elegidas + numElegidas) {
+                elegidas[numElegidas++] = j;
+            }
+        }
+    }
+    std::sort(elegidas, elegidas + cantidad);
+    return cantidad;
+}
+
+void verificarTamano(int n) {
+    if (n <= 0) {
+        throw std::invalid_argument("El tamaño del sistema debe ser positivo.");
+    }
+}
+
+/**
+ * @brief Mayor lado cuya potencia `dimension` no excede n (al menos 1).
+ */
+int ladoMalla(int n, int dimension) {
+    int lado = std::max(1, static_cast<int>(std::pow(static_cast<double>(n), 1.0 / dimension)));
+    auto potencia = [dimension](long long l) {
+        long long p = 1;
+        for (int d = 0; d < dimension; d++) p *= l;
+        return p;
+    };
+    while (lado > 1 && potencia(lado) > n) lado--;
+    while (potencia(lado + 1) <= n) lado++;
+    return lado;
+}
+
+} // namespace
+
+OperadorPoisson::OperadorPoisson(int nx, int ny, int nz) : nx(nx), ny(ny), nz(nz), dimension(dimensionMalla(ny, nz)) {
+    verificarMalla(nx, ny, nz);
+}
+
+int OperadorPoisson::getSize() const {
+    return nx * ny * nz;
+}
+
+void OperadorPoisson::aplicar(const double* x, double* y) const {
+    double centro = 2.0 * dimension;
+    int plano = nx * ny;
+    for (int k = 0; k < nz; k++) {
+        for (int j = 0; j < ny; j++) {
+            int base = (k * ny + j) * nx;
+            const double* actual = x + base;
+            double* salida = y + base;
+            for (int c = 0; c < nx; c++) {
+                double suma = centro * actual[c];
+                if (c > 0) suma -= actual[c - 1];
+                if (c < nx - 1) suma -= actual[c + 1];
+                salida[c] = suma;
+            }
+            if (j > 0) {
+                for (int c = 0; c < nx; c++) salida[c] -= actual[c - nx];
+            }
+            if (j < ny - 1) {
+                for (int c = 0; c < nx; c++) salida[c] -= actual[c + nx];
+            }
+            if (k > 0) {
+                for (int c = 0; c < nx; c++) salida[c] -= actual[c - plano];
+            }
+            if (k < nz - 1) {
+                for (int c = 0; c < nx; c++) salida[c] -= actual[c + plano];
+            }
+        }
+    }
+}
+
+void OperadorPoisson::diagonal(double* d) const {
+    int n = nx * ny * nz;
+    for (int i = 0; i < n; i++) d[i] = 2.0 * dimension;
+}
+
+bool OperadorPoisson::tieneFilas() const {
+    return true;
+}
+
+double OperadorPoisson::sumaFueraDiagonal(int i, const double* x) const {
+    int plano = nx * ny;
+    int c = i % nx;
+    int j = (i / nx) % ny;
+    int k = i / plano;
+    double suma = 0.0;
+    if (c > 0) suma -= x[i - 1];
+    if (c < nx - 1) suma -= x[i + 1];
+    if (j > 0) suma -= x[i - nx];
+    if (j < ny - 1) suma -= x[i + nx];
+    if (k > 0) suma -= x[i - plano];
+    if (k < nz - 1) suma -= x[i + plano];
+    return suma;
+}
+
+double OperadorPoisson::operacionesProducto() const {
+    // Un producto por la diagonal y una resta por cada uno de los 2·dimensión vecinos
+    return (2.0 * dimension + 1.0) * nx * ny * nz;
+}
+
+SparseMatrix poisson1D(int n) {
+    return laplaciano(n, 1, 1);
+}
+
+SparseMatrix poisson2D(int nx, int ny) {
+    return laplaciano(nx, ny, 1);
+}
+
+SparseMatrix poisson3D(int nx, int ny, int nz) {
+    return laplaciano(nx, ny, nz);
+}
+
+SparseMatrix matrizDiagonalDominante(int n, int noCerosPorFila, std::uint64_t semilla) {
+    verificarTamano(n);
+    if (noCerosPorFila < 0) {
+        throw std::invalid_argument("El número de elementos por fila no puede ser negativo.");
+    }
+    int porFila = std::min(noCerosPorFila, n - 1);
+    SparseMatrix A(n, n, n * (porFila + 1));
+    int* inicio = A.datosInicioFila();
+    int* columnas = A.datosColumnas();
+    double* valores = A.datosValores();
+
+    std::mt19937_64 generador(semilla);
+    std::uniform_real_distribution<double> valor(-1.0, 1.0);
+    std::unique_ptr<int[]> elegidas = std::make_unique<int[]>(porFila);
+    int k = 0;
+    for (int i = 0; i < n; i++) {
+        inicio[i] = k;
+        int numElegidas = elegirColumnas(n, i, porFila, generador, elegidas.get());
+        double sumaAbs = 0.0;
+        int posDiagonal = -1;
+        for (int t = 0; t < numElegidas; t++) {
+            int j = elegidas[t];
+            if (posDiagonal < 0 && j > i) posDiagonal = k++;
+            double v = valor(generador);
+            columnas[k] = j;
+            valores[k++] = v;
+            sumaAbs += std::abs(v);
+        }
+        if (posDiagonal < 0) posDiagonal = k++;
+        columnas[posDiagonal] = i;
+        valores[posDiagonal] = sumaAbs + 1.0;
+    }
+    inicio[n] = k;
+    return A;
+}
+
+SparseMatrix matrizSimetricaDefinidaPositiva(int n, int noCerosPorFila, std::uint64_t semilla) {
+    verificarTamano(n);
+    if (noCerosPorFila < 0) {
+        throw std::invalid_argument("El número de elementos por fila no puede ser negativo.");
+    }
+    std::mt19937_64 generador(semilla);
+    std::uniform_real_distribution<double> valor(-1.0, 1.0);
+    // La fila i elige min(noCerosPorFila, i) columnas anteriores; cada una da dos tripletes, más la diagonal
+    long long cantidad = n;
+    for (int i = 1; i < n; i++) cantidad += 2LL * std::min(noCerosPorFila, i);
+    if (cantidad > std::numeric_limits<int>::max()) {
+        throw std::invalid_argument("Demasiados elementos por fila para los índices de la matriz dispersa.");
+    }
+    std::unique_ptr<int[]> filas = std::make_unique<int[]>(cantidad);
+    std::unique_ptr<int[]> cols = std::make_unique<int[]>(cantidad);
+    std::unique_ptr<double[]> vals = std::make_unique<double[]>(cantidad);
+    std::unique_ptr<int[]> elegidas = std::make_unique<int[]>(std::min(noCerosPorFila, n));
+    std::unique_ptr<double[]> sumaAbs = std::make_unique<double[]>(n);
+    int k = 0;
+    for (int i = 1; i < n; i++) {
+        int numElegidas = elegirColumnas(i, -1, noCerosPorFila, generador, elegidas.get());
+        for (int t = 0; t < numElegidas; t++) {
+            int j = elegidas[t];
+            double v = valor(generador);
+            filas[k] = i; cols[k] = j; vals[k++] = v;
+            filas[k] = j; cols[k] = i; vals[k++] = v;
+            sumaAbs[i] += std::abs(v);
+            sumaAbs[j] += std::abs(v);
+        }
+    }
+    for (int i = 0; i < n; i++) {
+        filas[k] = i; cols[k] = i; vals[k++] = sumaAbs[i] + 1.0;
+    }
+    return SparseMatrix::desdeTripletes(n, n, k, filas.get(), cols.get(), vals.get());
+}
+
+SparseMatrix matrizBanda(int n, int anchoInferior, int anchoSuperior, std::uint64_t semilla) {
+    verificarTamano(n);
+    if (anchoInferior < 0 || anchoSuperior < 0) {
+        throw std::invalid_argument("Los anchos de banda no pueden ser negativos.");
+    }
+    anchoInferior = std::min(anchoInferior, n - 1);
+    anchoSuperior = std::min(anchoSuperior, n - 1);
+    long long noCeros = 0;
+    for (int i = 0; i < n; i++) {
+        noCeros += std::min(n - 1, i + anchoSuperior) - std::max(0, i - anchoInferior) + 1;
+    }
+    if (noCeros > std::numeric_limits<int>::max()) {
+        throw std::invalid_argument("La banda es demasiado ancha para los índices de la matriz dispersa.");
+    }
+    SparseMatrix A(n, n, static_cast<int>(noCeros));
+    int* inicio = A.datosInicioFila();
+    int* columnas = A.datosColumnas();
+    double* valores = A.datosValores();
+
+    std::mt19937_64 generador(semilla);
+    std::uniform_real_distribution<double> valor(-1.0, 1.0);
+    int k = 0;
+    for (int i = 0; i < n; i++) {
+        inicio[i] = k;
+        int posDiagonal = 0;
+        double sumaAbs = 0.0;
+        for (int j = std::max(0, i - anchoInferior); j <= std::min(n - 1, i + anchoSuperior); j++) {
+            columnas[k] = j;
+            if (j == i) {
+                posDiagonal = k++;
+                continue;
+            }
+            valores[k] = valor(generador);
+            sumaAbs += std::abs(valores[k++]);
+        }
+        valores[posDiagonal] = sumaAbs + 1.0;
+    }
+    inicio[n] = k;
+    return A;
+}
+
+Matrix matrizHilbert(int n) {
+    verificarTamano(n);
+    Matrix H(n, n);
+    for (int i = 0; i < n; i++) {
+        double* fila = &H.at(i, 0);
+        for (int j = 0; j < n; j++) fila[j] = 1.0 / (i + j + 1);
+    }
+    return H;
+}
+
+Matrix matrizMalCondicionada(int n, double numeroCondicion, std::uint64_t semilla) {
+    verificarTamano(n);
+    if (!(numeroCondicion >= 1.0)) {
+        throw std::invalid_argument("El número de condición debe ser al menos 1.");
+    }
+    // Valores propios d_k = κ^(-k/(n-1)) y reflexión de Householder con v unitario aleatorio
+    std::unique_ptr<double[]> d = std::make_unique<double[]>(n);
+    std::unique_ptr<double[]> v = std::make_unique<double[]>(n);
+    for (int k = 0; k < n; k++) {
+        d[k] = n > 1 ? std::pow(numeroCondicion, -static_cast<double>(k) / (n - 1)) : 1.0;
+    }
+    std::mt19937_64 generador(semilla);
+    std::uniform_real_distribution<double> valor(-1.0, 1.0);
+    double norma = 0.0;
+    for (int k = 0; k < n; k++) {
+        v[k] = valor(generador);
+        norma += v[k] * v[k];
+    }
+    norma = std::sqrt(norma);
+    double s = 0.0;
+    for (int k = 0; k < n; k++) {
+        v[k] = norma > 0.0 ? v[k] / norma : (k == 0 ? 1.0 : 0.0);
+        s += d[k] * v[k] * v[k];
+    }
+
+    // (I - 2vvᵀ)·D·(I - 2vvᵀ) = D - 2·v·(Dv)ᵀ - 2·(Dv)·vᵀ + 4·s·v·vᵀ, con s = vᵀDv
+    Matrix A(n, n);
+    for (int i = 0; i < n; i++) {
+        double* fila = &A.at(i, 0);
+        for (int j = 0; j < n; j++) {
+            fila[j] = -2.0 * v[i] * d[j] * v[j] - 2.0 * d[i] * v[i] * v[j] + 4.0 * s * v[i] * v[j];
+        }
+        fila[i] += d[i];
+    }
+    return A;
+}
+
+Matrix vectorAleatorio(int n, std::uint64_t semilla) {
+    verificarTamano(n);
+    std::mt19937_64 generador(semilla);
+    std::uniform_real_distribution<double> valor(-1.0, 1.0);
+    Matrix x(n, 1);
+    for (int i = 0; i < n; i++) x.at(i, 0) = valor(generador);
+    return x;
+}
+
+Matrix terminoIndependiente(const OperadorLineal& A, const Matrix& x) {
+    int n = A.getSize();
+    if (x.getRows() != n || x.getCols() != 1) {
+        throw std::invalid_argument("La solución debe ser un vector columna del tamaño del operador.");
+    }
+    std::unique_ptr<double[]> entrada = std::make_unique<double[]>(n);
+    std::unique_ptr<double[]> salida = std::make_unique<double[]>(n);
+    for (int i = 0; i < n; i++) entrada[i] = x.at(i, 0);
+    A.aplicar(entrada.get(), salida.get());
+    Matrix b(n, 1);
+    for (int i = 0; i < n; i++) b.at(i, 0) = salida[i];
+    return b;
+}
+
+ProblemaPrueba generarProblema(TipoProblema tipo, int incognitas, std::uint64_t semilla) {
+    verificarTamano(incognitas);
+    const int NO_CEROS_POR_FILA = 5;
+    const int ANCHO_BANDA = 2;
+    const double CONDICION = 1e8;
+    // Las familias densas se forman completas antes de pasarlas a CSR: n² elementos en ambas representaciones
+    const int MAXIMO_DENSO = 2000;
+    if ((tipo == TipoProblema::Hilbert || tipo == TipoProblema::MalCondicionada) && incognitas > MAXIMO_DENSO) {
+        String limite; limite.fromInt(MAXIMO_DENSO);
+        String msg = String("Los problemas densos admiten a lo más ") + limite + String(" incógnitas.");
+        throw std::invalid_argument(msg.c_str());
+    }
+
+    SparseMatrix A;
+    bool simetrica = true;
+    switch (tipo) {
+    case TipoProblema::Poisson1D:
+        A = poisson1D(incognitas);
+        break;
+    case TipoProblema::Poisson2D: {
+        int lado = ladoMalla(incognitas, 2);
+        A = poisson2D(lado, lado);
+        break;
+    }
+    case TipoProblema::Poisson3D: {
+        int lado = ladoMalla(incognitas, 3);
+        A = poisson3D(lado, lado, lado);
+        break;
+    }
+    case TipoProblema::DiagonalDominante:
+        A = matrizDiagonalDominante(incognitas, NO_CEROS_POR_FILA, semilla);
+        simetrica = false;
+        break;
+    case TipoProblema::SimetricaDefinidaPositiva:
+        A = matrizSimetricaDefinidaPositiva(incognitas, NO_CEROS_POR_FILA, semilla);
+        break;
+    case TipoProblema::Banda:
+        A = matrizBanda(incognitas, ANCHO_BANDA, ANCHO_BANDA, semilla);
+        simetrica = false;
+        break;
+    case TipoProblema::Hilbert:
+        A = SparseMatrix(matrizHilbert(incognitas));
+        break;
+    case TipoProblema::MalCondicionada:
+        A = SparseMatrix(matrizMalCondicionada(incognitas, CONDICION, semilla));
+        break;
+    }
+
+    // La solución usa una semilla derivada para no repetir la secuencia de la matriz
+    Matrix solucion = vectorAleatorio(A.getRows(), semilla ^ 0x9E3779B97F4A7C15ULL);
+    Matrix b = A.multiplicar(solucion);
+    return ProblemaPrueba{tipo, std::move(A), std::move(b), std::move(solucion), simetrica};
+}
+
+const char* nombreProblema(TipoProblema tipo) {
+    switch (tipo) {
+    case TipoProblema::Poisson1D: return "Poisson 1D";
+    case TipoProblema::Poisson2D: return "Poisson 2D";
+    case TipoProblema::Poisson3D: return "Poisson 3D";
+    case TipoProblema::DiagonalDominante: return "Diagonal dominante aleatoria";
+    case TipoProblema::SimetricaDefinidaPositiva: return "Simétrica definida positiva aleatoria";
+    case TipoProblema::Banda: return "Banda aleatoria";
+    case TipoProblema::Hilbert: return "Hilbert";
+    case TipoProblema::MalCondicionada: return "Mal condicionada (κ = 1e8)";
+    }
+    return "Desconocido";
+}
@@ -0,0 +1,167 @@
+/**
+ * @file Generators.hpp
+ * @brief Declaración de los generadores de problemas de prueba (Poisson, aleatorios, mal condicionados).
+ *
+ * Permiten construir sistemas de 10⁴ a 10⁷ incógnitas sin capturarlos a mano, para medir el rendimiento de
+ * los métodos y validar sus resultados contra una solución exacta conocida. Las matrices se generan en
+ * formato disperso (SparseMatrix::toMatrix da la versión densa) salvo las que son densas por naturaleza,
+ * y los problemas de Poisson también pueden usarse sin formar la matriz con OperadorPoisson. Los generadores
+ * aleatorios reciben una semilla, de modo que la misma semilla produce siempre el mismo sistema.
+ */
+#ifndef GENERATORS_HPP
+#define GENERATORS_HPP
+
+#include <cstdint>
+#include "Matrix.hpp"
+#include "SparseMatrix.hpp"
+#include "LinearOperator.hpp"
+
+/**
+ * @brief Familia de problema de prueba que construye generarProblema.
+ */
+enum class TipoProblema {
+    Poisson1D,                 ///< Laplaciano tridiagonal (-1, 2, -1).
+    Poisson2D,                 ///< Stencil de cinco puntos sobre una malla cuadrada.
+    Poisson3D,                 ///< Stencil de siete puntos sobre una malla cúbica.
+    DiagonalDominante,         ///< Dispersa aleatoria no simétrica con diagonal estrictamente dominante.
+    SimetricaDefinidaPositiva, ///< Dispersa aleatoria simétrica definida positiva.
+    Banda,                     ///< Aleatoria con banda de ancho fijo y diagonal dominante.
+    Hilbert,                   ///< Matriz de Hilbert (densa y muy mal condicionada).
+    MalCondicionada            ///< Densa simétrica definida positiva con número de condición 10⁸.
+};
+
+/**
+ * @brief Sistema de prueba A·x = b junto con su solución exacta.
+ */
+struct ProblemaPrueba {
+    TipoProblema tipo;
+    SparseMatrix A;   ///< Matriz del sistema (para las densas se guardan todos sus elementos).
+    Matrix b;         ///< Término independiente, b = A·solucion.
+    Matrix solucion;  ///< Solución exacta con la que se comparan los resultados.
+    bool simetrica;   ///< true si A es simétrica definida positiva (admite gradiente conjugado).
+};
+
+/**
+ * @class OperadorPoisson
+ * @brief Laplaciano discreto con fronteras de Dirichlet en 1, 2 o 3 dimensiones, aplicado sin almacenar la matriz.
+ *
+ * La incógnita del punto (x, y, z) es la número (z·ny + y)·nx + x; la diagonal vale 2·dimensión y cada
+ * vecino -1. Es la misma matriz que devuelven poisson1D, poisson2D y poisson3D.
+ */
+class OperadorPoisson : public OperadorLineal {
+    private:
+        int nx;
+        int ny;
+        int nz;
+        int dimension;
+    public:
+        /**
+        * @param nx Puntos de la malla en x.
+        * @param ny Puntos en y (1 para una dimensión).
+        * @param nz Puntos en z (1 para una o dos dimensiones).
+        *
+        * @throws std::invalid_argument Si alguna dimensión no es positiva o la malla excede el rango de int.
+        */
+        OperadorPoisson(int nx, int ny = 1, int nz = 1);
+
+        int getSize() const override;
+        void aplicar(const double* x, double* y) const override;
+        void diagonal(double* d) const override;
+        bool tieneFilas() const override;
+        double sumaFueraDiagonal(int i, const double* x) const override;
+        double operacionesProducto() const override;
+};
+
+/**
+ * @brief Laplaciano unidimensional de n x n: tridiagonal con 2 en la diagonal y -1 fuera de ella.
+ */
+SparseMatrix poisson1D(int n);
+
+/**
+ * @brief Laplaciano bidimensional de cinco puntos sobre una malla de nx x ny.
+ */
+SparseMatrix poisson2D(int nx, int ny);
+
+/**
+ * @brief Laplaciano tridimensional de siete puntos sobre una malla de nx x ny x nz.
+ */
+SparseMatrix poisson3D(int nx, int ny, int nz);
+
+/**
+ * @brief Matriz dispersa aleatoria con diagonal estrictamente dominante por filas (no simétrica).
+ *
+ * Cada fila tiene `noCerosPorFila` elementos fuera de la diagonal en columnas al azar, con valores uniformes
+ * en [-1, 1], y a_ii = Σ|a_ij| + 1, por lo que Jacobi y Gauss-Seidel convergen.
+ *
+ * @throws std::invalid_argument Si n no es positivo o noCerosPorFila es negativo.
+ */
+SparseMatrix matrizDiagonalDominante(int n, int noCerosPorFila, std::uint64_t semilla);
+
+/**
+ * @brief Matriz dispersa aleatoria simétrica definida positiva.
+ *
+ * Se generan `noCerosPorFila` elementos por fila bajo la diagonal, se reflejan sobre ella y la diagonal se
+ * toma como la suma de los valores absolutos de la fila más 1 (definida positiva por el teorema de Gershgorin).
+ *
+ * @throws std::invalid_argument Si n no es positivo o noCerosPorFila es negativo.
+ */
+SparseMatrix matrizSimetricaDefinidaPositiva(int n, int noCerosPorFila, std::uint64_t semilla);
+
+/**
+ * @brief Matriz de banda aleatoria con `anchoInferior` diagonales bajo la principal y `anchoSuperior` sobre ella.
+ *
+ * Todos los elementos de la banda son aleatorios en [-1, 1] y la diagonal es dominante.
+ *
+ * @throws std::invalid_argument Si n no es positivo o algún ancho es negativo.
+ */
+SparseMatrix matrizBanda(int n, int anchoInferior, int anchoSuperior, std::uint64_t semilla);
+
+/**
+ * @brief Matriz de Hilbert de n x n, h_ij = 1/(i + j + 1); su número de condición crece como e^(3.5·n).
+ */
+Matrix matrizHilbert(int n);
+
+/**
+ * @brief Matriz densa simétrica definida positiva con número de condición (en norma 2) dado.
+ *
+ * Se construye como Q·D·Q con D diagonal de valores propios espaciados geométricamente entre 1 y
+ * 1/numeroCondicion y Q = I - 2·v·vᵀ una reflexión de Householder aleatoria, en O(n²) operaciones.
+ *
+ * @throws std::invalid_argument Si n no es positivo o numeroCondicion es menor a 1.
+ */
+Matrix matrizMalCondicionada(int n, double numeroCondicion, std::uint64_t semilla);
+
+/**
+ * @brief Vector de n x 1 con elementos aleatorios uniformes en [-1, 1].
+ */
+Matrix vectorAleatorio(int n, std::uint64_t semilla);
+
+/**
+ * @brief Calcula b = A·x para construir un sistema cuya solución exacta es x.
+ *
+ * @throws std::invalid_argument Si x no es un vector columna del tamaño del operador.
+ */
+Matrix terminoIndependiente(const OperadorLineal& A, const Matrix& x);
+
+/**
+ * @brief Construye un problema de prueba de la familia `tipo` con solución exacta aleatoria.
+ *
+ * Para las mallas de dos y tres dimensiones se usa el lado más grande cuyo número de puntos no excede
+ * `incognitas`. Las matrices aleatorias dispersas tienen 5 elementos fuera de la diagonal por fila y la de
+ * banda un ancho de 2 a cada lado. Las familias densas (Hilbert y mal condicionada) se limitan a 2000 incógnitas,
+ * porque la matriz completa se forma y se guarda con sus n² elementos.
+ *
+ * @param tipo Familia del problema.
+ * @param incognitas Número aproximado de incógnitas.
+ * @param semilla Semilla del generador pseudoaleatorio.
+ *
+ * @throws std::invalid_argument Si el número de incógnitas no es positivo o excede el límite de una familia densa.
+ */
+ProblemaPrueba generarProblema(TipoProblema tipo, int incognitas, std::uint64_t semilla);
+
+/**
+ * @brief Nombre legible de la familia de problema.
+ */
+const char* nombreProblema(TipoProblema tipo);
+
+#endif
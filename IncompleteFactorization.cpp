@@ -0,0 +1,375 @@
+/**
+ * @file IncompleteFactorization.cpp
+ * @brief Implementación de las factorizaciones incompletas ILU(0), ILUT e IC(0).
+ *
+ * @section features_sec Características principales
+ * -ILU(0) e IC(0) sobre el patrón de A, ILUT con umbral de descarte y llenado máximo por fila.
+ * -Sustituciones triangulares planificadas por niveles, paralelas dentro de cada nivel con OpenMP.
+ * -Puntos de verificación del control de ejecución en cada fila de la factorización.
+ */
+#include "IncompleteFactorization.hpp"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+#include "ExecutionControl.hpp"
+
+namespace {
+
+/**
+ * @brief Crea una matriz CSR de n x n a partir de arreglos ya ordenados por fila y columna (inicio[n] entradas).
+ */
+SparseMatrix armarCSR(int n, const int* inicio, const int* columnas, const double* valores) {
+    SparseMatrix T(n, n, inicio[n]);
+    std::copy(inicio, inicio + n + 1, T.datosInicioFila());
+    std::copy(columnas, columnas + inicio[n], T.datosColumnas());
+    std::copy(valores, valores + inicio[n], T.datosValores());
+    return T;
+}
+
+/**
+ * @brief Cambia el arreglo por uno de `capacidad` elementos que conserva los primeros `usados`.
+ */
+template <typename T>
+void ampliar(std::unique_ptr<T[]>& datos, int usados, int capacidad) {
+    std::unique_ptr<T[]> ampliado(new T[capacidad]);
+    std::copy(datos.get(), datos.get() + usados, ampliado.get());
+    datos = std::move(ampliado);
+}
+
+/**
+ * @brief Calcula el nivel de cada fila de una matriz triangular estricta y las agrupa por nivel.
+ *
+ * @param T Parte estrictamente triangular (inferior si `inferior`, superior si no).
+ */
+void planificarTriangular(const SparseMatrix& T, bool inferior, PlanTriangular& plan) {
+    int n = T.getRows();
+    const int* inicio = T.getInicioFila();
+    const int* columnas = T.getColumnas();
+    std::unique_ptr<int[]> nivel = std::make_unique<int[]>(n);
+    int numNiveles = 0;
+    for (int paso = 0; paso < n; paso++) {
+        int i = inferior ? paso : n - 1 - paso;
+        int mayor = -1;
+        for (int k = inicio[i]; k < inicio[i + 1]; k++) {
+            mayor = std::max(mayor, nivel[columnas[k]]);
+        }
+        nivel[i] = mayor + 1;
+        numNiveles = std::max(numNiveles, nivel[i] + 1);
+    }
+    plan.numNiveles = numNiveles;
+    plan.inicioNivel = std::make_unique<int[]>(static_cast<size_t>(numNiveles) + 1);
+    plan.filas = std::make_unique<int[]>(n);
+    for (int i = 0; i < n; i++) plan.inicioNivel[nivel[i] + 1]++;
+    for (int l = 0; l < numNiveles; l++) plan.inicioNivel[l + 1] += plan.inicioNivel[l];
+    std::unique_ptr<int[]> siguiente = std::make_unique<int[]>(static_cast<size_t>(numNiveles) + 1);
+    std::copy(plan.inicioNivel.get(), plan.inicioNivel.get() + numNiveles + 1, siguiente.get());
+    for (int paso = 0; paso < n; paso++) {
+        int i = inferior ? paso : n - 1 - paso;
+        plan.filas[siguiente[nivel[i]]++] = i;
+    }
+}
+
+/**
+ * @brief Resuelve (D + T)·x = r por niveles, con T estrictamente triangular y D la diagonal (unitaria si es nullptr).
+ *
+ * r y x pueden ser el mismo vector: cada fila lee su término antes de escribir su incógnita y solo usa
+ * incógnitas de niveles anteriores.
+ */
+void sustituirPorNiveles(const SparseMatrix& T, const double* diagonal, const PlanTriangular& plan,
+                         const double* r, double* x) {
+    const int* inicio = T.getInicioFila();
+    const int* columnas = T.getColumnas();
+    const double* valores = T.getValores();
+    for (int l = 0; l < plan.numNiveles; l++) {
+        int desde = plan.inicioNivel[l];
+        int hasta = plan.inicioNivel[l + 1];
+#ifdef _OPENMP
+        #pragma omp parallel for schedule(static) if (hasta - desde > 256)
+#endif
+        for (int p = desde; p < hasta; p++) {
+            int i = plan.filas[p];
+            double suma = r[i];
+            for (int k = inicio[i]; k < inicio[i + 1]; k++) {
+                suma -= valores[k] * x[columnas[k]];
+            }
+            x[i] = diagonal != nullptr ? suma / diagonal[i] : suma;
+        }
+    }
+}
+
+} // namespace
+
+FactorizacionIncompleta::FactorizacionIncompleta(const SparseMatrix& A) : n(A.getRows()) {
+    if (A.getCols() != n) {
+        throw std::invalid_argument("La factorización incompleta requiere una matriz cuadrada.");
+    }
+    diagonalU = std::make_unique<double[]>(n);
+}
+
+void FactorizacionIncompleta::planificar() {
+    planificarTriangular(L, true, planL);
+    planificarTriangular(U, false, planU);
+}
+
+int FactorizacionIncompleta::getSize() const {
+    return n;
+}
+
+void FactorizacionIncompleta::aplicar(const double* r, double* z) const {
+    sustituirPorNiveles(L, diagonalL.get(), planL, r, z);
+    sustituirPorNiveles(U, diagonalU.get(), planU, z, z);
+}
+
+long long FactorizacionIncompleta::getNoCeros() const {
+    return static_cast<long long>(L.getNoCeros()) + U.getNoCeros() + (diagonalL ? 2LL * n : n);
+}
+
+int FactorizacionIncompleta::getNivelesL() const {
+    return planL.numNiveles;
+}
+
+int FactorizacionIncompleta::getNivelesU() const {
+    return planU.numNiveles;
+}
+
+FactorizacionILU0::FactorizacionILU0(const SparseMatrix& A) : FactorizacionIncompleta(A) {
+    const int* inicio = A.getInicioFila();
+    const int* columnas = A.getColumnas();
+    std::unique_ptr<double[]> valores = std::make_unique<double[]>(A.getNoCeros());
+    std::copy(A.getValores(), A.getValores() + A.getNoCeros(), valores.get());
+    std::unique_ptr<int[]> diagonal = std::make_unique<int[]>(n);
+    std::unique_ptr<int[]> posicion = std::make_unique<int[]>(n);
+    std::fill(diagonal.get(), diagonal.get() + n, -1);
+    std::fill(posicion.get(), posicion.get() + n, -1);
+
+    for (int i = 0; i < n; i++) {
+        verificarInterrupcion(RegionMedida::Eliminacion, i, n);
+        for (int k = inicio[i]; k < inicio[i + 1]; k++) {
+            posicion[columnas[k]] = k;
+            if (columnas[k] == i) diagonal[i] = k;
+        }
+        if (diagonal[i] == -1) {
+            throw std::runtime_error("ILU(0) requiere que todas las entradas de la diagonal estén en el patrón de A.");
+        }
+        // Eliminación de la fila i con las filas anteriores, sin salir del patrón de A
+        for (int k = inicio[i]; k < inicio[i + 1] && columnas[k] < i; k++) {
+            int j = columnas[k];
+            valores[k] /= valores[diagonal[j]];
+            for (int q = diagonal[j] + 1; q < inicio[j + 1]; q++) {
+                int p = posicion[columnas[q]];
+                if (p != -1) valores[p] -= valores[k] * valores[q];
+            }
+        }
+        if (valores[diagonal[i]] == 0.0) {
+            throw std::runtime_error("Pivote nulo en ILU(0); pruebe con ILUT.");
+        }
+        for (int k = inicio[i]; k < inicio[i + 1]; k++) posicion[columnas[k]] = -1;
+    }
+
+    // L y U tienen exactamente el patrón de A debajo y encima de la diagonal
+    int noCerosL = 0;
+    for (int i = 0; i < n; i++) {
+        for (int k = inicio[i]; k < inicio[i + 1] && columnas[k] < i; k++) noCerosL++;
+    }
+    L = SparseMatrix(n, n, noCerosL);
+    U = SparseMatrix(n, n, A.getNoCeros() - noCerosL - n);
+    int* inicioL = L.datosInicioFila();
+    int* columnasL = L.datosColumnas();
+    double* valoresL = L.datosValores();
+    int* inicioU = U.datosInicioFila();
+    int* columnasU = U.datosColumnas();
+    double* valoresU = U.datosValores();
+    for (int i = 0; i < n; i++) {
+        inicioL[i + 1] = inicioL[i];
+        inicioU[i + 1] = inicioU[i];
+        for (int k = inicio[i]; k < inicio[i + 1]; k++) {
+            if (columnas[k] < i) {
+                columnasL[inicioL[i + 1]] = columnas[k];
+                valoresL[inicioL[i + 1]++] = valores[k];
+            } else if (columnas[k] > i) {
+                columnasU[inicioU[i + 1]] = columnas[k];
+                valoresU[inicioU[i + 1]++] = valores[k];
+            } else {
+                diagonalU[i] = valores[k];
+            }
+        }
+    }
+    planificar();
+}
+
+FactorizacionILUT::FactorizacionILUT(const SparseMatrix& A, double umbral, int llenado) : FactorizacionIncompleta(A) {
+    if (umbral < 0.0 || llenado < 0) {
+        throw std::invalid_argument("El umbral y el llenado de ILUT no pueden ser negativos.");
+    }
+    const int* inicio = A.getInicioFila();
+    const int* columnas = A.getColumnas();
+    const double* valoresA = A.getValores();
+
+    // L y U crecen por filas; empiezan con el tamaño de las partes de A y se duplican si no alcanza
+    int capacidadL = std::max(1, A.getNoCeros() / 2);
+    int capacidadU = capacidadL;
+    std::unique_ptr<int[]> inicioL = std::make_unique<int[]>(n + 1);
+    std::unique_ptr<int[]> columnasL(new int[capacidadL]);
+    std::unique_ptr<double[]> valoresL(new double[capacidadL]);
+    std::unique_ptr<int[]> inicioU = std::make_unique<int[]>(n + 1);
+    std::unique_ptr<int[]> columnasU(new int[capacidadU]);
+    std::unique_ptr<double[]> valoresU(new double[capacidadU]);
+    std::unique_ptr<double[]> w = std::make_unique<double[]>(n);
+    std::unique_ptr<char[]> presente = std::make_unique<char[]>(n);
+    std::unique_ptr<int[]> indices = std::make_unique<int[]>(n);      // Columnas presentes en la fila, sin repetir. //
+    std::unique_ptr<int[]> pendientes = std::make_unique<int[]>(n);   // Montículo de columnas inferiores por eliminar, la menor primero. //
+    std::unique_ptr<std::pair<double, int>[]> candidatos = std::make_unique<std::pair<double, int>[]>(n);
+
+    for (int i = 0; i < n; i++) {
+        verificarInterrupcion(RegionMedida::Eliminacion, i, n);
+        double norma = 0.0;
+        int numIndices = 0;
+        int numPendientes = 0;
+        for (int k = inicio[i]; k < inicio[i + 1]; k++) {
+            int j = columnas[k];
+            norma += valoresA[k] * valoresA[k];
+            w[j] = valoresA[k];
+            presente[j] = 1;
+            indices[numIndices++] = j;
+            if (j < i) pendientes[numPendientes++] = j;
+        }
+        norma = std::sqrt(norma);
+        if (norma == 0.0) {
+            throw std::runtime_error("ILUT no puede factorizar una matriz con filas nulas.");
+        }
+        double tau = umbral * norma;
+        std::make_heap(pendientes.get(), pendientes.get() + numPendientes, std::greater<int>());
+
+        while (numPendientes > 0) {
+            std::pop_heap(pendientes.get(), pendientes.get() + numPendientes, std::greater<int>());
+            int k = pendientes[--numPendientes];
+            w[k] /= diagonalU[k];
+            if (std::abs(w[k]) < tau) {
+                w[k] = 0.0;
+                continue;
+            }
+            for (int q = inicioU[k]; q < inicioU[k + 1]; q++) {
+                int j = columnasU[q];
+                if (!presente[j]) {
+                    presente[j] = 1;
+                    w[j] = 0.0;
+                    indices[numIndices++] = j;
+                    if (j < i) {
+                        pendientes[numPendientes++] = j;
+                        std::push_heap(pendientes.get(), pendientes.get() + numPendientes, std::greater<int>());
+                    }
+                }
+                w[j] -= w[k] * valoresU[q];
+            }
+        }
+
+        // Se conservan las `llenado` entradas más grandes de cada parte que superan el umbral
+        auto conservar = [&](bool inferior, int* inicioT, std::unique_ptr<int[]>& cols, std::unique_ptr<double[]>& vals,
+                             int& capacidad) {
+            int numCandidatos = 0;
+            for (int t = 0; t < numIndices; t++) {
+                int j = indices[t];
+                if ((inferior ? j < i : j > i) && std::abs(w[j]) >= tau && w[j] != 0.0) {
+                    candidatos[numCandidatos++] = {std::abs(w[j]), j};
+                }
+            }
+            std::pair<double, int>* fin = candidatos.get() + numCandidatos;
+            if (numCandidatos > llenado) {
+                std::nth_element(candidatos.get(), candidatos.get() + llenado, fin,
+                                 [](const std::pair<double, int>& x, const std::pair<double, int>& y) { return x.first > y.first; });
+                numCandidatos = llenado;
+                fin = candidatos.get() + numCandidatos;
+            }
+            std::sort(candidatos.get(), fin,
+                      [](const std::pair<double, int>& x, const std::pair<double, int>& y) { return x.second < y.second; });
+            int usados = inicioT[i];
+            long long requerido = static_cast<long long>(usados) + numCandidatos;
+            if (requerido > capacidad) {
+                if (requerido > INT_MAX) {
+                    throw std::runtime_error("El factor tiene demasiadas entradas para el formato disperso.");
+                }
+                capacidad = static_cast<int>(std::min<long long>(std::max(2LL * capacidad, requerido), INT_MAX));
+                ampliar(cols, usados, capacidad);
+                ampliar(vals, usados, capacidad);
+            }
+            for (int t = 0; t < numCandidatos; t++) {
+                cols[usados + t] = candidatos[t].second;
+                vals[usados + t] = w[candidatos[t].second];
+            }
+            inicioT[i + 1] = usados + numCandidatos;
+        };
+        conservar(true, inicioL.get(), columnasL, valoresL, capacidadL);
+        conservar(false, inicioU.get(), columnasU, valoresU, capacidadU);
+
+        double pivote = presente[i] ? w[i] : 0.0;
+        diagonalU[i] = pivote != 0.0 ? pivote : (tau > 0.0 ? tau : norma);
+
+        for (int t = 0; t < numIndices; t++) {
+            presente[indices[t]] = 0;
+            w[indices[t]] = 0.0;
+        }
+    }
+    L = armarCSR(n, inicioL.get(), columnasL.get(), valoresL.get());
+    U = armarCSR(n, inicioU.get(), columnasU.get(), valoresU.get());
+    planificar();
+}
+
+FactorizacionIC0::FactorizacionIC0(const SparseMatrix& A, double desplazamiento) : FactorizacionIncompleta(A) {
+    if (desplazamiento < 0.0) {
+        throw std::invalid_argument("El desplazamiento de IC(0) no puede ser negativo.");
+    }
+    const int* inicio = A.getInicioFila();
+    const int* columnas = A.getColumnas();
+    const double* valoresA = A.getValores();
+    diagonalL = std::make_unique<double[]>(n);
+
+    // L tiene exactamente el patrón de A debajo de la diagonal
+    int noCerosL = 0;
+    for (int i = 0; i < n; i++) {
+        for (int k = inicio[i]; k < inicio[i + 1] && columnas[k] < i; k++) noCerosL++;
+    }
+    L = SparseMatrix(n, n, noCerosL);
+    int* inicioL = L.datosInicioFila();
+    int* columnasL = L.datosColumnas();
+    double* valoresL = L.datosValores();
+    std::unique_ptr<double[]> w = std::make_unique<double[]>(n);
+    std::unique_ptr<int[]> marca = std::make_unique<int[]>(n);
+    std::fill(marca.get(), marca.get() + n, -1);
+
+    for (int i = 0; i < n; i++) {
+        verificarInterrupcion(RegionMedida::Eliminacion, i, n);
+        double diagonal = 0.0;
+        int cuenta = inicioL[i];
+        for (int k = inicio[i]; k < inicio[i + 1] && columnas[k] <= i; k++) {
+            int j = columnas[k];
+            if (j == i) {
+                diagonal = valoresA[k] * (1.0 + desplazamiento);
+                break;
+            }
+            // L(i,j) = (a_ij - Σ_{k<j} L(i,k)·L(j,k)) / L(j,j), solo sobre el patrón de A
+            double suma = valoresA[k];
+            for (int q = inicioL[j]; q < inicioL[j + 1]; q++) {
+                if (marca[columnasL[q]] == i) suma -= w[columnasL[q]] * valoresL[q];
+            }
+            double lij = suma / diagonalL[j];
+            w[j] = lij;
+            marca[j] = i;
+            columnasL[cuenta] = j;
+            valoresL[cuenta++] = lij;
+        }
+        for (int q = inicioL[i]; q < cuenta; q++) {
+            diagonal -= valoresL[q] * valoresL[q];
+        }
+        if (!(diagonal > 0.0)) {
+            throw std::runtime_error("Pivote no positivo en IC(0): la matriz no es definida positiva o requiere un desplazamiento.");
+        }
+        diagonalL[i] = std::sqrt(diagonal);
+        inicioL[i + 1] = cuenta;
+    }
+    U = L.transpuesta();
+    std::copy(diagonalL.get(), diagonalL.get() + n, diagonalU.get());
+    planificar();
+}
@@ -0,0 +1,124 @@
+/**
+ * @file IncompleteFactorization.hpp
+ * @brief Declaración de los precondicionadores de factorización incompleta ILU(0), ILUT e IC(0).
+ *
+ * Entre iterar con Jacobi o Gauss-Seidel y factorizar por completo en O(n³) está la factorización
+ * incompleta: se eliminan las entradas como en forwardElimination, pero se descarta todo el llenado fuera
+ * de un patrón (ILU(0), IC(0)) o por debajo de un umbral (ILUT). El resultado M = L·U cuesta O(nnz) en
+ * memoria y en cada aplicación, y aproxima A lo bastante bien como para que BiCGSTAB o el gradiente
+ * conjugado converjan en sistemas donde Jacobi y Gauss-Seidel no lo hacen.
+ *
+ * Las sustituciones triangulares usan planificación por niveles: las filas de un mismo nivel solo dependen
+ * de filas de niveles anteriores, así que pueden procesarse en paralelo (con OpenMP si está habilitado).
+ */
+#ifndef INCOMPLETE_FACTORIZATION_HPP
+#define INCOMPLETE_FACTORIZATION_HPP
+
+#include <memory>
+#include "SparseMatrix.hpp"
+#include "Preconditioner.hpp"
+
+/**
+ * @brief Agrupación de las filas de una matriz triangular en niveles independientes.
+ */
+struct PlanTriangular {
+    int numNiveles = 0;
+    std::unique_ptr<int[]> inicioNivel;  ///< numNiveles + 1 posiciones en `filas`.
+    std::unique_ptr<int[]> filas;        ///< Filas ordenadas por nivel.
+};
+
+/**
+ * @class FactorizacionIncompleta
+ * @brief Base de los precondicionadores M = L·U con L y U dispersas; aplicar resuelve L·y = r y U·z = y.
+ *
+ * L y U se guardan sin su diagonal (estrictamente inferior y estrictamente superior) y las diagonales
+ * por separado; la diagonal de L es unitaria en las factorizaciones LU.
+ */
+class FactorizacionIncompleta : public Precondicionador {
+    protected:
+        int n;
+        SparseMatrix L;
+        SparseMatrix U;
+        std::unique_ptr<double[]> diagonalL;   // nullptr si la diagonal de L es unitaria. //
+        std::unique_ptr<double[]> diagonalU;
+        PlanTriangular planL;
+        PlanTriangular planU;
+
+        explicit FactorizacionIncompleta(const SparseMatrix& A);
+
+        /**
+        * @brief Calcula los planes por niveles de L y U; cada clase derivada lo llama al terminar de factorizar.
+        */
+        void planificar();
+    public:
+        int getSize() const override;
+
+        /**
+        * @brief Resuelve L·y = r en z y después U·z = y en el lugar.
+        *
+        * Usa z como único espacio de trabajo, según el contrato de hilos de Precondicionador.
+        */
+        void aplicar(const double* r, double* z) const override;
+
+        /**
+        * @brief Entradas guardadas en L y U, incluidas las diagonales.
+        */
+        long long getNoCeros() const;
+
+        int getNivelesL() const;
+        int getNivelesU() const;
+};
+
+/**
+ * @class FactorizacionILU0
+ * @brief Factorización LU incompleta sin llenado: L y U conservan exactamente el patrón de A.
+ */
+class FactorizacionILU0 : public FactorizacionIncompleta {
+    public:
+        /**
+        * @throws std::invalid_argument Si A no es cuadrada.
+        * @throws std::runtime_error Si aparece un pivote nulo, falta una entrada de la diagonal o la solución se interrumpe.
+        */
+        explicit FactorizacionILU0(const SparseMatrix& A);
+};
+
+/**
+ * @class FactorizacionILUT
+ * @brief Factorización LU incompleta con umbral (ILUT de Saad).
+ *
+ * En cada fila se descartan las entradas menores a `umbral` veces la norma 2 de la fila de A y se conservan
+ * a lo más `llenado` entradas, las de mayor magnitud, en cada una de las partes L y U. Un pivote nulo se
+ * sustituye por `umbral` veces la norma de la fila para que la factorización no se interrumpa.
+ */
+class FactorizacionILUT : public FactorizacionIncompleta {
+    public:
+        /**
+        * @param A Matriz dispersa cuadrada.
+        * @param umbral Tolerancia relativa de descarte (1e-4 por defecto).
+        * @param llenado Entradas máximas por fila en L y en U (además de la diagonal).
+        *
+        * @throws std::invalid_argument Si A no es cuadrada o los parámetros no son válidos.
+        * @throws std::runtime_error Si alguna fila de A es completamente nula o la solución se interrumpe.
+        */
+        FactorizacionILUT(const SparseMatrix& A, double umbral = 1e-4, int llenado = 10);
+};
+
+/**
+ * @class FactorizacionIC0
+ * @brief Factorización de Cholesky incompleta sin llenado, M = L·Lᵀ, para matrices simétricas definidas positivas.
+ *
+ * Solo se lee la parte triangular inferior de A.
+ */
+class FactorizacionIC0 : public FactorizacionIncompleta {
+    public:
+        /**
+        * @param A Matriz dispersa simétrica definida positiva.
+        * @param desplazamiento α ≥ 0: factoriza A + α·diag(A), útil si la factorización incompleta se interrumpe.
+        *
+        * @throws std::invalid_argument Si A no es cuadrada o el desplazamiento es negativo.
+        * @throws std::runtime_error Si aparece un pivote no positivo o la solución se interrumpe.
+        */
+        explicit FactorizacionIC0(const SparseMatrix& A, double desplazamiento = 0.0);
+};
+
+#endif
@@ -0,0 +1,158 @@
+/**
+ * @file Inverse.cpp
+ * @brief Implementación de la matriz inversa por Gauss-Jordan en el lugar.
+ *
+ * @section features_sec Características principales
+ * -Inversión en el lugar con pivoteo parcial, sin matriz aumentada.
+ * -Variante por bloques con actualizaciones diferidas aplicadas por bloques de columnas.
+ */
+#include "Inverse.hpp"
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include "ExecutionControl.hpp"
+
+namespace {
+
+const double TOLERANCIA = 1e-12;
+
+/// Columnas por bloque al aplicar las actualizaciones diferidas de un panel.
+const int COLUMNAS_POR_BLOQUE = 128;
+
+/**
+ * @brief Busca el pivote de la columna `k`, intercambia filas completas y lo registra en `intercambios`.
+ *
+ * @return double Valor del pivote.
+ */
+double pivotear(Matrix& A, int k, int* intercambios) {
+    int n = A.getRows();
+    int maxRow = k;
+    for (int row = k + 1; row < n; row++) {
+        if (std::abs(A.at(row, k)) > std::abs(A.at(maxRow, k))) {
+            maxRow = row;
+        }
+    }
+    if (std::abs(A.at(maxRow, k)) < TOLERANCIA) {
+        throw std::runtime_error("La matriz es singular o numéricamente singular: no tiene inversa.");
+    }
+    intercambios[k] = maxRow;
+    if (maxRow != k) {
+        A.intercambiarFilas(k, maxRow);
+    }
+    return A.at(k, k);
+}
+
+/**
+ * @brief Elimina la columna `k` en todas las filas, actualizando solo las columnas [desde, hasta).
+ *
+ * La columna k recibe la columna correspondiente de la identidad transformada.
+ */
+void eliminarColumna(Matrix& A, int k, double pivote, int desde, int hasta) {
+    int n = A.getRows();
+    double* filaK = &A.at(k, 0);
+    filaK[k] = 1.0;
+    for (int col = desde; col < hasta; col++) {
+        filaK[col] /= pivote;
+    }
+    for (int row = 0; row < n; row++) {
+        if (row == k) continue;
+        double* fila = &A.at(row, 0);
+        double factor = fila[k];
+        if (factor == 0.0) continue;
+        fila[k] = 0.0;
+        for (int col = desde; col < hasta; col++) {
+            fila[col] -= factor * filaK[col];
+        }
+    }
+}
+
+/**
+ * @brief Aplica las actualizaciones diferidas del panel [k0, k1) a las columnas fuera del panel.
+ *
+ * Las columnas del panel contienen M, la parte no trivial de la transformación acumulada del panel,
+ * así que cada columna x fuera del panel pasa a ser x - (filas del panel de x) + M·(filas del panel de x).
+ */
+void actualizarFueraDelPanel(Matrix& A, int k0, int k1) {
+    int n = A.getRows();
+    int nb = k1 - k0;
+    std::unique_ptr<double[]> Y = std::make_unique<double[]>(static_cast<size_t>(nb) * COLUMNAS_POR_BLOQUE);
+
+    for (int j0 = 0; j0 < n; j0 += COLUMNAS_POR_BLOQUE) {
+        int j1 = std::min(n, j0 + COLUMNAS_POR_BLOQUE);
+        // Las columnas del panel ya están actualizadas; el bloque se parte en los tramos a su izquierda y derecha
+        int tramos[2][2] = {{j0, std::min(j1, k0)}, {std::max(j0, k1), j1}};
+        for (auto& tramo : tramos) {
+            int desde = tramo[0];
+            int ancho = tramo[1] - desde;
+            if (ancho <= 0) continue;
+
+            for (int p = 0; p < nb; p++) {
+                double* fila = &A.at(k0 + p, 0);
+                std::copy(fila + desde, fila + desde + ancho, &Y[static_cast<size_t>(p) * ancho]);
+                std::fill(fila + desde, fila + desde + ancho, 0.0);
+            }
+            for (int row = 0; row < n; row++) {
+                double* fila = &A.at(row, 0);
+                for (int p = 0; p < nb; p++) {
+                    double m = fila[k0 + p];
+                    if (m == 0.0) continue;
+                    const double* y = &Y[static_cast<size_t>(p) * ancho];
+                    for (int c = 0; c < ancho; c++) {
+                        fila[desde + c] += m * y[c];
+                    }
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Deshace la permutación de filas intercambiando columnas en orden inverso.
+ */
+void deshacerIntercambios(Matrix& A, const int* intercambios) {
+    int n = A.getRows();
+    for (int k = n - 1; k >= 0; k--) {
+        if (intercambios[k] == k) continue;
+        for (int row = 0; row < n; row++) {
+            double* fila = &A.at(row, 0);
+            std::swap(fila[k], fila[intercambios[k]]);
+        }
+    }
+}
+
+} // namespace
+
+void inverseInPlace(Matrix& A, int tamanoBloque) {
+    int n = A.getRows();
+    if (A.getCols() != n) {
+        throw std::invalid_argument("Solo las matrices cuadradas tienen inversa.");
+    }
+    std::unique_ptr<int[]> intercambios = std::make_unique<int[]>(n);
+
+    if (tamanoBloque <= 1 || tamanoBloque >= n) {
+        for (int k = 0; k < n; k++) {
+            verificarInterrupcion(RegionMedida::Eliminacion, k, n);
+            double pivote = pivotear(A, k, intercambios.get());
+            eliminarColumna(A, k, pivote, 0, n);
+        }
+    } else {
+        for (int k0 = 0; k0 < n; k0 += tamanoBloque) {
+            int k1 = std::min(n, k0 + tamanoBloque);
+            for (int k = k0; k < k1; k++) {
+                verificarInterrupcion(RegionMedida::Eliminacion, k, n);
+                double pivote = pivotear(A, k, intercambios.get());
+                eliminarColumna(A, k, pivote, k0, k1);
+            }
+            actualizarFueraDelPanel(A, k0, k1);
+        }
+    }
+    deshacerIntercambios(A, intercambios.get());
+}
+
+Matrix inverse(const Matrix& A, int tamanoBloque) {
+    Matrix inversa(A);
+    inverseInPlace(inversa, tamanoBloque);
+    return inversa;
+}
@@ -0,0 +1,42 @@
+/**
+ * @file Inverse.hpp
+ * @brief Declaración de las funciones para calcular la matriz inversa por Gauss-Jordan.
+ *
+ * La inversa se obtiene en el lugar con Gauss-Jordan y pivoteo parcial: cada columna de la identidad que
+ * el método necesitaría en la matriz aumentada [A | I] se guarda en la columna de A que acaba de eliminarse,
+ * así que no hace falta memoria adicional de n x n y el costo es n³ operaciones, frente a las n
+ * factorizaciones completas que costaría resolver A·x = e_j columna por columna.
+ */
+#ifndef INVERSE_HPP
+#define INVERSE_HPP
+
+#include "Matrix.hpp"
+
+/**
+ * @brief Calcula la inversa de A sin modificarla.
+ *
+ * @param A Matriz cuadrada a invertir.
+ * @param tamanoBloque Pivotes por panel de la variante por bloques; 1 o menos usa la variante sin bloques.
+ * @return Matrix Inversa de A.
+ *
+ * @throws std::invalid_argument Si A no es cuadrada.
+ * @throws std::runtime_error Si A es singular o numéricamente singular.
+ */
+Matrix inverse(const Matrix& A, int tamanoBloque = 64);
+
+/**
+ * @brief Reemplaza A por su inversa (Gauss-Jordan en el lugar con pivoteo parcial).
+ *
+ * La variante por bloques elimina `tamanoBloque` pivotes seguidos actualizando solo las columnas del panel
+ * y después aplica todas las actualizaciones diferidas al resto de las columnas como un producto de matrices
+ * recorrido por bloques de columnas, que reutiliza mucho mejor la memoria caché.
+ *
+ * @param A Matriz cuadrada; al salir contiene A⁻¹. Si se lanza una excepción su contenido queda indefinido.
+ * @param tamanoBloque Pivotes por panel; 1 o menos usa la variante sin bloques.
+ *
+ * @throws std::invalid_argument Si A no es cuadrada.
+ * @throws std::runtime_error Si A es singular o numéricamente singular.
+ */
+void inverseInPlace(Matrix& A, int tamanoBloque = 64);
+
+#endif
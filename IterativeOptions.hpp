@@ -0,0 +1,81 @@
+/**
+ * @file IterativeOptions.hpp
+ * @brief Declaración de las opciones que controlan los métodos iterativos (Jacobi y Gauss-Seidel).
+ *
+ * Agrupa en una sola estructura la tolerancia, el número máximo de iteraciones y la aceleración de la
+ * convergencia, de modo que los métodos iterativos puedan configurarse por llamada sin multiplicar
+ * el número de parámetros de cada función.
+ */
+#ifndef ITERATIVE_OPTIONS_HPP
+#define ITERATIVE_OPTIONS_HPP
+
+#include "Matrix.hpp"
+#include "PerfCounters.hpp"
+
+/**
+ * @brief Técnica de aceleración aplicada sobre el barrido de Jacobi o Gauss-Seidel.
+ */
+enum class Aceleracion {
+    Ninguna,   ///< Barridos estacionarios simples (comportamiento original).
+    Anderson,  ///< Mezcla de Anderson con las últimas `profundidadAnderson` iteraciones.
+    Chebyshev  ///< Semi-iteración de Chebyshev a partir del radio espectral de la matriz de iteración.
+};
+
+/**
+ * @brief Medida que se compara con la tolerancia para decidir que el método convergió.
+ *
+ * Todas las medidas usan la norma infinito. El residuo es siempre el del vector que devuelve el método. En
+ * Jacobi sin aceleración (también por bloques) se obtiene del barrido sin costo extra, porque es el residuo
+ * exacto de su punto de partida, y por eso el método devuelve ese punto y no el resultado del último barrido.
+ * En Gauss-Seidel y con aceleración se calcula con un producto adicional por A en cada iteración.
+ */
+enum class CriterioParada {
+    Actualizacion,    ///< Máximo cambio entre iteraciones consecutivas (comportamiento original).
+    ResiduoAbsoluto,  ///< ||b - A·x||∞.
+    ResiduoRelativo   ///< ||b - A·x||∞ / ||b||∞.
+};
+
+/**
+ * @brief Razón por la que terminó un método iterativo.
+ */
+enum class MotivoParada {
+    Convergencia,       ///< La medida elegida quedó por debajo de la tolerancia.
+    MaximoIteraciones,  ///< Se agotaron las iteraciones permitidas.
+    Divergencia,        ///< La medida creció durante `iteracionesDivergencia` iteraciones seguidas o dejó de ser finita.
+    Estancamiento,      ///< La medida no mejoró lo suficiente durante `iteracionesEstancamiento` iteraciones.
+    Cancelacion,        ///< Se canceló la solución desde su ControlEjecucion; se devuelve la última iteración.
+    PlazoVencido        ///< Venció el plazo del ControlEjecucion; se devuelve la última iteración.
+};
+
+/**
+ * @brief Resumen de una ejecución de un método iterativo, se llena también cuando el método lanza excepción.
+ */
+struct EstadisticasIterativas {
+    int iteraciones = 0;                                ///< Iteraciones realizadas (en Chebyshev con Gauss-Seidel cada una son dos barridos).
+    double medidaFinal = 0.0;                           ///< Último valor de la medida del criterio de parada.
+    MotivoParada motivo = MotivoParada::MaximoIteraciones; ///< Razón de la terminación.
+    MedicionRendimiento rendimiento;                    ///< Contadores de las iteraciones, si se pidió `medirRendimiento`.
+};
+
+/**
+ * @brief Opciones de los métodos iterativos.
+ *
+ * Los valores por defecto reproducen el comportamiento de jacobiMethod y gaussSeidelMethod
+ * tal como los invoca el menú principal.
+ */
+struct OpcionesIterativas {
+    double tolerancia = 1e-6;                      ///< Valor que debe alcanzar la medida de `criterio` para detenerse.
+    CriterioParada criterio = CriterioParada::Actualizacion; ///< Medida que se compara con la tolerancia.
+    int maxIter = 500;                             ///< Número máximo de iteraciones (barridos; dos por iteración en Chebyshev con Gauss-Seidel).
+    Aceleracion aceleracion = Aceleracion::Ninguna; ///< Aceleración de la convergencia.
+    int profundidadAnderson = 5;                   ///< Iteraciones anteriores que recuerda la mezcla de Anderson (memoria extra de 2·n·profundidad).
+    double radioEspectral = 0.0;                   ///< Radio espectral de la matriz de iteración para Chebyshev; 0 lo estima automáticamente.
+    const Matrix* aproximacionInicial = nullptr;   ///< Punto de partida (vector de n x 1); nullptr parte de x = 0.
+    int iteracionesDivergencia = 0;                ///< Detiene el método si la medida crece estas iteraciones seguidas; 0 lo desactiva.
+    int iteracionesEstancamiento = 0;              ///< Detiene el método si la medida no mejora en estas iteraciones; 0 lo desactiva.
+    double mejoraMinima = 1e-3;                    ///< Mejora relativa mínima sobre el mejor valor para no considerarse estancado.
+    EstadisticasIterativas* estadisticas = nullptr; ///< Si no es nullptr, recibe el resumen de la ejecución.
+    bool medirRendimiento = false;                 ///< Mide las iteraciones con contadores de hardware (requiere `estadisticas`).
+};
+
+#endif
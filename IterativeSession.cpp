@@ -0,0 +1,49 @@
+/**
+ * @file IterativeSession.cpp
+ * @brief Implementación de la clase SesionIterativa.
+ *
+ * @section features_sec Características principales
+ * -Arranque en caliente automático con la solución del sistema anterior.
+ * -Compatible con las opciones de aceleración de los métodos iterativos.
+ */
+#include "IterativeSession.hpp"
+#include <stdexcept>
+#include <utility>
+
+SesionIterativa::SesionIterativa(MetodoSolucion metodo, const OpcionesIterativas& opciones)
+    : metodo(metodo), opciones(opciones), ultimaSolucion(0, 0), tieneSolucion(false) {
+    if (metodo != MetodoSolucion::Jacobi && metodo != MetodoSolucion::GaussSeidel) {
+        throw std::invalid_argument("La sesión iterativa requiere el método de Jacobi o el de Gauss-Seidel.");
+    }
+}
+
+Matrix SesionIterativa::resolver(Matrix& A, Matrix& b) {
+    OpcionesIterativas opcionesPaso = opciones;
+    bool mismoTamano = tieneSolucion && ultimaSolucion.getRows() == A.getRows();
+    opcionesPaso.aproximacionInicial = mismoTamano ? &ultimaSolucion : nullptr;
+
+    Matrix solucion = metodo == MetodoSolucion::Jacobi ? jacobiMethod(A, b, opcionesPaso)
+                                                       : gaussSeidelMethod(A, b, opcionesPaso);
+    ultimaSolucion = solucion;
+    tieneSolucion = true;
+    return solucion;
+}
+
+void SesionIterativa::reiniciar() {
+    tieneSolucion = false;
+}
+
+bool SesionIterativa::tieneAproximacion() const {
+    return tieneSolucion;
+}
+
+const Matrix& SesionIterativa::getUltimaSolucion() const {
+    if (!tieneSolucion) {
+        throw std::runtime_error("La sesión todavía no ha resuelto ningún sistema.");
+    }
+    return ultimaSolucion;
+}
+
+OpcionesIterativas& SesionIterativa::getOpciones() {
+    return opciones;
+}
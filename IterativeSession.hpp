@@ -0,0 +1,74 @@
+/**
+ * @file IterativeSession.hpp
+ * @brief Declaración de la clase SesionIterativa para resolver secuencias de sistemas con arranque en caliente.
+ *
+ * En simulaciones por pasos de tiempo se resuelve un sistema por paso y la solución cambia poco de un paso
+ * al siguiente. Una sesión recuerda la última solución y la usa como aproximación inicial del siguiente
+ * sistema, por lo que cada paso suele necesitar unas pocas iteraciones en lugar de partir de cero.
+ */
+#ifndef ITERATIVE_SESSION_HPP
+#define ITERATIVE_SESSION_HPP
+
+#include "IterativeOptions.hpp"
+#include "Matrix.hpp"
+#include "Methods.hpp"
+
+/**
+ * @class SesionIterativa
+ * @brief Sesión de solución iterativa que reutiliza automáticamente la solución anterior como punto de partida.
+ *
+ * Si el tamaño del nuevo sistema no coincide con el de la última solución, o después de llamar a `reiniciar`,
+ * la iteración vuelve a partir de x = 0.
+ */
+class SesionIterativa {
+    private:
+        MetodoSolucion metodo;
+        OpcionesIterativas opciones;
+        Matrix ultimaSolucion;
+        bool tieneSolucion;
+    public:
+        /**
+        * @brief Crea una sesión para un método iterativo.
+        *
+        * @param metodo MetodoSolucion::Jacobi o MetodoSolucion::GaussSeidel.
+        * @param opciones Opciones del método; su aproximación inicial se ignora, la sesión la administra.
+        *
+        * @throws std::invalid_argument Si el método no es iterativo.
+        */
+        explicit SesionIterativa(MetodoSolucion metodo, const OpcionesIterativas& opciones = OpcionesIterativas());
+
+        /**
+        * @brief Resuelve A·x = b partiendo de la solución del sistema anterior de la sesión.
+        *
+        * @param A Matriz de coeficientes del sistema (no se modifica).
+        * @param b Vector columna de términos independientes (no se modifica).
+        * @return Matrix vectorSolución solución del sistema (también queda guardada en la sesión).
+        *
+        * @throw std::runtime_error Si hay ceros en la diagonal o no converge; la solución guardada no cambia.
+        */
+        Matrix resolver(Matrix& A, Matrix& b);
+
+        /**
+        * @brief Olvida la última solución; el siguiente sistema parte de x = 0.
+        */
+        void reiniciar();
+
+        /**
+        * @brief Indica si hay una solución anterior que se usará como punto de partida.
+        */
+        bool tieneAproximacion() const;
+
+        /**
+        * @brief Devuelve la última solución calculada por la sesión.
+        *
+        * @throws std::runtime_error Si la sesión todavía no ha resuelto ningún sistema.
+        */
+        const Matrix& getUltimaSolucion() const;
+
+        /**
+        * @brief Permite modificar las opciones del método entre un sistema y otro.
+        */
+        OpcionesIterativas& getOpciones();
+};
+
+#endif
@@ -0,0 +1,259 @@
+/**
+ * @file Krylov.cpp
+ * @brief Implementación de los métodos de subespacios de Krylov.
+ *
+ * @section features_sec Características principales
+ * -Gradiente conjugado y BiCGSTAB con precondicionador opcional.
+ * -Iteración de Richardson con cualquier precondicionador.
+ * -Operan sobre cualquier OperadorLineal, por lo que no requieren formar la matriz.
+ * -Mismo control de parada que Jacobi y Gauss-Seidel (criterio, divergencia, estancamiento y estadísticas).
+ * -Cada producto A·x es una región de medición de rendimiento.
+ */
+#include "Krylov.hpp"
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include "utils.hpp"
+#include "PerfCounters.hpp"
+
+namespace {
+
+/**
+ * @brief Calcula y = A·x dentro de una región de medición de las iteraciones.
+ */
+void aplicarOperador(const OperadorLineal& A, const double* x, double* y) {
+    RegionRendimiento region(RegionMedida::Iteracion, A.operacionesProducto());
+    A.aplicar(x, y);
+}
+
+/**
+ * @brief Verifica dimensiones y copia b y la aproximación inicial a arreglos contiguos.
+ */
+void prepararSistema(const OperadorLineal& A, const Matrix& b, const OpcionesIterativas& opciones,
+                     const Precondicionador* precondicionador, double* terminos, double* x) {
+    int n = A.getSize();
+    if (b.getRows() != n || b.getCols() != 1) {
+        throw std::invalid_argument("Las dimensiones de A y b no son compatibles.");
+    }
+    if (precondicionador != nullptr && precondicionador->getSize() != n) {
+        throw std::invalid_argument("El precondicionador no corresponde al tamaño del sistema.");
+    }
+    const Matrix* inicial = opciones.aproximacionInicial;
+    if (inicial != nullptr && (inicial->getRows() != n || inicial->getCols() != 1)) {
+        throw std::invalid_argument("La aproximación inicial debe ser un vector columna del tamaño del sistema.");
+    }
+    for (int i = 0; i < n; i++) {
+        terminos[i] = b.at(i, 0);
+        x[i] = inicial != nullptr ? inicial->at(i, 0) : 0.0;
+    }
+}
+
+double normaInfinito(const double* v, int n) {
+    double norma = 0.0;
+    for (int i = 0; i < n; i++) norma = std::max(norma, std::abs(v[i]));
+    return norma;
+}
+
+double producto(const double* u, const double* v, int n) {
+    double suma = 0.0;
+    for (int i = 0; i < n; i++) suma += u[i] * v[i];
+    return suma;
+}
+
+Matrix aVector(const double* x, int n) {
+    Matrix resultado(n, 1);
+    for (int i = 0; i < n; i++) resultado.at(i, 0) = x[i];
+    return resultado;
+}
+
+/**
+ * @brief z = M⁻¹·r, o z = r si no hay precondicionador.
+ */
+void precondicionar(const Precondicionador* precondicionador, const double* r, double* z, int n) {
+    if (precondicionador != nullptr) {
+        precondicionador->aplicar(r, z);
+    } else {
+        std::copy(r, r + n, z);
+    }
+}
+
+} // namespace
+
+Matrix gradienteConjugado(const OperadorLineal& A, const Matrix& b, const OpcionesIterativas& opciones,
+                          const Precondicionador* precondicionador) {
+    int n = A.getSize();
+    SesionRendimiento sesion(destinoRendimiento(opciones));
+    std::unique_ptr<double[]> terminos = std::make_unique<double[]>(n);
+    std::unique_ptr<double[]> x = std::make_unique<double[]>(n);
+    prepararSistema(A, b, opciones, precondicionador, terminos.get(), x.get());
+
+    std::unique_ptr<double[]> r = std::make_unique<double[]>(n);
+    std::unique_ptr<double[]> z = std::make_unique<double[]>(n);
+    std::unique_ptr<double[]> p = std::make_unique<double[]>(n);
+    std::unique_ptr<double[]> Ap = std::make_unique<double[]>(n);
+
+    aplicarOperador(A, x.get(), Ap.get());
+    for (int i = 0; i < n; i++) r[i] = terminos[i] - Ap[i];
+
+    ControlParada control(opciones, normaInfinito(terminos.get(), n));
+    precondicionar(precondicionador, r.get(), z.get(), n);
+    std::copy(z.get(), z.get() + n, p.get());
+    double rz = producto(r.get(), z.get(), n);
+    if (normaInfinito(r.get(), n) == 0.0) {
+        // La aproximación inicial ya es la solución exacta
+        return aVector(x.get(), n);
+    }
+
+    for (int iter = 0; iter < opciones.maxIter; iter++) {
+        aplicarOperador(A, p.get(), Ap.get());
+        double curvatura = producto(p.get(), Ap.get(), n);
+        if (!(curvatura > 0.0)) {
+            throw std::runtime_error("El gradiente conjugado requiere una matriz (y precondicionador) definida positiva.");
+        }
+        double alfa = rz / curvatura;
+        for (int i = 0; i < n; i++) {
+            x[i] += alfa * p[i];
+            r[i] -= alfa * Ap[i];
+        }
+        if (control.evaluar(ResultadoBarrido{std::abs(alfa) * normaInfinito(p.get(), n), normaInfinito(r.get(), n)})) {
+            return aVector(x.get(), n);
+        }
+        precondicionar(precondicionador, r.get(), z.get(), n);
+        double rzNuevo = producto(r.get(), z.get(), n);
+        double beta = rzNuevo / rz;
+        rz = rzNuevo;
+        for (int i = 0; i < n; i++) p[i] = z[i] + beta * p[i];
+    }
+    control.noConvergio();
+}
+
+Matrix bicgstab(const OperadorLineal& A, const Matrix& b, const OpcionesIterativas& opciones,
+                const Precondicionador* precondicionador) {
+    int n = A.getSize();
+    SesionRendimiento sesion(destinoRendimiento(opciones));
+    std::unique_ptr<double[]> terminos = std::make_unique<double[]>(n);
+    std::unique_ptr<double[]> x = std::make_unique<double[]>(n);
+    prepararSistema(A, b, opciones, precondicionador, terminos.get(), x.get());
+
+    std::unique_ptr<double[]> r = std::make_unique<double[]>(n);
+    std::unique_ptr<double[]> sombra = std::make_unique<double[]>(n);
+    std::unique_ptr<double[]> p = std::make_unique<double[]>(n);
+    std::unique_ptr<double[]> v = std::make_unique<double[]>(n);
+    std::unique_ptr<double[]> s = std::make_unique<double[]>(n);
+    std::unique_ptr<double[]> t = std::make_unique<double[]>(n);
+    std::unique_ptr<double[]> pGorro = std::make_unique<double[]>(n);
+    std::unique_ptr<double[]> sGorro = std::make_unique<double[]>(n);
+    double normaB = normaInfinito(terminos.get(), n);
+    double rho = 1.0, alfa = 1.0, omega = 1.0;
+
+    // Reinicia la recurrencia desde el residuo verdadero b - A·x; devuelve su norma infinito
+    auto reiniciar = [&]() {
+        aplicarOperador(A, x.get(), v.get());
+        for (int i = 0; i < n; i++) {
+            r[i] = terminos[i] - v[i];
+            sombra[i] = r[i];
+            p[i] = 0.0;
+            v[i] = 0.0;
+        }
+        rho = alfa = omega = 1.0;
+        return normaInfinito(r.get(), n);
+    };
+    if (reiniciar() == 0.0) {
+        return aVector(x.get(), n);
+    }
+
+    ControlParada control(opciones, normaB);
+    int reiniciosSeguidos = 0;
+    for (int iter = 0; iter < opciones.maxIter; iter++) {
+        double rhoNuevo = producto(sombra.get(), r.get(), n);
+        double denominador = 0.0;
+        if (rhoNuevo != 0.0) {
+            double beta = (rhoNuevo / rho) * (alfa / omega);
+            for (int i = 0; i < n; i++) p[i] = r[i] + beta * (p[i] - omega * v[i]);
+            precondicionar(precondicionador, p.get(), pGorro.get(), n);
+            aplicarOperador(A, pGorro.get(), v.get());
+            denominador = producto(sombra.get(), v.get(), n);
+        }
+        if (rhoNuevo == 0.0 || denominador == 0.0) {
+            // Interrupción de la recurrencia: se reinicia una vez; si persiste, el método no puede continuar
+            if (++reiniciosSeguidos > 1) {
+                throw std::runtime_error("BiCGSTAB se interrumpió (ρ = 0); pruebe con otro precondicionador.");
+            }
+            reiniciar();
+            continue;
+        }
+        rho = rhoNuevo;
+        alfa = rho / denominador;
+        for (int i = 0; i < n; i++) s[i] = r[i] - alfa * v[i];
+
+        precondicionar(precondicionador, s.get(), sGorro.get(), n);
+        aplicarOperador(A, sGorro.get(), t.get());
+        double tt = producto(t.get(), t.get(), n);
+        // Si s ya es cero el medio paso es la solución y ω no hace falta
+        omega = tt > 0.0 ? producto(t.get(), s.get(), n) / tt : 0.0;
+
+        ResultadoBarrido resultado{0.0, 0.0};
+        for (int i = 0; i < n; i++) {
+            double paso = alfa * pGorro[i] + omega * sGorro[i];
+            x[i] += paso;
+            r[i] = s[i] - omega * t[i];
+            resultado.cambio = std::max(resultado.cambio, std::abs(paso));
+            resultado.residuo = std::max(resultado.residuo, std::abs(r[i]));
+        }
+        reiniciosSeguidos = 0;
+        if (control.evaluar(resultado)) {
+            if (control.interrumpido()) {
+                return aVector(x.get(), n);
+            }
+            // El residuo por recurrencia puede separarse del verdadero; solo se acepta si este también cumple
+            double verdadero = reiniciar();
+            double medida = opciones.criterio == CriterioParada::ResiduoRelativo && normaB > 0.0 ? verdadero / normaB : verdadero;
+            if (opciones.criterio == CriterioParada::Actualizacion || medida < opciones.tolerancia) {
+                return aVector(x.get(), n);
+            }
+        } else if (omega == 0.0) {
+            reiniciar();
+        }
+    }
+    control.noConvergio();
+}
+
+Matrix richardsonPrecondicionado(const OperadorLineal& A, const Matrix& b, const OpcionesIterativas& opciones,
+                                 const Precondicionador& precondicionador) {
+    int n = A.getSize();
+    SesionRendimiento sesion(destinoRendimiento(opciones));
+    std::unique_ptr<double[]> terminos = std::make_unique<double[]>(n);
+    std::unique_ptr<double[]> x = std::make_unique<double[]>(n);
+    prepararSistema(A, b, opciones, &precondicionador, terminos.get(), x.get());
+
+    std::unique_ptr<double[]> r = std::make_unique<double[]>(n);
+    std::unique_ptr<double[]> z = std::make_unique<double[]>(n);
+    ControlParada control(opciones, normaInfinito(terminos.get(), n));
+    for (int iter = 0; iter < opciones.maxIter; iter++) {
+        aplicarOperador(A, x.get(), r.get());
+        for (int i = 0; i < n; i++) r[i] = terminos[i] - r[i];
+        precondicionador.aplicar(r.get(), z.get());
+        for (int i = 0; i < n; i++) x[i] += z[i];
+        // El residuo medido es el de la iteración anterior, como en el barrido de Jacobi
+        if (control.evaluar(ResultadoBarrido{normaInfinito(z.get(), n), normaInfinito(r.get(), n)})) {
+            return aVector(x.get(), n);
+        }
+    }
+    control.noConvergio();
+}
+
+Matrix gradienteConjugado(const SparseMatrix& A, const Matrix& b, const OpcionesIterativas& opciones,
+                          const Precondicionador* precondicionador) {
+    return gradienteConjugado(OperadorDisperso(A), b, opciones, precondicionador);
+}
+
+Matrix bicgstab(const SparseMatrix& A, const Matrix& b, const OpcionesIterativas& opciones,
+                const Precondicionador* precondicionador) {
+    return bicgstab(OperadorDisperso(A), b, opciones, precondicionador);
+}
+
+Matrix richardsonPrecondicionado(const SparseMatrix& A, const Matrix& b, const OpcionesIterativas& opciones,
+                                 const Precondicionador& precondicionador) {
+    return richardsonPrecondicionado(OperadorDisperso(A), b, opciones, precondicionador);
+}
@@ -0,0 +1,93 @@
+/**
+ * @file Krylov.hpp
+ * @brief Declaración de los métodos de subespacios de Krylov (y de Richardson precondicionado) para matrices dispersas.
+ *
+ * A diferencia de Jacobi y Gauss-Seidel, estos métodos construyen la solución en el subespacio generado
+ * por los residuos y convergen en un número de iteraciones que depende del número de condición de la
+ * matriz precondicionada, no de su tamaño.
+ */
+#ifndef KRYLOV_HPP
+#define KRYLOV_HPP
+
+#include "Matrix.hpp"
+#include "SparseMatrix.hpp"
+#include "IterativeOptions.hpp"
+#include "Preconditioner.hpp"
+#include "LinearOperator.hpp"
+
+/**
+ * @brief Resuelve A·x = b mediante el gradiente conjugado precondicionado.
+ *
+ * Requiere que A sea simétrica definida positiva y que el precondicionador también lo sea. Usa la tolerancia,
+ * el criterio de parada, las iteraciones máximas, la aproximación inicial y las estadísticas de `opciones`;
+ * el residuo es el que el método actualiza por recurrencia y el cambio es el tamaño del paso.
+ *
+ * @param A Matriz dispersa simétrica definida positiva (no se modifica).
+ * @param b Vector columna de términos independientes (no se modifica).
+ * @param opciones Opciones de la iteración (la aceleración se ignora).
+ * @param precondicionador Precondicionador a utilizar; nullptr equivale a la identidad.
+ * @return Matrix Vector solución del sistema.
+ *
+ * @throw std::invalid_argument Si las dimensiones no son compatibles.
+ * @throw std::runtime_error Si el método no converge, diverge o la matriz no es definida positiva.
+ */
+Matrix gradienteConjugado(const SparseMatrix& A, const Matrix& b, const OpcionesIterativas& opciones,
+                          const Precondicionador* precondicionador = nullptr);
+
+/**
+ * @brief Gradiente conjugado precondicionado sobre un operador lineal simétrico definido positivo.
+ *
+ * Solo usa OperadorLineal::aplicar, por lo que el operador puede aplicarse al vuelo sin formar la matriz.
+ */
+Matrix gradienteConjugado(const OperadorLineal& A, const Matrix& b, const OpcionesIterativas& opciones,
+                          const Precondicionador* precondicionador = nullptr);
+
+/**
+ * @brief Resuelve A·x = b mediante BiCGSTAB con precondicionamiento por la derecha.
+ *
+ * Sirve para matrices no simétricas. El residuo es el que el método actualiza por recurrencia y el cambio
+ * es el tamaño del paso completo de cada iteración.
+ *
+ * @param A Matriz dispersa cuadrada (no se modifica).
+ * @param b Vector columna de términos independientes (no se modifica).
+ * @param opciones Opciones de la iteración (la aceleración se ignora).
+ * @param precondicionador Precondicionador a utilizar; nullptr equivale a la identidad.
+ * @return Matrix Vector solución del sistema.
+ *
+ * @throw std::invalid_argument Si las dimensiones no son compatibles.
+ * @throw std::runtime_error Si el método no converge, diverge o sufre una interrupción (ρ = 0).
+ */
+Matrix bicgstab(const SparseMatrix& A, const Matrix& b, const OpcionesIterativas& opciones,
+                const Precondicionador* precondicionador = nullptr);
+
+/**
+ * @brief BiCGSTAB con precondicionamiento por la derecha sobre un operador lineal.
+ */
+Matrix bicgstab(const OperadorLineal& A, const Matrix& b, const OpcionesIterativas& opciones,
+                const Precondicionador* precondicionador = nullptr);
+
+/**
+ * @brief Iteración estacionaria precondicionada (Richardson): x ← x + M⁻¹·(b - A·x).
+ *
+ * Con el precondicionador de Jacobi es el método de Jacobi; con una factorización incompleta converge en
+ * sistemas para los que Jacobi y Gauss-Seidel no lo hacen, siempre que ρ(I - M⁻¹·A) < 1.
+ *
+ * @param A Matriz dispersa cuadrada (no se modifica).
+ * @param b Vector columna de términos independientes (no se modifica).
+ * @param opciones Opciones de la iteración (la aceleración se ignora).
+ * @param precondicionador Precondicionador M.
+ * @return Matrix Vector solución del sistema.
+ *
+ * @throw std::invalid_argument Si las dimensiones no son compatibles.
+ * @throw std::runtime_error Si el método no converge, diverge o se estanca.
+ */
+Matrix richardsonPrecondicionado(const SparseMatrix& A, const Matrix& b, const OpcionesIterativas& opciones,
+                                 const Precondicionador& precondicionador);
+
+/**
+ * @brief Iteración de Richardson precondicionada sobre un operador lineal.
+ */
+Matrix richardsonPrecondicionado(const OperadorLineal& A, const Matrix& b, const OpcionesIterativas& opciones,
+                                 const Precondicionador& precondicionador);
+
+#endif
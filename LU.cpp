@@ -0,0 +1,328 @@
+/**
+ * @file LU.cpp
+ * @brief Implementación de la clase FactorizacionLU con actualizaciones de rango bajo.
+ *
+ * @section features_sec Características principales
+ * -Factorización PA = LU con pivoteo parcial que conserva la matriz original.
+ * -Soluciones repetidas en O(n²) reutilizando los factores.
+ * -Correcciones de rango k por Sherman-Morrison-Woodbury en O(n²·k) y refactorización automática
+ *  cuando el rango acumulado o el residuo lo requieren.
+ */
+#include "LU.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include "ExecutionControl.hpp"
+#include "PerfCounters.hpp"
+
+FactorizacionLU::FactorizacionLU(const Matrix& A, int rangoMaximo, double toleranciaResiduo)
+    : n(A.getRows()), maxRango(rangoMaximo), toleranciaResiduo(toleranciaResiduo), actual(A), factores(A),
+      rango(0), U(A.getRows(), std::max(1, rangoMaximo)), V(A.getRows(), std::max(1, rangoMaximo)),
+      Z(A.getRows(), std::max(1, rangoMaximo)), capacitancia(std::max(1, rangoMaximo), std::max(1, rangoMaximo)),
+      factorizacionesCompletas(0) {
+    if (A.getCols() != n) {
+        throw std::invalid_argument("La factorización LU requiere una matriz cuadrada.");
+    }
+    if (maxRango <= 0) {
+        throw std::invalid_argument("El rango máximo de las actualizaciones debe ser positivo.");
+    }
+    pivotesCapacitancia = std::make_unique<int[]>(maxRango);
+    factorizar(actual);
+}
+
+int FactorizacionLU::getSize() const {
+    return n;
+}
+
+int FactorizacionLU::getRangoAcumulado() const {
+    return rango;
+}
+
+int FactorizacionLU::getFactorizacionesCompletas() const {
+    return factorizacionesCompletas;
+}
+
+const Matrix& FactorizacionLU::getMatriz() const {
+    return actual;
+}
+
+/**
+ * @brief Factoriza `matriz` con pivoteo parcial (A₀ ← matriz) y descarta las correcciones.
+ *
+ * La factorización se hace en copias; `factores`, `pivotes` y `rango` solo se reemplazan si termina, de modo que
+ * si lanza una excepción el objeto conserva la factorización anterior.
+ *
+ * @throw std::runtime_error Si algún pivote es menor a la tolerancia o la solución se cancela o vence su plazo.
+ */
+void FactorizacionLU::factorizar(const Matrix& matriz) {
+    const double TOLERANCIA = 1e-12;
+    RegionRendimiento region(RegionMedida::Eliminacion, 2.0 * n * n * n / 3.0);
+    Matrix nuevos(matriz);
+    std::unique_ptr<int[]> nuevosPivotes = std::make_unique<int[]>(n);
+    for (int i = 0; i < n; i++) nuevosPivotes[i] = i;
+
+    for (int column = 0; column < n; column++) {
+        verificarInterrupcion(RegionMedida::Eliminacion, column, n);
+        // 1. Encontrar fila con el mayor pivote
+        int maxRow = column;
+        for (int row = column + 1; row < n; row++) {
+            if (std::abs(nuevos.at(row, column)) > std::abs(nuevos.at(maxRow, column))) {
+                maxRow = row;
+            }
+        }
+        if (std::abs(nuevos.at(maxRow, column)) < TOLERANCIA) {
+            throw std::runtime_error("El sistema es numéricamente inestable o no tiene solución única.");
+        }
+
+        // 2. Intercambiar filas completas (incluidos los multiplicadores de L ya guardados)
+        if (maxRow != column) {
+            nuevos.intercambiarFilas(column, maxRow);
+            std::swap(nuevosPivotes[column], nuevosPivotes[maxRow]);
+        }
+
+        // 3. Guardar multiplicadores bajo la diagonal y actualizar el resto de la submatriz
+        double pivote = nuevos.at(column, column);
+        for (int row = column + 1; row < n; row++) {
+            double factor = nuevos.at(row, column) / pivote;
+            nuevos.at(row, column) = factor;
+            for (int col = column + 1; col < n; col++) {
+                nuevos.at(row, col) -= factor * nuevos.at(column, col);
+            }
+        }
+    }
+    factores = std::move(nuevos);
+    pivotes = std::move(nuevosPivotes);
+    rango = 0;
+    factorizacionesCompletas++;
+}
+
+/**
+ * @brief Resuelve A₀·x = b en el lugar: al entrar `x` contiene b y al salir la solución.
+ */
+void FactorizacionLU::resolverBase(double* x) const {
+    RegionRendimiento region(RegionMedida::Sustitucion, 2.0 * n * n);
+    std::unique_ptr<double[]> permutado = std::make_unique<double[]>(n);
+    for (int i = 0; i < n; i++) permutado[i] = x[pivotes[i]];
+
+    // Sustitución progresiva con L (diagonal unitaria)
+    for (int row = 0; row < n; row++) {
+        double sum = permutado[row];
+        for (int col = 0; col < row; col++) {
+            sum -= factores.at(row, col) * permutado[col];
+        }
+        permutado[row] = sum;
+    }
+    // Sustitución regresiva con U
+    for (int row = n - 1; row >= 0; row--) {
+        double sum = permutado[row];
+        for (int col = row + 1; col < n; col++) {
+            sum -= factores.at(row, col) * permutado[col];
+        }
+        permutado[row] = sum / factores.at(row, row);
+    }
+    for (int i = 0; i < n; i++) x[i] = permutado[i];
+}
+
+/**
+ * @brief Forma y factoriza la matriz de capacitancia C = I + VᵀZ de tamaño k x k.
+ *
+ * @return false si C es singular (la matriz vigente lo es o la corrección perdió precisión).
+ */
+bool FactorizacionLU::factorizarCapacitancia() {
+    const double TOLERANCIA = 1e-12;
+    for (int p = 0; p < rango; p++) {
+        for (int q = 0; q < rango; q++) {
+            double suma = p == q ? 1.0 : 0.0;
+            for (int i = 0; i < n; i++) suma += V.at(i, p) * Z.at(i, q);
+            capacitancia.at(p, q) = suma;
+        }
+        pivotesCapacitancia[p] = p;
+    }
+    for (int column = 0; column < rango; column++) {
+        int maxRow = column;
+        for (int row = column + 1; row < rango; row++) {
+            if (std::abs(capacitancia.at(row, column)) > std::abs(capacitancia.at(maxRow, column))) {
+                maxRow = row;
+            }
+        }
+        if (std::abs(capacitancia.at(maxRow, column)) < TOLERANCIA) {
+            return false;
+        }
+        if (maxRow != column) {
+            capacitancia.intercambiarFilas(column, maxRow);
+            std::swap(pivotesCapacitancia[column], pivotesCapacitancia[maxRow]);
+        }
+        for (int row = column + 1; row < rango; row++) {
+            double factor = capacitancia.at(row, column) / capacitancia.at(column, column);
+            capacitancia.at(row, column) = factor;
+            for (int col = column + 1; col < rango; col++) {
+                capacitancia.at(row, col) -= factor * capacitancia.at(column, col);
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Residuo relativo ||b - A·x||∞ / (||A||∞·||x||∞ + ||b||∞) con la matriz vigente.
+ */
+double FactorizacionLU::residuoRelativo(const Matrix& b, const Matrix& x) const {
+    double residuo = 0.0, normaA = 0.0, normaX = 0.0, normaB = 0.0;
+    for (int i = 0; i < n; i++) {
+        double suma = 0.0, sumaAbs = 0.0;
+        for (int j = 0; j < n; j++) {
+            suma += actual.at(i, j) * x.at(j, 0);
+            sumaAbs += std::abs(actual.at(i, j));
+        }
+        residuo = std::max(residuo, std::abs(b.at(i, 0) - suma));
+        normaA = std::max(normaA, sumaAbs);
+        normaX = std::max(normaX, std::abs(x.at(i, 0)));
+        normaB = std::max(normaB, std::abs(b.at(i, 0)));
+    }
+    double escala = normaA * normaX + normaB;
+    return escala > 0.0 ? residuo / escala : residuo;
+}
+
+/**
+ * @brief Resuelve A·x = b con la matriz vigente mediante Sherman-Morrison-Woodbury.
+ *
+ * @param b Vector columna de términos independientes (no se modifica).
+ * @return Matrix Vector solución del sistema.
+ *
+ * @throws std::invalid_argument Si b no tiene n filas.
+ * @throws std::runtime_error Si la matriz vigente es singular.
+ */
+Matrix FactorizacionLU::resolver(const Matrix& b) {
+    if (b.getRows() != n || b.getCols() != 1) {
+        throw std::invalid_argument("El vector b no coincide con el tamaño del sistema factorizado.");
+    }
+    std::unique_ptr<double[]> x = std::make_unique<double[]>(n);
+    for (int i = 0; i < n; i++) x[i] = b.at(i, 0);
+    resolverBase(x.get());
+
+    if (rango > 0) {
+        // s = C⁻¹·(Vᵀ·y), con y = A₀⁻¹b ya en x
+        std::unique_ptr<double[]> t = std::make_unique<double[]>(rango);
+        std::unique_ptr<double[]> s = std::make_unique<double[]>(rango);
+        for (int p = 0; p < rango; p++) {
+            double suma = 0.0;
+            for (int i = 0; i < n; i++) suma += V.at(i, p) * x[i];
+            t[p] = suma;
+        }
+        for (int p = 0; p < rango; p++) {
+            double suma = t[pivotesCapacitancia[p]];
+            for (int q = 0; q < p; q++) suma -= capacitancia.at(p, q) * s[q];
+            s[p] = suma;
+        }
+        for (int p = rango - 1; p >= 0; p--) {
+            double suma = s[p];
+            for (int q = p + 1; q < rango; q++) suma -= capacitancia.at(p, q) * s[q];
+            s[p] = suma / capacitancia.at(p, p);
+        }
+        // x = y - Z·s
+        for (int i = 0; i < n; i++) {
+            double correccion = 0.0;
+            for (int p = 0; p < rango; p++) correccion += Z.at(i, p) * s[p];
+            x[i] -= correccion;
+        }
+    }
+
+    Matrix solucion(n, 1);
+    for (int i = 0; i < n; i++) solucion.at(i, 0) = x[i];
+
+    if (toleranciaResiduo > 0.0 && rango > 0 && residuoRelativo(b, solucion) > toleranciaResiduo) {
+        // Las correcciones acumuladas degradaron la precisión: se factoriza de nuevo y se repite
+        refactorizar();
+        return resolver(b);
+    }
+    return solucion;
+}
+
+/**
+ * @brief Aplica la corrección de rango k: A ← A + Uk·Vkᵀ.
+ *
+ * @param Uk Matriz de n x k.
+ * @param Vk Matriz de n x k.
+ *
+ * @throws std::invalid_argument Si las dimensiones no son compatibles.
+ * @throws std::runtime_error Si la matriz resultante es singular; la factorización queda como antes de la llamada.
+ */
+void FactorizacionLU::actualizar(const Matrix& Uk, const Matrix& Vk) {
+    int k = Uk.getCols();
+    if (Uk.getRows() != n || Vk.getRows() != n || Vk.getCols() != k) {
+        throw std::invalid_argument("Las dimensiones de la corrección no son compatibles con el sistema.");
+    }
+    // La matriz vigente solo se reemplaza si la corrección se aplica sin errores
+    Matrix nueva(actual);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            double suma = 0.0;
+            for (int p = 0; p < k; p++) suma += Uk.at(i, p) * Vk.at(j, p);
+            nueva.at(i, j) += suma;
+        }
+    }
+
+    if (rango + k > maxRango) {
+        factorizar(nueva);
+        actual = std::move(nueva);
+        return;
+    }
+
+    // Las columnas nuevas de U, V y Z quedan después de las vigentes y no cuentan hasta actualizar `rango`
+    int rangoAnterior = rango;
+    std::unique_ptr<double[]> columna = std::make_unique<double[]>(n);
+    for (int p = 0; p < k; p++) {
+        int destino = rangoAnterior + p;
+        for (int i = 0; i < n; i++) {
+            U.at(i, destino) = Uk.at(i, p);
+            V.at(i, destino) = Vk.at(i, p);
+            columna[i] = Uk.at(i, p);
+        }
+        resolverBase(columna.get());
+        for (int i = 0; i < n; i++) Z.at(i, destino) = columna[i];
+    }
+    rango = rangoAnterior + k;
+    if (!factorizarCapacitancia()) {
+        try {
+            factorizar(nueva);
+        } catch (...) {
+            // Se restaura la capacitancia de las correcciones anteriores, que ya se había factorizado sin problemas
+            rango = rangoAnterior;
+            factorizarCapacitancia();
+            throw;
+        }
+    }
+    actual = std::move(nueva);
+}
+
+void FactorizacionLU::actualizarElemento(int row, int col, double delta) {
+    if (row < 0 || row >= n || col < 0 || col >= n) {
+        throw std::out_of_range("Índices fuera de rango");
+    }
+    Matrix Uk(n, 1), Vk(n, 1);
+    Uk.at(row, 0) = delta;
+    Vk.at(col, 0) = 1.0;
+    actualizar(Uk, Vk);
+}
+
+void FactorizacionLU::actualizarFila(int row, const Matrix& delta) {
+    if (row < 0 || row >= n) {
+        throw std::out_of_range("Índice fuera de rango");
+    }
+    Matrix Uk(n, 1);
+    Uk.at(row, 0) = 1.0;
+    actualizar(Uk, delta);
+}
+
+void FactorizacionLU::actualizarColumna(int col, const Matrix& delta) {
+    if (col < 0 || col >= n) {
+        throw std::out_of_range("Índice fuera de rango");
+    }
+    Matrix Vk(n, 1);
+    Vk.at(col, 0) = 1.0;
+    actualizar(delta, Vk);
+}
+
+void FactorizacionLU::refactorizar() {
+    factorizar(actual);
+}
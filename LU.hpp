@@ -0,0 +1,131 @@
+/**
+ * @file LU.hpp
+ * @brief Declaración de la clase FactorizacionLU: factorización LU reutilizable con actualizaciones de rango bajo.
+ *
+ * A diferencia de gaussElimination, la factorización conserva una copia de la matriz original y de sus factores,
+ * de modo que el mismo sistema puede resolverse con muchos vectores b en O(n²) cada uno. Cuando cambian unos
+ * pocos coeficientes, filas o columnas de A, la corrección se aplica con la fórmula de Sherman-Morrison-Woodbury
+ * en O(n²·k) en lugar de volver a factorizar en O(n³).
+ */
+#ifndef LU_HPP
+#define LU_HPP
+
+#include <memory>
+#include "Matrix.hpp"
+
+/**
+ * @class FactorizacionLU
+ * @brief Factorización PA = LU con pivoteo parcial y correcciones acumuladas de rango bajo.
+ *
+ * La matriz actual se representa como A = A₀ + U·Vᵀ, donde A₀ es la matriz de la última factorización completa
+ * y U, V tienen tantas columnas como el rango acumulado k de las actualizaciones. Cada solución usa
+ * Sherman-Morrison-Woodbury:
+ * @code
+ *   x = A₀⁻¹b - Z·(I + VᵀZ)⁻¹·Vᵀ·A₀⁻¹b,   con Z = A₀⁻¹U
+ * @endcode
+ * La factorización se rehace por completo cuando el rango acumulado alcanza `maxRango`, cuando la matriz
+ * de capacitancia (I + VᵀZ) se vuelve singular o cuando el residuo relativo de una solución supera
+ * `toleranciaResiduo`.
+ */
+class FactorizacionLU {
+    private:
+        int n;
+        int maxRango;
+        double toleranciaResiduo;
+        Matrix actual;                     // Matriz A vigente (A₀ + U·Vᵀ), para refactorizar y medir residuos. //
+        Matrix factores;                   // L (unitaria, bajo la diagonal) y U (sobre la diagonal) de A₀. //
+        std::unique_ptr<int[]> pivotes;    // Fila i de P·A₀ = fila pivotes[i] de A₀. //
+        int rango;                         // Columnas usadas de U, V y Z. //
+        Matrix U, V, Z;                    // Corrección U·Vᵀ y Z = A₀⁻¹U, de n x maxRango. //
+        Matrix capacitancia;               // Factores LU de (I + VᵀZ), de k x k. //
+        std::unique_ptr<int[]> pivotesCapacitancia;
+        int factorizacionesCompletas;
+
+        void factorizar(const Matrix& matriz);
+        void resolverBase(double* x) const;
+        bool factorizarCapacitancia();
+        double residuoRelativo(const Matrix& b, const Matrix& x) const;
+    public:
+        /**
+        * @brief Factoriza una copia de la matriz A (A no se modifica).
+        *
+        * @param A Matriz cuadrada de coeficientes.
+        * @param rangoMaximo Rango acumulado máximo antes de refactorizar por completo.
+        * @param toleranciaResiduo Residuo relativo máximo aceptado antes de refactorizar; 0 desactiva la verificación.
+        *
+        * @throws std::invalid_argument Si A no es cuadrada o rangoMaximo no es positivo.
+        * @throws std::runtime_error Si A es singular o numéricamente inestable.
+        */
+        explicit FactorizacionLU(const Matrix& A, int rangoMaximo = 16, double toleranciaResiduo = 1e-10);
+
+        /**
+        * @brief Devuelve el número de ecuaciones del sistema factorizado.
+        */
+        int getSize() const;
+
+        /**
+        * @brief Devuelve el rango acumulado de las actualizaciones desde la última factorización completa.
+        */
+        int getRangoAcumulado() const;
+
+        /**
+        * @brief Devuelve cuántas factorizaciones completas O(n³) se han realizado (incluida la inicial).
+        */
+        int getFactorizacionesCompletas() const;
+
+        /**
+        * @brief Devuelve la matriz A vigente, con todas las actualizaciones aplicadas.
+        */
+        const Matrix& getMatriz() const;
+
+        /**
+        * @brief Resuelve A·x = b con la matriz vigente en O(n² + n·k).
+        *
+        * Si la verificación de residuo está activa y la solución no es lo bastante precisa, refactoriza
+        * la matriz vigente y vuelve a resolver.
+        *
+        * @param b Vector columna de términos independientes (no se modifica).
+        * @return Matrix Vector solución del sistema.
+        *
+        * @throws std::invalid_argument Si b no tiene n filas.
+        * @throws std::runtime_error Si la matriz vigente es singular.
+        */
+        Matrix resolver(const Matrix& b);
+
+        /**
+        * @brief Aplica la corrección de rango k: A ← A + Uk·Vkᵀ.
+        *
+        * @param Uk Matriz de n x k.
+        * @param Vk Matriz de n x k.
+        *
+        * @throws std::invalid_argument Si las dimensiones no son compatibles.
+        * @throws std::runtime_error Si la matriz resultante es singular o la refactorización se interrumpe; en ese
+        *         caso la matriz vigente y su factorización quedan como antes de la llamada.
+        */
+        void actualizar(const Matrix& Uk, const Matrix& Vk);
+
+        /**
+        * @brief Suma `delta` al coeficiente (i,j): corrección de rango 1.
+        */
+        void actualizarElemento(int row, int col, double delta);
+
+        /**
+        * @brief Suma `delta` (vector de n x 1) a la fila `row`: corrección de rango 1.
+        */
+        void actualizarFila(int row, const Matrix& delta);
+
+        /**
+        * @brief Suma `delta` (vector de n x 1) a la columna `col`: corrección de rango 1.
+        */
+        void actualizarColumna(int col, const Matrix& delta);
+
+        /**
+        * @brief Descarta las correcciones acumuladas y factoriza de nuevo la matriz vigente en O(n³).
+        *
+        * @throws std::runtime_error Si la matriz vigente es singular o la factorización se interrumpe; la
+        *         factorización anterior se conserva.
+        */
+        void refactorizar();
+};
+
+#endif
@@ -0,0 +1,180 @@
+/**
+ * @file LinearOperator.cpp
+ * @brief Implementación de los adaptadores de OperadorLineal.
+ *
+ * @section features_sec Características principales
+ * -Adaptadores sin copia para Matrix y SparseMatrix.
+ * -Operadores definidos por funciones del usuario.
+ * -Stencil de cinco puntos aplicado al vuelo, sin almacenar la matriz.
+ */
+#include "LinearOperator.hpp"
+#include <utility>
+
+OperadorMatriz::OperadorMatriz(const Matrix& A) : A(A) {
+    if (A.getRows() != A.getCols()) {
+        throw std::invalid_argument("El operador requiere una matriz cuadrada.");
+    }
+}
+
+int OperadorMatriz::getSize() const {
+    return A.getRows();
+}
+
+void OperadorMatriz::aplicar(const double* x, double* y) const {
+    int n = A.getRows();
+    for (int i = 0; i < n; i++) {
+        const double* fila = &A.at(i, 0);
+        double suma = 0.0;
+        for (int j = 0; j < n; j++) suma += fila[j] * x[j];
+        y[i] = suma;
+    }
+}
+
+void OperadorMatriz::diagonal(double* d) const {
+    for (int i = 0; i < A.getRows(); i++) d[i] = A.at(i, i);
+}
+
+bool OperadorMatriz::tieneFilas() const {
+    return true;
+}
+
+double OperadorMatriz::sumaFueraDiagonal(int i, const double* x) const {
+    int n = A.getRows();
+    const double* fila = &A.at(i, 0);
+    double suma = 0.0;
+    for (int j = 0; j < i; j++) suma += fila[j] * x[j];
+    for (int j = i + 1; j < n; j++) suma += fila[j] * x[j];
+    return suma;
+}
+
+double OperadorMatriz::operacionesProducto() const {
+    return 2.0 * A.getRows() * A.getRows();
+}
+
+OperadorDisperso::OperadorDisperso(const SparseMatrix& A) : A(A) {
+    if (A.getRows() != A.getCols()) {
+        throw std::invalid_argument("El operador requiere una matriz cuadrada.");
+    }
+}
+
+int OperadorDisperso::getSize() const {
+    return A.getRows();
+}
+
+void OperadorDisperso::aplicar(const double* x, double* y) const {
+    A.multiplicar(x, y);
+}
+
+void OperadorDisperso::diagonal(double* d) const {
+    A.diagonal(d);
+}
+
+bool OperadorDisperso::tieneFilas() const {
+    return true;
+}
+
+double OperadorDisperso::sumaFueraDiagonal(int i, const double* x) const {
+    const int* inicio = A.getInicioFila();
+    const int* columnas = A.getColumnas();
+    const double* valores = A.getValores();
+    double suma = 0.0;
+    for (int k = inicio[i]; k < inicio[i + 1]; k++) {
+        if (columnas[k] != i) suma += valores[k] * x[columnas[k]];
+    }
+    return suma;
+}
+
+double OperadorDisperso::operacionesProducto() const {
+    return 2.0 * A.getNoCeros();
+}
+
+OperadorFunciones::OperadorFunciones(int size, FuncionAplicar aplicar, FuncionDiagonal diagonal, FuncionFila fila)
+    : n(size), funcionAplicar(std::move(aplicar)), funcionDiagonal(std::move(diagonal)), funcionFila(std::move(fila)) {
+    if (size <= 0) {
+        throw std::invalid_argument("El tamaño del operador debe ser positivo.");
+    }
+    if (!funcionAplicar || !funcionDiagonal) {
+        throw std::invalid_argument("El operador necesita las funciones para aplicar A y para obtener su diagonal.");
+    }
+}
+
+int OperadorFunciones::getSize() const {
+    return n;
+}
+
+void OperadorFunciones::aplicar(const double* x, double* y) const {
+    funcionAplicar(x, y);
+}
+
+void OperadorFunciones::diagonal(double* d) const {
+    funcionDiagonal(d);
+}
+
+bool OperadorFunciones::tieneFilas() const {
+    return static_cast<bool>(funcionFila);
+}
+
+double OperadorFunciones::sumaFueraDiagonal(int i, const double* x) const {
+    if (!funcionFila) {
+        return OperadorLineal::sumaFueraDiagonal(i, x);
+    }
+    return funcionFila(i, x);
+}
+
+OperadorStencil5::OperadorStencil5(int nx, int ny, double centro, double oeste, double este, double sur, double norte)
+    : nx(nx), ny(ny), centro(centro), oeste(oeste), este(este), sur(sur), norte(norte) {
+    if (nx <= 0 || ny <= 0) {
+        throw std::invalid_argument("Las dimensiones de la malla deben ser positivas.");
+    }
+}
+
+int OperadorStencil5::getSize() const {
+    return nx * ny;
+}
+
+void OperadorStencil5::aplicar(const double* x, double* y) const {
+    // Los bordes se tratan aparte para que el ciclo interior no tenga comprobaciones
+    for (int fila = 0; fila < ny; fila++) {
+        const double* actual = x + static_cast<size_t>(fila) * nx;
+        const double* abajo = fila > 0 ? actual - nx : nullptr;
+        const double* arriba = fila < ny - 1 ? actual + nx : nullptr;
+        double* salida = y + static_cast<size_t>(fila) * nx;
+        for (int c = 0; c < nx; c++) {
+            double suma = centro * actual[c];
+            if (c > 0) suma += oeste * actual[c - 1];
+            if (c < nx - 1) suma += este * actual[c + 1];
+            salida[c] = suma;
+        }
+        if (abajo != nullptr) {
+            for (int c = 0; c < nx; c++) salida[c] += sur * abajo[c];
+        }
+        if (arriba != nullptr) {
+            for (int c = 0; c < nx; c++) salida[c] += norte * arriba[c];
+        }
+    }
+}
+
+void OperadorStencil5::diagonal(double* d) const {
+    int n = nx * ny;
+    for (int i = 0; i < n; i++) d[i] = centro;
+}
+
+bool OperadorStencil5::tieneFilas() const {
+    return true;
+}
+
+double OperadorStencil5::sumaFueraDiagonal(int i, const double* x) const {
+    int c = i % nx;
+    int fila = i / nx;
+    double suma = 0.0;
+    if (c > 0) suma += oeste * x[i - 1];
+    if (c < nx - 1) suma += este * x[i + 1];
+    if (fila > 0) suma += sur * x[i - nx];
+    if (fila < ny - 1) suma += norte * x[i + nx];
+    return suma;
+}
+
+double OperadorStencil5::operacionesProducto() const {
+    // Cinco productos y cuatro sumas por punto
+    return 9.0 * nx * ny;
+}
@@ -0,0 +1,229 @@
+/**
+ * @file LinearOperator.hpp
+ * @brief Declaración de la interfaz OperadorLineal para resolver sistemas sin formar la matriz.
+ *
+ * Los métodos iterativos solo necesitan aplicar A a un vector, conocer su diagonal y, en Gauss-Seidel,
+ * recorrer una fila a la vez. Un operador ofrece exactamente eso, de modo que un problema de diferencias
+ * finitas puede resolverse aplicando su stencil al vuelo, sin guardar ni una matriz densa de n² valores
+ * ni los índices de una matriz dispersa. Matrix y SparseMatrix se adaptan con OperadorMatriz y
+ * OperadorDisperso; las funciones del usuario con OperadorFunciones u OperadorFilas.
+ */
+#ifndef LINEAR_OPERATOR_HPP
+#define LINEAR_OPERATOR_HPP
+
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include "Matrix.hpp"
+#include "SparseMatrix.hpp"
+
+/**
+ * @class OperadorLineal
+ * @brief Interfaz de un operador lineal cuadrado A de n x n.
+ */
+class OperadorLineal {
+    public:
+        virtual ~OperadorLineal() = default;
+
+        /**
+        * @brief Devuelve n, el número de incógnitas.
+        */
+        virtual int getSize() const = 0;
+
+        /**
+        * @brief Calcula y = A·x (x e y de n elementos y distintos).
+        */
+        virtual void aplicar(const double* x, double* y) const = 0;
+
+        /**
+        * @brief Copia la diagonal de A en `d` (n elementos).
+        */
+        virtual void diagonal(double* d) const = 0;
+
+        /**
+        * @brief Indica si el operador permite recorrer filas con `sumaFueraDiagonal` (lo requiere Gauss-Seidel).
+        */
+        virtual bool tieneFilas() const {
+            return false;
+        }
+
+        /**
+        * @brief Devuelve Σ_{j≠i} a_ij·x_j para la fila i.
+        *
+        * @throws std::logic_error Si el operador no permite acceso por filas.
+        */
+        virtual double sumaFueraDiagonal(int i, const double* x) const {
+            (void)i;
+            (void)x;
+            throw std::logic_error("El operador no permite acceso por filas.");
+        }
+
+        /**
+        * @brief Operaciones de punto flotante de un producto A·x, para las métricas de rendimiento (0 si no se conocen).
+        */
+        virtual double operacionesProducto() const {
+            return 0.0;
+        }
+};
+
+/**
+ * @class OperadorMatriz
+ * @brief Adapta una Matrix cuadrada (sin copiarla; debe seguir existiendo mientras se use el operador).
+ */
+class OperadorMatriz : public OperadorLineal {
+    private:
+        const Matrix& A;
+    public:
+        /**
+        * @throws std::invalid_argument Si la matriz no es cuadrada.
+        */
+        explicit OperadorMatriz(const Matrix& A);
+
+        int getSize() const override;
+        void aplicar(const double* x, double* y) const override;
+        void diagonal(double* d) const override;
+        bool tieneFilas() const override;
+        double sumaFueraDiagonal(int i, const double* x) const override;
+        double operacionesProducto() const override;
+};
+
+/**
+ * @class OperadorDisperso
+ * @brief Adapta una SparseMatrix cuadrada (sin copiarla; debe seguir existiendo mientras se use el operador).
+ */
+class OperadorDisperso : public OperadorLineal {
+    private:
+        const SparseMatrix& A;
+    public:
+        /**
+        * @throws std::invalid_argument Si la matriz no es cuadrada.
+        */
+        explicit OperadorDisperso(const SparseMatrix& A);
+
+        int getSize() const override;
+        void aplicar(const double* x, double* y) const override;
+        void diagonal(double* d) const override;
+        bool tieneFilas() const override;
+        double sumaFueraDiagonal(int i, const double* x) const override;
+        double operacionesProducto() const override;
+};
+
+/**
+ * @class OperadorFunciones
+ * @brief Operador definido por funciones del usuario; el acceso por filas es opcional.
+ */
+class OperadorFunciones : public OperadorLineal {
+    public:
+        using FuncionAplicar = std::function<void(const double*, double*)>;
+        using FuncionDiagonal = std::function<void(double*)>;
+        using FuncionFila = std::function<double(int, const double*)>;
+    private:
+        int n;
+        FuncionAplicar funcionAplicar;
+        FuncionDiagonal funcionDiagonal;
+        FuncionFila funcionFila;
+    public:
+        /**
+        * @param size Número de incógnitas.
+        * @param aplicar Calcula y = A·x.
+        * @param diagonal Escribe la diagonal de A.
+        * @param fila Devuelve Σ_{j≠i} a_ij·x_j; puede omitirse si no se usará Gauss-Seidel.
+        *
+        * @throws std::invalid_argument Si el tamaño no es positivo o falta alguna de las funciones obligatorias.
+        */
+        OperadorFunciones(int size, FuncionAplicar aplicar, FuncionDiagonal diagonal, FuncionFila fila = nullptr);
+
+        int getSize() const override;
+        void aplicar(const double* x, double* y) const override;
+        void diagonal(double* d) const override;
+        bool tieneFilas() const override;
+        double sumaFueraDiagonal(int i, const double* x) const override;
+};
+
+/**
+ * @class OperadorFilas
+ * @brief Operador definido por una plantilla de fila, que el compilador puede expandir en línea.
+ *
+ * `Fila` es cualquier objeto invocable como `double fila(int i, const double* x, double& diagonal)` que
+ * devuelve Σ_{j≠i} a_ij·x_j y escribe a_ii en `diagonal`. `aplicar` recorre todas las filas con la misma
+ * función, por lo que un stencil escrito así no necesita almacenar la matriz.
+ */
+template<typename Fila>
+class OperadorFilas : public OperadorLineal {
+    private:
+        int n;
+        Fila fila;
+    public:
+        OperadorFilas(int size, Fila f) : n(size), fila(std::move(f)) {
+            if (size <= 0) {
+                throw std::invalid_argument("El tamaño del operador debe ser positivo.");
+            }
+        }
+
+        int getSize() const override {
+            return n;
+        }
+
+        void aplicar(const double* x, double* y) const override {
+            for (int i = 0; i < n; i++) {
+                double d;
+                double suma = fila(i, x, d);
+                y[i] = suma + d * x[i];
+            }
+        }
+
+        void diagonal(double* d) const override {
+            std::unique_ptr<double[]> ceros = std::make_unique<double[]>(n);
+            for (int i = 0; i < n; i++) fila(i, ceros.get(), d[i]);
+        }
+
+        bool tieneFilas() const override {
+            return true;
+        }
+
+        double sumaFueraDiagonal(int i, const double* x) const override {
+            double d;
+            return fila(i, x, d);
+        }
+};
+
+/**
+ * @brief Crea un OperadorFilas deduciendo el tipo de la función de fila.
+ */
+template<typename Fila>
+OperadorFilas<Fila> crearOperadorFilas(int size, Fila fila) {
+    return OperadorFilas<Fila>(size, std::move(fila));
+}
+
+/**
+ * @class OperadorStencil5
+ * @brief Stencil de cinco puntos con coeficientes constantes sobre una malla de nx x ny con fronteras de Dirichlet.
+ *
+ * La incógnita del punto (x, y) es la número y·nx + x. Con los valores por defecto es el laplaciano
+ * discreto -Δ (escalado por h²) de la ecuación de Poisson en dos dimensiones.
+ */
+class OperadorStencil5 : public OperadorLineal {
+    private:
+        int nx;
+        int ny;
+        double centro;
+        double oeste;
+        double este;
+        double sur;
+        double norte;
+    public:
+        /**
+        * @throws std::invalid_argument Si alguna dimensión de la malla no es positiva.
+        */
+        OperadorStencil5(int nx, int ny, double centro = 4.0, double oeste = -1.0, double este = -1.0,
+                         double sur = -1.0, double norte = -1.0);
+
+        int getSize() const override;
+        void aplicar(const double* x, double* y) const override;
+        void diagonal(double* d) const override;
+        bool tieneFilas() const override;
+        double sumaFueraDiagonal(int i, const double* x) const override;
+        double operacionesProducto() const override;
+};
+
+#endif
@@ -5,34 +5,91 @@
  * @section features_sec Características principales
  * -Esta clase proporciona métodos para acceder, llenar e imprimir matrices, utilizando punteros inteligentes para una gestión segura de memoria dinámica lo que permite correrlo en cualquier equipo.
  * -Forma parte del módulo de resolución de sistemas de ecuaciones lineales.
+ * -Intercambio de filas en O(1) mediante sus punteros, usado por el pivoteo de los métodos directos.
+ * -Instancias explícitas para elementos float, double, std::complex<float> y std::complex<double>.
  * 
  */
 #include "Matrix.hpp"
 #include <iostream>
 #include <iomanip>
 #include <stdexcept>
+#include <utility>
 #include "validations.hpp"
 
+namespace {
+
+/**
+ * @brief Lee un elemento real desde la consola.
+ */
+template<typename T>
+void leerElemento(T& elemento) {
+    elemento = static_cast<T>(leerDecimal(""));
+}
+
+/**
+ * @brief Lee un elemento complejo desde la consola, primero la parte real y luego la imaginaria.
+ */
+template<typename R>
+void leerElemento(std::complex<R>& elemento) {
+    double real = leerDecimal("Parte real: ");
+    double imaginaria = leerDecimal("Parte imaginaria: ");
+    elemento = std::complex<R>(static_cast<R>(real), static_cast<R>(imaginaria));
+}
+
+} // namespace
+
 /**
- * @brief Constructor de la clase Matrix.
+ * @brief Constructor de la clase BasicMatrix.
  * 
  * Crea una matriz de dimensiones dadas, asignando memoria dinámica utilizando `std::unique_ptr`.
  * 
  * @param r Número de filas.
  * @param c Número de columnas.
  */
-Matrix::Matrix(int r, int c) : rows(r), cols(c) {
-    matriz = std::make_unique<std::unique_ptr<double[]>[]>(rows);
+template<typename T>
+BasicMatrix<T>::BasicMatrix(int r, int c) : rows(r), cols(c) {
+    matriz = std::make_unique<std::unique_ptr<T[]>[]>(rows);
     for (int i = 0; i < rows; i++) {
-        matriz[i] = std::make_unique<double[]>(cols);
+        matriz[i] = std::make_unique<T[]>(cols);
     }
 }
 
-int Matrix::getRows() const{
+/**
+ * @brief Constructor de copia, reserva memoria propia y copia todos los elementos.
+ *
+ * @param other Matriz a copiar.
+ */
+template<typename T>
+BasicMatrix<T>::BasicMatrix(const BasicMatrix& other) : BasicMatrix(other.rows, other.cols) {
+    for (int i = 0; i < rows; i++) {
+        for (int j = 0; j < cols; j++) {
+            matriz[i][j] = other.matriz[i][j];
+        }
+    }
+}
+
+/**
+ * @brief Operador de asignación por copia.
+ *
+ * @param other Matriz a copiar.
+ * @return BasicMatrix& Referencia a esta matriz.
+ */
+template<typename T>
+BasicMatrix<T>& BasicMatrix<T>::operator=(const BasicMatrix& other) {
+    if (this != &other) {  // Evitar auto-asignación
+        BasicMatrix copia(other);
+        *this = std::move(copia);
+    }
+    return *this;
+}
+
+template<typename T>
+int BasicMatrix<T>::getRows() const{
     return rows;
 }
 
-int Matrix::getCols() const{
+template<typename T>
+int BasicMatrix<T>::getCols() const{
     return cols;
 }
 
@@ -43,28 +100,59 @@ int Matrix::getCols() const{
  * 
  * @param row Fila del elemento.
  * @param col Columna del elemento.
- * @return double& Referencia al elemento solicitado.
+ * @return T& Referencia al elemento solicitado.
  * 
  * @throw std::out_of_range Si los índices están fuera de los límites de la matriz.
  */
-double& Matrix::at(int row, int col) {
+template<typename T>
+T& BasicMatrix<T>::at(int row, int col) {
     if (row < 0 || row >= rows || col < 0 || col >= cols) {
         throw std::out_of_range("Índices fuera de rango");
     }
     return matriz[row][col];
 }
 
+/**
+ * @brief Accede (con verificación de límites) a un elemento de la matriz, versión const.
+ *
+ * @throw std::out_of_range Si los índices están fuera de los límites de la matriz.
+ */
+template<typename T>
+const T& BasicMatrix<T>::at(int row, int col) const {
+    if (row < 0 || row >= rows || col < 0 || col >= cols) {
+        throw std::out_of_range("Índices fuera de rango");
+    }
+    return matriz[row][col];
+}
+
+/**
+ * @brief Intercambia dos filas intercambiando sus punteros.
+ *
+ * @param i Primera fila.
+ * @param j Segunda fila.
+ *
+ * @throw std::out_of_range Si alguno de los índices está fuera de los límites de la matriz.
+ */
+template<typename T>
+void BasicMatrix<T>::intercambiarFilas(int i, int j) {
+    if (i < 0 || i >= rows || j < 0 || j >= rows) {
+        throw std::out_of_range("Índices fuera de rango");
+    }
+    std::swap(matriz[i], matriz[j]);
+}
+
 /**
  * @brief Llena la matriz con datos ingresados por el usuario desde consola.
  * 
  * Solicita cada elemento individualmente e imprime su posición para facilitar el ingreso.
  */
-void Matrix::fillMatrix() {
+template<typename T>
+void BasicMatrix<T>::fillMatrix() {
     std::cout << "Ingrese los " << rows * cols << " elementos de la matriz:\n";
     for (int i = 0; i < rows; i++) {
         for (int j = 0; j < cols; ++j) {
             std::cout << "Ingrese el elemento (" << i << "," << j << "): ";
-            matriz[i][j] = leerDecimal("");
+            leerElemento(matriz[i][j]);
         }
     }
 }
@@ -74,7 +162,8 @@ void Matrix::fillMatrix() {
  * 
  * Utiliza `std::setw` para alinear columnas y mostrar la matriz de forma legible.
  */
-void Matrix::print() const{
+template<typename T>
+void BasicMatrix<T>::print() const{
     for (int i = 0; i < rows; i++) {
         for (int j = 0; j < cols; j++) {
             std::cout << std::setw(10) << matriz[i][j] << " ";
@@ -82,3 +171,8 @@ void Matrix::print() const{
         std::cout << '\n';
     }
 }
+
+template class BasicMatrix<float>;
+template class BasicMatrix<double>;
+template class BasicMatrix<std::complex<float>>;
+template class BasicMatrix<std::complex<double>>;
@@ -5,26 +5,33 @@
  * Proporciona una estructura de datos para matrices con gestión automática de memoria
  * mediante punteros inteligentes y métodos para acceso seguro, llenado e impresión.
  *
+ * La clase es una plantilla sobre el tipo de sus elementos (BasicMatrix<T>) con instancias explícitas para
+ * float, double, std::complex<float> y std::complex<double>; Matrix es la versión con double que usa
+ * el resto del programa.
  */
 #ifndef MATRIX_HPP
 #define MATRIX_HPP
 
+#include <complex>
 #include <memory>
 
 /**
- * @class Matrix
- * @brief Clase que representa una matriz dinámica de tamaño variable.
+ * @class BasicMatrix
+ * @brief Clase que representa una matriz dinámica de tamaño variable con elementos de tipo T.
  *
  * Esta clase permite crear matrices de tamaño definido en tiempo de ejecución, acceder y
  * modificar sus valores mediante el método 'at', y realizar operaciones básicas, como
  * impresion y llenado manual.
  * Utiliza punteros inteligentes (`std::unique_ptr`) para gestionar la memoria de forma segura.
+ *
+ * @tparam T Tipo de los elementos: float, double, std::complex<float> o std::complex<double>.
  */
-class Matrix {
+template<typename T>
+class BasicMatrix {
     private:
         int rows;
         int cols;
-        std::unique_ptr<std::unique_ptr<double[]>[]> matriz; // Almacén de datos en una matriz de punteros inteligentes. //
+        std::unique_ptr<std::unique_ptr<T[]>[]> matriz; // Almacén de datos en una matriz de punteros inteligentes. //
     public:
         /**
         * @brief Constructor de la matriz.
@@ -34,7 +41,30 @@ class Matrix {
          * @param r Número de filas.
         * @param c Número de columnas.
         */
-        Matrix(int r, int c);
+        BasicMatrix(int r, int c);
+
+        /**
+        * @brief Constructor de copia, copia profunda de todos los elementos.
+        * @param other Matriz a copiar.
+        */
+        BasicMatrix(const BasicMatrix& other);
+
+        /**
+        * @brief Operador de asignación por copia, copia profunda de todos los elementos.
+        * @param other Matriz a copiar.
+        * @return BasicMatrix& Referencia a esta matriz.
+        */
+        BasicMatrix& operator=(const BasicMatrix& other);
+
+        /**
+        * @brief Constructor de movimiento, transfiere la memoria sin copiar elementos.
+        */
+        BasicMatrix(BasicMatrix&& other) noexcept = default;
+
+        /**
+        * @brief Asignación por movimiento, transfiere la memoria sin copiar elementos.
+        */
+        BasicMatrix& operator=(BasicMatrix&& other) noexcept = default;
 
         /**
         * @brief Devuelve el número de filas de la matriz.
@@ -56,16 +86,34 @@ class Matrix {
         *
         * @param row Índice de fila (0 <= row < rows).
         * @param col Índice de columna (0 <= col < cols).
-        * @return double& Referencia al elemento solicitado.
+        * @return T& Referencia al elemento solicitado.
         *
         * @throws std::out_of_range Si los índices están fuera de rango.
         */
-        double& at(int row, int col);
+        T& at(int row, int col);
+
+        /**
+        * @brief Acceso seguro a un elemento de la matriz (versión const).
+        *
+        * @throws std::out_of_range Si los índices están fuera de rango.
+        */
+        const T& at(int row, int col) const;
+
+        /**
+        * @brief Intercambia las filas `i` y `j` en O(1), intercambiando sus punteros sin mover los elementos.
+        *
+        * Los punteros a elementos obtenidos antes con `at` siguen apuntando a los mismos datos, que ahora
+        * pertenecen a la otra fila.
+        *
+        * @throws std::out_of_range Si alguno de los índices está fuera de rango.
+        */
+        void intercambiarFilas(int i, int j);
 
         /**
          * @brief Llena la matriz con valores ingresados por el usuario desde la consola.
         *
-        * Solicita al usuario cada elemento de la matriz, indicando su posición.
+        * Solicita al usuario cada elemento de la matriz, indicando su posición. En las matrices complejas
+        * pide por separado la parte real y la imaginaria.
         */
         void fillMatrix();
     
@@ -77,4 +125,9 @@ class Matrix {
         void print() const;
 };
 
+/**
+ * @brief Matriz de elementos double, el tipo que usan los métodos del programa.
+ */
+using Matrix = BasicMatrix<double>;
+
 #endif
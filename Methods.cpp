@@ -5,6 +5,7 @@
  * @section features_sec Características principales.
  * -Método de eliminación de Gauss.
  * -Método de Gauss-Jordan.
+ * -Pivoteo parcial, de torre, completo o sin pivoteo para matrices diagonal dominantes.
  * 
  */
 #include "Methods.hpp"
@@ -13,8 +14,15 @@
 #include <cmath>
 #include <iostream>
 #include <iomanip>
+#include <complex>
+#include <memory>
+#include <type_traits>
 #include "utils.hpp"
 #include "String.hpp"
+#include "Analysis.hpp"
+#include "FactorizationCache.hpp"
+#include "RecursiveLU.hpp"
+#include "PerfCounters.hpp"
 
 /**
  * @brief Imprime el sistema de ecuaciones lineales en forma matricial.
@@ -52,28 +60,39 @@ void imprimirSistema(Matrix& A, Matrix& b) {
  * 
  * @param A Matriz de coeficientes del sistema (modificada durante la ejecución).
  * @param b Vector columna de términos independientes (modificado durante la ejecución).
+ * @param usarCache Si es verdadero y no se muestran pasos, resuelve con la caché global de factorizaciones sin modificar A ni b.
+ * @param estrategia Forma de elegir los pivotes.
  * @return Matrix vectorSolución solución del sistema.
  * 
  * @throw std::runtime_error Si el sistema no tiene solución única (pivote cero en la diagonal).
  */
-Matrix gaussElimination(Matrix& A, Matrix& b, bool mostrarPasos) {
-    forwardElimination(A, b, mostrarPasos);
+template<typename T>
+BasicMatrix<T> gaussElimination(BasicMatrix<T>& A, BasicMatrix<T>& b, bool mostrarPasos, bool usarCache, EstrategiaPivoteo estrategia) {
+    if constexpr (std::is_same<T, double>::value) {
+        if (usarCache && !mostrarPasos) {
+            return cacheGlobalFactorizaciones().resolver(A, b);
+        }
+    }
+    int numEcuations = A.getRows();
+    std::unique_ptr<int[]> columnas;
+    if (pivoteaColumnas(estrategia)) columnas = std::make_unique<int[]>(numEcuations);
+    forwardElimination(A, b, mostrarPasos, estrategia, columnas.get());
 
     // Sustitución regresiva
-    int numEcuations = A.getRows();
-    Matrix vectorSolucion(numEcuations, 1);
+    BasicMatrix<T> vectorSolucion(numEcuations, 1);
     const double TOLERANCIA = 1e-12;
+    RegionRendimiento region(RegionMedida::Sustitucion, static_cast<double>(numEcuations) * numEcuations);
 
     for (int row = numEcuations - 1; row >= 0; row--) {
         //Suma de los elementos ya conocidos
-        double sum {0.0};
+        T sum {0};
         //Este ciclo se activa si columna es menor al numero de ecuaciones, lo que nos dice que hay valor a la derecha
         for (int col = row + 1; col < numEcuations; col++) {
             //Se suma la multiplicación del coeficiente por el valor que ya conocemos, lo hace para todos los valores ya conocidos
             sum += A.at(row, col) * vectorSolucion.at(col, 0);
         }
         
-        double denom = A.at(row, row);
+        T denom = A.at(row, row);
         
         //Envía un mensaje de error donde ocurre una división por cero durante la sustitución regresiva para evitar bugs o que el programa se rompa.
         if (std::abs(denom) < TOLERANCIA) {
@@ -83,6 +102,12 @@ Matrix gaussElimination(Matrix& A, Matrix& b, bool mostrarPasos) {
         //Despeja la variable desconocida pasando la suma como resta y el coeficiente como cosciente para resolver la incógnita y almacena el resultado en el último espacio libre del vector para que se acomoden de forma ordenada
         vectorSolucion.at(row, 0) = (b.at(row, 0) - sum) / A.at(row, row);
     }
+    //Con intercambios de columnas la incógnita de la posición k es x[columnas[k]]
+    if (columnas) {
+        BasicMatrix<T> ordenada(numEcuations, 1);
+        for (int k = 0; k < numEcuations; k++) ordenada.at(columnas[k], 0) = vectorSolucion.at(k, 0);
+        return ordenada;
+    }
     //Retorna el vector solución
     return vectorSolucion;
 
@@ -96,31 +121,33 @@ Matrix gaussElimination(Matrix& A, Matrix& b, bool mostrarPasos) {
  * 
  * @param A Matriz de coeficientes del sistema (modificada durante la ejecución).
  * @param b Vector columna de términos independientes (modificado durante la ejecución).
+ * @param usarCache Si es verdadero y no se muestran pasos, resuelve con la caché global de factorizaciones sin modificar A ni b.
+ * @param estrategia Forma de elegir los pivotes.
  * @return Matrix vectorSolución solución del sistema.
  * 
  * @throw std::runtime_error Si el sistema no tiene solución única (pivote cero en la diagonal).
  */
-Matrix gaussJordanElimination(Matrix& A, Matrix& b, bool mostrarPasos){
-    forwardElimination(A, b, mostrarPasos);
-
-    backwardElimination(A, b, mostrarPasos);
-
-    int numEcuations = A.getRows();
-    const double TOLERANCIA = 1e-10;
-
-    for (int row = 0; row < numEcuations; row++) {
-        for (int col = 0; col < numEcuations; col++) {
-            if ((row == col && std::abs(A.at(row, col) - 1.0) > TOLERANCIA) || (row != col && std::abs(A.at(row, col)) > TOLERANCIA)) {
-                throw std::runtime_error("La matriz no se redujo completamente a la identidad. El sistema puede estar mal condicionado.");
-            }
+template<typename T>
+BasicMatrix<T> gaussJordanElimination(BasicMatrix<T>& A, BasicMatrix<T>& b, bool mostrarPasos, bool usarCache, EstrategiaPivoteo estrategia){
+    if constexpr (std::is_same<T, double>::value) {
+        if (usarCache && !mostrarPasos) {
+            // Con la matriz ya factorizada, la solución es la misma que daría la reducción completa
+            return cacheGlobalFactorizaciones().resolver(A, b);
         }
     }
+    int numEcuations = A.getRows();
+    std::unique_ptr<int[]> columnas;
+    if (pivoteaColumnas(estrategia)) columnas = std::make_unique<int[]>(numEcuations);
+    forwardElimination(A, b, mostrarPasos, estrategia, columnas.get());
+
+    // backwardElimination escribe la identidad exacta, así que no hace falta volver a recorrer A para comprobarla
+    backwardElimination(A, b, mostrarPasos);
 
-    //Guardado del vector solución
-    Matrix vectorSolucion(numEcuations, 1);
+    //Guardado del vector solución, en el orden original de las incógnitas
+    BasicMatrix<T> vectorSolucion(numEcuations, 1);
     for (int sol = 0; sol < numEcuations; sol++)
     {
-        vectorSolucion.at(sol, 0) = b.at(sol, 0);
+        vectorSolucion.at(columnas ? columnas[sol] : sol, 0) = b.at(sol, 0);
     }
     
     return vectorSolucion;
@@ -141,8 +168,63 @@ Matrix gaussJordanElimination(Matrix& A, Matrix& b, bool mostrarPasos){
  * 
  * @throw std::runtime_error Si hay ceros en la diagonal o no converge.
  */
-Matrix jacobiMethod(Matrix& A, Matrix& b, double tolerancia, int maxIteraciones) {
-    return metodoIterativoGeneral(A, b, tolerancia, maxIteraciones, false);
+template<typename T>
+BasicMatrix<T> jacobiMethod(BasicMatrix<T>& A, BasicMatrix<T>& b, double tolerancia, int maxIteraciones) {
+    if constexpr (std::is_same<T, double>::value) {
+        return metodoIterativoGeneral(A, b, tolerancia, maxIteraciones, false);
+    } else {
+        OpcionesIterativas opciones;
+        opciones.tolerancia = tolerancia;
+        opciones.maxIter = maxIteraciones;
+        return metodoIterativoEscalar(A, b, opciones, false);
+    }
+}
+
+/**
+ * @brief Resuelve un sistema mediante el método de Jacobi con opciones (tolerancia, iteraciones y aceleración).
+ *
+ * @param A Matriz de coeficientes del sistema (no se modifica).
+ * @param b Vector columna de términos independientes (no se modifica).
+ * @param opciones Opciones del método iterativo; ver OpcionesIterativas.
+ * @return Matrix vectorSolución solución del sistema.
+ *
+ * @throw std::runtime_error Si hay ceros en la diagonal o no converge.
+ */
+Matrix jacobiMethod(Matrix& A, Matrix& b, const OpcionesIterativas& opciones) {
+    return metodoIterativoGeneral(A, b, opciones, false);
+}
+
+/**
+ * @brief Resuelve un sistema mediante el método de Jacobi partiendo de una aproximación inicial.
+ *
+ * @param A Matriz de coeficientes del sistema (no se modifica).
+ * @param b Vector columna de términos independientes (no se modifica).
+ * @param tolerancia Criterio de parada para la convergencia.
+ * @param maxIteraciones Número máximo de iteraciones permitidas.
+ * @param aproximacionInicial Vector de n x 1 desde el que comienzan las iteraciones.
+ * @return Matrix vectorSolución solución del sistema.
+ *
+ * @throw std::invalid_argument Si la aproximación inicial no tiene el tamaño del sistema.
+ * @throw std::runtime_error Si hay ceros en la diagonal o no converge.
+ */
+Matrix jacobiMethod(Matrix& A, Matrix& b, double tolerancia, int maxIteraciones, const Matrix& aproximacionInicial) {
+    OpcionesIterativas opciones;
+    opciones.tolerancia = tolerancia;
+    opciones.maxIter = maxIteraciones;
+    opciones.aproximacionInicial = &aproximacionInicial;
+    return metodoIterativoGeneral(A, b, opciones, false);
+}
+
+/**
+ * @brief Resuelve un sistema mediante el método de Jacobi sobre un operador lineal.
+ *
+ * @param A Operador del sistema.
+ * @param b Vector columna de términos independientes (no se modifica).
+ * @param opciones Opciones del método iterativo; ver OpcionesIterativas.
+ * @return Matrix vectorSolución solución del sistema.
+ */
+Matrix jacobiMethod(const OperadorLineal& A, const Matrix& b, const OpcionesIterativas& opciones) {
+    return metodoIterativoGeneral(A, b, opciones, false);
 }
 
 
@@ -156,6 +238,111 @@ Matrix jacobiMethod(Matrix& A, Matrix& b, double tolerancia, int maxIteraciones)
  * @return std::vector<double> Vector solución del sistema.
  * @throw std::runtime_error Si hay ceros en la diagonal principal o si no converge.
  */
-Matrix gaussSeidelMethod(Matrix& A, Matrix& b, double tolerancia, int maxIter) {
-   return metodoIterativoGeneral(A, b, tolerancia, maxIter, true);
+template<typename T>
+BasicMatrix<T> gaussSeidelMethod(BasicMatrix<T>& A, BasicMatrix<T>& b, double tolerancia, int maxIter) {
+   if constexpr (std::is_same<T, double>::value) {
+      return metodoIterativoGeneral(A, b, tolerancia, maxIter, true);
+   } else {
+      OpcionesIterativas opciones;
+      opciones.tolerancia = tolerancia;
+      opciones.maxIter = maxIter;
+      return metodoIterativoEscalar(A, b, opciones, true);
+   }
+}
+
+/**
+ * @brief Resuelve un sistema mediante el método de Gauss-Seidel con opciones (tolerancia, iteraciones y aceleración).
+ *
+ * @param A Matriz de coeficientes del sistema (no se modifica).
+ * @param b Vector columna de términos independientes (no se modifica).
+ * @param opciones Opciones del método iterativo; ver OpcionesIterativas.
+ * @return Matrix vectorSolución solución del sistema.
+ *
+ * @throw std::runtime_error Si hay ceros en la diagonal principal o si no converge.
+ */
+Matrix gaussSeidelMethod(Matrix& A, Matrix& b, const OpcionesIterativas& opciones) {
+   return metodoIterativoGeneral(A, b, opciones, true);
+}
+
+/**
+ * @brief Resuelve un sistema mediante el método de Gauss-Seidel partiendo de una aproximación inicial.
+ *
+ * @param A Matriz de coeficientes del sistema (no se modifica).
+ * @param b Vector columna de términos independientes (no se modifica).
+ * @param tolerancia Criterio de parada para la convergencia.
+ * @param maxIter Número máximo de iteraciones permitidas.
+ * @param aproximacionInicial Vector de n x 1 desde el que comienzan las iteraciones.
+ * @return Matrix vectorSolución solución del sistema.
+ *
+ * @throw std::invalid_argument Si la aproximación inicial no tiene el tamaño del sistema.
+ * @throw std::runtime_error Si hay ceros en la diagonal principal o si no converge.
+ */
+Matrix gaussSeidelMethod(Matrix& A, Matrix& b, double tolerancia, int maxIter, const Matrix& aproximacionInicial) {
+   OpcionesIterativas opciones;
+   opciones.tolerancia = tolerancia;
+   opciones.maxIter = maxIter;
+   opciones.aproximacionInicial = &aproximacionInicial;
+   return metodoIterativoGeneral(A, b, opciones, true);
+}
+
+/**
+ * @brief Resuelve un sistema mediante el método de Gauss-Seidel sobre un operador lineal.
+ *
+ * @param A Operador del sistema con acceso por filas.
+ * @param b Vector columna de términos independientes (no se modifica).
+ * @param opciones Opciones del método iterativo; ver OpcionesIterativas.
+ * @return Matrix vectorSolución solución del sistema.
+ */
+Matrix gaussSeidelMethod(const OperadorLineal& A, const Matrix& b, const OpcionesIterativas& opciones) {
+   return metodoIterativoGeneral(A, b, opciones, true);
+}
+
+template BasicMatrix<float> gaussElimination(BasicMatrix<float>&, BasicMatrix<float>&, bool, bool, EstrategiaPivoteo);
+template Matrix gaussElimination(Matrix&, Matrix&, bool, bool, EstrategiaPivoteo);
+template BasicMatrix<std::complex<float>> gaussElimination(BasicMatrix<std::complex<float>>&, BasicMatrix<std::complex<float>>&, bool, bool, EstrategiaPivoteo);
+template BasicMatrix<std::complex<double>> gaussElimination(BasicMatrix<std::complex<double>>&, BasicMatrix<std::complex<double>>&, bool, bool, EstrategiaPivoteo);
+template BasicMatrix<float> gaussJordanElimination(BasicMatrix<float>&, BasicMatrix<float>&, bool, bool, EstrategiaPivoteo);
+template Matrix gaussJordanElimination(Matrix&, Matrix&, bool, bool, EstrategiaPivoteo);
+template BasicMatrix<std::complex<float>> gaussJordanElimination(BasicMatrix<std::complex<float>>&, BasicMatrix<std::complex<float>>&, bool, bool, EstrategiaPivoteo);
+template BasicMatrix<std::complex<double>> gaussJordanElimination(BasicMatrix<std::complex<double>>&, BasicMatrix<std::complex<double>>&, bool, bool, EstrategiaPivoteo);
+template BasicMatrix<float> jacobiMethod(BasicMatrix<float>&, BasicMatrix<float>&, double, int);
+template Matrix jacobiMethod(Matrix&, Matrix&, double, int);
+template BasicMatrix<std::complex<float>> jacobiMethod(BasicMatrix<std::complex<float>>&, BasicMatrix<std::complex<float>>&, double, int);
+template BasicMatrix<std::complex<double>> jacobiMethod(BasicMatrix<std::complex<double>>&, BasicMatrix<std::complex<double>>&, double, int);
+template BasicMatrix<float> gaussSeidelMethod(BasicMatrix<float>&, BasicMatrix<float>&, double, int);
+template Matrix gaussSeidelMethod(Matrix&, Matrix&, double, int);
+template BasicMatrix<std::complex<float>> gaussSeidelMethod(BasicMatrix<std::complex<float>>&, BasicMatrix<std::complex<float>>&, double, int);
+template BasicMatrix<std::complex<double>> gaussSeidelMethod(BasicMatrix<std::complex<double>>&, BasicMatrix<std::complex<double>>&, double, int);
+
+/**
+ * @brief Resuelve un sistema de ecuaciones lineales con el método indicado.
+ *
+ * @param metodo Método de solución a utilizar.
+ * @param A Matriz de coeficientes del sistema (los métodos directos la modifican).
+ * @param b Vector columna de términos independientes (los métodos directos lo modifican).
+ * @param tolerancia Criterio de parada de los métodos iterativos.
+ * @param maxIter Número máximo de iteraciones de los métodos iterativos.
+ * @param usarCache Si es verdadero, los métodos directos reutilizan la caché global de factorizaciones.
+ * @return Matrix vectorSolución solución del sistema.
+ *
+ * @throw std::runtime_error Si el método elegido no puede resolver el sistema.
+ */
+Matrix resolverSistema(MetodoSolucion metodo, Matrix& A, Matrix& b, double tolerancia, int maxIter, bool usarCache) {
+    switch (metodo) {
+    case MetodoSolucion::Gauss:
+        return gaussElimination(A, b, false, usarCache);
+    case MetodoSolucion::GaussJordan:
+        return gaussJordanElimination(A, b, false, usarCache);
+    case MetodoSolucion::Jacobi:
+        return jacobiMethod(A, b, tolerancia, maxIter);
+    case MetodoSolucion::GaussSeidel:
+        return gaussSeidelMethod(A, b, tolerancia, maxIter);
+    case MetodoSolucion::LURecursiva:
+        return luRecursiva(A, b);
+    case MetodoSolucion::Automatico: {
+        String motivo;
+        return resolverAutomatico(A, b, tolerancia, maxIter, motivo);
+    }
+    }
+    throw std::runtime_error("Método de solución desconocido.");
 }
\ No newline at end of file
@@ -5,12 +5,19 @@
  * Este archivo contiene la declaración de la función `gaussElimination`, que implementa el algoritmo
  * de eliminación de Gauss con pivoteo parcial para resolver sistemas de ecuaciones lineales Ax = b y la función 'gaussJordanElimination' 
  * que impplementa el algoritmo de eliminación de Gauss-Jordan.
+ *
+ * Gauss, Gauss-Jordan y las versiones básicas de Jacobi y Gauss-Seidel son plantillas sobre el tipo de los
+ * elementos, instanciadas para float, double, std::complex<float> y std::complex<double>. Las demás
+ * variantes trabajan con Matrix (double).
  * 
  */
 #ifndef METHODS_HPP
 #define METHODS_HPP
 
 #include "Matrix.hpp"
+#include "IterativeOptions.hpp"
+#include "LinearOperator.hpp"
+#include "utils.hpp"
 
 /**
  * @brief Resuelve un sistema de ecuaciones lineales mediante el método de eliminación de Gauss con pivoteo parcial.
@@ -21,11 +28,17 @@
  * @param A Matriz cuadrada de coeficientes del sistema (modificada durante la ejecución).
  * @param b Vector columna de términos independientes (modificado durante la ejecución).
  * @param mostrarPasos Indica si el usuario desea conocer los pasos de la solución al sistema.
+ * @param usarCache Si es verdadero (y no se muestran pasos), reutiliza la factorización de A guardada en la caché
+ * global de factorizaciones; en ese caso A y b no se modifican. La caché y los pasos solo existen para double.
+ * @param estrategia Forma de elegir los pivotes (la caché siempre usa pivoteo parcial). Con pivoteo de torre o
+ * completo las columnas de A quedan permutadas, pero la solución se devuelve en el orden original.
  * @return Matrix vectorSolución solución del sistema.
  * 
  * @throw std::runtime_error Si el sistema no tiene solución única o puede estar mal condicionado.
  */
-Matrix gaussElimination(Matrix& A, Matrix& b, bool mostrarPasos);
+template<typename T>
+BasicMatrix<T> gaussElimination(BasicMatrix<T>& A, BasicMatrix<T>& b, bool mostrarPasos, bool usarCache = false,
+                                EstrategiaPivoteo estrategia = EstrategiaPivoteo::Parcial);
 
 /**
  * @brief Resuelve un sistema de ecuaciones lineales mediante el método de Gauss-Jordan.
@@ -36,11 +49,16 @@ Matrix gaussElimination(Matrix& A, Matrix& b, bool mostrarPasos);
  * @param A Matriz cuadrada de coeficientes del sistema (modificada durante la ejecución)
  * @param b Vector columna de términos independientes (modificado durante la ejecución)
  * @param mostrarPasos Indica si el usuario desea conocer los pasos de la solución al sistema
+ * @param usarCache Si es verdadero (y no se muestran pasos), reutiliza la factorización de A guardada en la caché
+ * global de factorizaciones; en ese caso A y b no se modifican.
+ * @param estrategia Forma de elegir los pivotes (la caché siempre usa pivoteo parcial).
  * @return Matrix vectorSolución solución del sistema. 
  * 
  * @throw std::runtime_error Si el sistema no tiene solución unica o puede estar mal condicionado.
  */
-Matrix gaussJordanElimination(Matrix& A, Matrix&b, bool mostrarPasos);
+template<typename T>
+BasicMatrix<T> gaussJordanElimination(BasicMatrix<T>& A, BasicMatrix<T>& b, bool mostrarPasos, bool usarCache = false,
+                                      EstrategiaPivoteo estrategia = EstrategiaPivoteo::Parcial);
 
 /**
  * @brief Imprime un sistema de ecuaciones lineales en forma matricial.
@@ -66,9 +84,55 @@ void imprimirSistema(Matrix& A, Matrix& b);
  * @param maxIteraciones Número máximo de iteraciones permitidas (por defecto 1000).
  * @return Matrix vectorSolución solución del sistema.
  * 
+ * Con double usa el motor de metodoIterativoGeneral; con los demás tipos, metodoIterativoEscalar.
+ *
  * @throw std::runtime_error Si hay ceros en la diagonal o no converge.
  */
-Matrix jacobiMethod(Matrix& A, Matrix& b, double tolerancia, int maxIteraciones);
+template<typename T>
+BasicMatrix<T> jacobiMethod(BasicMatrix<T>& A, BasicMatrix<T>& b, double tolerancia, int maxIteraciones);
+
+/**
+ * @brief Resuelve un sistema mediante el método de Jacobi con opciones (tolerancia, iteraciones y aceleración).
+ *
+ * @param A Matriz de coeficientes del sistema (no se modifica).
+ * @param b Vector columna de términos independientes (no se modifica).
+ * @param opciones Opciones del método iterativo; ver OpcionesIterativas.
+ * @return Matrix vectorSolución solución del sistema.
+ *
+ * @throw std::runtime_error Si hay ceros en la diagonal o no converge.
+ */
+Matrix jacobiMethod(Matrix& A, Matrix& b, const OpcionesIterativas& opciones);
+
+/**
+ * @brief Resuelve un sistema mediante el método de Jacobi partiendo de una aproximación inicial.
+ *
+ * Útil cuando se resuelven sistemas consecutivos cuya solución cambia poco (por ejemplo, pasos de tiempo):
+ * partir de la solución anterior reduce drásticamente el número de iteraciones.
+ *
+ * @param A Matriz de coeficientes del sistema (no se modifica).
+ * @param b Vector columna de términos independientes (no se modifica).
+ * @param tolerancia Criterio de parada para la convergencia.
+ * @param maxIteraciones Número máximo de iteraciones permitidas.
+ * @param aproximacionInicial Vector de n x 1 desde el que comienzan las iteraciones.
+ * @return Matrix vectorSolución solución del sistema.
+ *
+ * @throw std::invalid_argument Si la aproximación inicial no tiene el tamaño del sistema.
+ * @throw std::runtime_error Si hay ceros en la diagonal o no converge.
+ */
+Matrix jacobiMethod(Matrix& A, Matrix& b, double tolerancia, int maxIteraciones, const Matrix& aproximacionInicial);
+
+/**
+ * @brief Resuelve un sistema mediante el método de Jacobi sobre un operador lineal, sin formar la matriz.
+ *
+ * @param A Operador del sistema; basta con que sepa aplicarse a un vector y dar su diagonal.
+ * @param b Vector columna de términos independientes (no se modifica).
+ * @param opciones Opciones del método iterativo; ver OpcionesIterativas.
+ * @return Matrix vectorSolución solución del sistema.
+ *
+ * @throw std::invalid_argument Si b no tiene el tamaño del operador.
+ * @throw std::runtime_error Si hay ceros en la diagonal o no converge.
+ */
+Matrix jacobiMethod(const OperadorLineal& A, const Matrix& b, const OpcionesIterativas& opciones = OpcionesIterativas());
 
 /**
  * @brief Resuelve un sistema de ecuaciones lineales mediante el método iterativo de Gauss-Seidel.
@@ -82,8 +146,81 @@ Matrix jacobiMethod(Matrix& A, Matrix& b, double tolerancia, int maxIteraciones)
  * @param maxIter Número máximo de iteraciones permitidas (por defecto 1000).
  * @return std::vector<double> Vector solución del sistema.
  * 
+ * Con double usa el motor de metodoIterativoGeneral; con los demás tipos, metodoIterativoEscalar.
+ *
  * @throw std::runtime_error Si hay ceros en la diagonal principal o si no converge.
  */
-Matrix gaussSeidelMethod(Matrix& A, Matrix& b, double tolerancia, int maxIter);
+template<typename T>
+BasicMatrix<T> gaussSeidelMethod(BasicMatrix<T>& A, BasicMatrix<T>& b, double tolerancia, int maxIter);
+
+/**
+ * @brief Resuelve un sistema mediante el método de Gauss-Seidel con opciones (tolerancia, iteraciones y aceleración).
+ *
+ * @param A Matriz de coeficientes del sistema (no se modifica).
+ * @param b Vector columna de términos independientes (no se modifica).
+ * @param opciones Opciones del método iterativo; ver OpcionesIterativas.
+ * @return Matrix vectorSolución solución del sistema.
+ *
+ * @throw std::runtime_error Si hay ceros en la diagonal principal o si no converge.
+ */
+Matrix gaussSeidelMethod(Matrix& A, Matrix& b, const OpcionesIterativas& opciones);
+
+/**
+ * @brief Resuelve un sistema mediante el método de Gauss-Seidel partiendo de una aproximación inicial.
+ *
+ * @param A Matriz de coeficientes del sistema (no se modifica).
+ * @param b Vector columna de términos independientes (no se modifica).
+ * @param tolerancia Criterio de parada para la convergencia.
+ * @param maxIter Número máximo de iteraciones permitidas.
+ * @param aproximacionInicial Vector de n x 1 desde el que comienzan las iteraciones.
+ * @return Matrix vectorSolución solución del sistema.
+ *
+ * @throw std::invalid_argument Si la aproximación inicial no tiene el tamaño del sistema.
+ * @throw std::runtime_error Si hay ceros en la diagonal principal o si no converge.
+ */
+Matrix gaussSeidelMethod(Matrix& A, Matrix& b, double tolerancia, int maxIter, const Matrix& aproximacionInicial);
+
+/**
+ * @brief Resuelve un sistema mediante el método de Gauss-Seidel sobre un operador lineal, sin formar la matriz.
+ *
+ * @param A Operador del sistema; debe permitir acceso por filas (OperadorLineal::tieneFilas).
+ * @param b Vector columna de términos independientes (no se modifica).
+ * @param opciones Opciones del método iterativo; ver OpcionesIterativas.
+ * @return Matrix vectorSolución solución del sistema.
+ *
+ * @throw std::invalid_argument Si b no tiene el tamaño del operador o este no permite acceso por filas.
+ * @throw std::runtime_error Si hay ceros en la diagonal principal o si no converge.
+ */
+Matrix gaussSeidelMethod(const OperadorLineal& A, const Matrix& b, const OpcionesIterativas& opciones = OpcionesIterativas());
+
+/**
+ * @brief Métodos de solución disponibles, para elegir el método en tiempo de ejecución.
+ */
+enum class MetodoSolucion {
+    Gauss,
+    GaussJordan,
+    Jacobi,
+    GaussSeidel,
+    LURecursiva, ///< Factorización LU recursiva (ver RecursiveLU.hpp); no usa la caché de factorizaciones.
+    Automatico ///< Elige el método a partir del análisis estructural de A (ver Analysis.hpp).
+};
+
+/**
+ * @brief Resuelve un sistema de ecuaciones lineales con el método indicado.
+ *
+ * Punto de entrada común para quien elige el método en tiempo de ejecución (por ejemplo, el servicio de solución).
+ * Los métodos directos no muestran pasos.
+ *
+ * @param metodo Método de solución a utilizar.
+ * @param A Matriz de coeficientes del sistema (los métodos directos la modifican).
+ * @param b Vector columna de términos independientes (los métodos directos lo modifican).
+ * @param tolerancia Criterio de parada de los métodos iterativos.
+ * @param maxIter Número máximo de iteraciones de los métodos iterativos.
+ * @param usarCache Si es verdadero, los métodos directos reutilizan la caché global de factorizaciones.
+ * @return Matrix vectorSolución solución del sistema.
+ *
+ * @throw std::runtime_error Si el método elegido no puede resolver el sistema.
+ */
+Matrix resolverSistema(MetodoSolucion metodo, Matrix& A, Matrix& b, double tolerancia, int maxIter, bool usarCache = false);
 
 #endif
@@ -0,0 +1,314 @@
+/**
+ * @file Multigrid.cpp
+ * @brief Implementación del multimalla algebraico por agregación suavizada.
+ *
+ * @section features_sec Características principales
+ * -Agregación en tres fases sobre el grafo de conexiones fuertes.
+ * -Prolongador suavizado con Jacobi y operador grueso de Galerkin Pᵀ·A·P.
+ * -Ciclos V y W con los barridos de Jacobi o Gauss-Seidel de utils como suavizadores.
+ * -Solución directa con FactorizacionLU en el nivel más grueso, o barridos del suavizador si es demasiado grande
+ *  para densificarlo.
+ */
+#include "Multigrid.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+#include "utils.hpp"
+
+namespace {
+
+/**
+ * @brief Estima el radio espectral de D⁻¹·A con unas pocas iteraciones de la potencia.
+ */
+double radioEspectralJacobi(const SparseMatrix& A, const double* diagonal) {
+    int n = A.getRows();
+    std::unique_ptr<double[]> v = std::make_unique<double[]>(n);
+    std::unique_ptr<double[]> w = std::make_unique<double[]>(n);
+    // Vector inicial determinista con componentes en todas las frecuencias
+    unsigned int semilla = 12345u;
+    for (int i = 0; i < n; i++) {
+        semilla = semilla * 1103515245u + 12345u;
+        v[i] = 0.5 + static_cast<double>(semilla >> 8) / 16777216.0;
+    }
+    double radio = 1.0;
+    for (int iter = 0; iter < 15; iter++) {
+        A.multiplicar(v.get(), w.get());
+        double norma = 0.0;
+        for (int i = 0; i < n; i++) {
+            w[i] = diagonal[i] != 0.0 ? w[i] / diagonal[i] : 0.0;
+            norma = std::max(norma, std::abs(w[i]));
+        }
+        if (norma == 0.0) return 1.0;
+        double normaV = 0.0;
+        for (int i = 0; i < n; i++) normaV = std::max(normaV, std::abs(v[i]));
+        radio = norma / normaV;
+        for (int i = 0; i < n; i++) v[i] = w[i] / norma;
+    }
+    return radio;
+}
+
+} // namespace
+
+MultigridAlgebraico::MultigridAlgebraico(const SparseMatrix& A, const OpcionesMultigrid& opciones)
+    : opciones(opciones), numNiveles(1) {
+    if (A.getRows() != A.getCols()) {
+        throw std::invalid_argument("El multimalla requiere una matriz cuadrada.");
+    }
+    if (opciones.maxNiveles < 1 || opciones.presuavizado < 0 || opciones.postsuavizado < 0 || opciones.tamanoGrueso < 1 ||
+        opciones.maxTamanoDirecto < 0 || opciones.barridosGruesos < 1) {
+        throw std::invalid_argument("Opciones de multimalla no válidas.");
+    }
+    niveles = std::make_unique<Nivel[]>(opciones.maxNiveles);
+    niveles[0].A = &A;
+    while (numNiveles < opciones.maxNiveles && niveles[numNiveles - 1].A->getRows() > opciones.tamanoGrueso) {
+        if (!engrosar(numNiveles - 1)) break;
+        numNiveles++;
+    }
+    // La forma densa ocupa n² valores y su factorización O(n³): solo se usa si el nivel es pequeño
+    const SparseMatrix& grueso = *niveles[numNiveles - 1].A;
+    if (grueso.getRows() <= opciones.maxTamanoDirecto) {
+        directo = std::make_unique<FactorizacionLU>(grueso.toMatrix(), 1, 0.0);
+    }
+}
+
+/**
+ * @brief Construye el nivel `nivel + 1` a partir del nivel `nivel`.
+ *
+ * @return false si la agregación ya no reduce el tamaño del problema.
+ */
+bool MultigridAlgebraico::engrosar(int nivel) {
+    const SparseMatrix& A = *niveles[nivel].A;
+    int n = A.getRows();
+    const int* inicio = A.getInicioFila();
+    const int* columnas = A.getColumnas();
+    const double* valores = A.getValores();
+    std::unique_ptr<double[]> diagonal = std::make_unique<double[]>(n);
+    A.diagonal(diagonal.get());
+
+    auto fuerte = [&](int i, int k) {
+        int j = columnas[k];
+        return j != i && std::abs(valores[k]) >= opciones.umbralFuerza * std::sqrt(std::abs(diagonal[i] * diagonal[j]));
+    };
+
+    // Fase 1: cada nodo cuyos vecinos fuertes están todos libres inicia un agregado con ellos
+    std::unique_ptr<int[]> agregado = std::make_unique<int[]>(n);
+    std::fill(agregado.get(), agregado.get() + n, -1);
+    int numAgregados = 0;
+    for (int i = 0; i < n; i++) {
+        if (agregado[i] != -1) continue;
+        bool libres = true;
+        for (int k = inicio[i]; k < inicio[i + 1] && libres; k++) {
+            if (fuerte(i, k) && agregado[columnas[k]] != -1) libres = false;
+        }
+        if (!libres) continue;
+        agregado[i] = numAgregados;
+        for (int k = inicio[i]; k < inicio[i + 1]; k++) {
+            if (fuerte(i, k)) agregado[columnas[k]] = numAgregados;
+        }
+        numAgregados++;
+    }
+    // Fase 2: los nodos libres se unen a un agregado vecino de la fase 1
+    std::unique_ptr<int[]> fase1 = std::make_unique<int[]>(n);
+    std::copy(agregado.get(), agregado.get() + n, fase1.get());
+    for (int i = 0; i < n; i++) {
+        if (agregado[i] != -1) continue;
+        for (int k = inicio[i]; k < inicio[i + 1]; k++) {
+            if (fuerte(i, k) && fase1[columnas[k]] != -1) {
+                agregado[i] = fase1[columnas[k]];
+                break;
+            }
+        }
+    }
+    // Fase 3: los que siguen libres forman agregados con sus vecinos fuertes libres
+    for (int i = 0; i < n; i++) {
+        if (agregado[i] != -1) continue;
+        agregado[i] = numAgregados;
+        for (int k = inicio[i]; k < inicio[i + 1]; k++) {
+            if (fuerte(i, k) && agregado[columnas[k]] == -1) agregado[columnas[k]] = numAgregados;
+        }
+        numAgregados++;
+    }
+    if (numAgregados == 0 || numAgregados >= n) {
+        return false;
+    }
+
+    // Prolongador tentativo: constante por agregado, con columnas normalizadas
+    std::unique_ptr<int[]> tamano = std::make_unique<int[]>(numAgregados);
+    for (int i = 0; i < n; i++) tamano[agregado[i]]++;
+    SparseMatrix T(n, numAgregados, n);
+    for (int i = 0; i < n; i++) {
+        T.datosInicioFila()[i] = i;
+        T.datosColumnas()[i] = agregado[i];
+        T.datosValores()[i] = 1.0 / std::sqrt(static_cast<double>(tamano[agregado[i]]));
+    }
+    T.datosInicioFila()[n] = n;
+
+    // Prolongador suavizado P = (I - ω·D⁻¹·A)·T con ω = 4 / (3·ρ(D⁻¹·A))
+    double omega = 4.0 / (3.0 * radioEspectralJacobi(A, diagonal.get()));
+    SparseMatrix P = A.producto(T);
+    {
+        const int* inicioP = P.getInicioFila();
+        const int* columnasP = P.getColumnas();
+        double* valoresP = P.datosValores();
+        for (int i = 0; i < n; i++) {
+            double escala = diagonal[i] != 0.0 ? -omega / diagonal[i] : 0.0;
+            for (int k = inicioP[i]; k < inicioP[i + 1]; k++) {
+                valoresP[k] *= escala;
+                // El patrón de A·T contiene siempre la entrada de T de la fila (la diagonal de A está presente)
+                if (columnasP[k] == agregado[i]) valoresP[k] += T.getValores()[i];
+            }
+        }
+    }
+
+    Nivel& fino = niveles[nivel];
+    Nivel& grueso = niveles[nivel + 1];
+    fino.R = P.transpuesta();
+    grueso.propia = fino.R.producto(A.producto(P));
+    grueso.A = &grueso.propia;
+    fino.P = std::move(P);
+    return true;
+}
+
+/**
+ * @brief Reserva los vectores de trabajo de todos los niveles para una llamada a `aplicar` o `resolver`.
+ *
+ * Quedan sin inicializar: cada ciclo escribe x y b de un nivel antes de leerlos.
+ */
+std::unique_ptr<MultigridAlgebraico::VectoresNivel[]> MultigridAlgebraico::reservarVectores() const {
+    std::unique_ptr<VectoresNivel[]> vectores = std::make_unique<VectoresNivel[]>(numNiveles);
+    for (int l = 0; l < numNiveles; l++) {
+        int n = niveles[l].A->getRows();
+        vectores[l].x.reset(new double[n]);
+        vectores[l].b.reset(new double[n]);
+        vectores[l].r.reset(new double[n]);
+        vectores[l].temporal.reset(new double[n]);
+    }
+    return vectores;
+}
+
+void MultigridAlgebraico::suavizar(int nivel, VectoresNivel& V, int barridos, bool haciaAtras) const {
+    const SparseMatrix& A = *niveles[nivel].A;
+    for (int s = 0; s < barridos; s++) {
+        if (opciones.suavizador == SuavizadorMultigrid::GaussSeidel) {
+            barridoDisperso(A, V.b.get(), V.x.get(), V.x.get(), true, haciaAtras);
+        } else {
+            barridoDisperso(A, V.b.get(), V.x.get(), V.temporal.get(), false, false, opciones.pesoJacobi);
+            std::swap(V.x, V.temporal);
+        }
+    }
+}
+
+/**
+ * @brief Aplica un ciclo al sistema del nivel `nivel`, partiendo del valor actual de su x en `vectores[nivel]`.
+ */
+void MultigridAlgebraico::ciclo(int nivel, VectoresNivel* vectores) const {
+    const Nivel& N = niveles[nivel];
+    VectoresNivel& V = vectores[nivel];
+    int n = N.A->getRows();
+    if (nivel == numNiveles - 1 && directo == nullptr) {
+        // Pares adelante-atrás para que el ciclo siga siendo simétrico como precondicionador
+        for (int s = 0; s < opciones.barridosGruesos; s++) {
+            suavizar(nivel, V, 1, false);
+            suavizar(nivel, V, 1, true);
+        }
+        return;
+    }
+    if (nivel == numNiveles - 1) {
+        Matrix terminos(n, 1);
+        for (int i = 0; i < n; i++) terminos.at(i, 0) = V.b[i];
+        Matrix solucion = directo->resolver(terminos);
+        for (int i = 0; i < n; i++) V.x[i] = solucion.at(i, 0);
+        return;
+    }
+
+    suavizar(nivel, V, opciones.presuavizado, false);
+
+    // Restricción del residuo al nivel grueso
+    N.A->multiplicar(V.x.get(), V.r.get());
+    for (int i = 0; i < n; i++) V.r[i] = V.b[i] - V.r[i];
+    VectoresNivel& G = vectores[nivel + 1];
+    int m = niveles[nivel + 1].A->getRows();
+    N.R.multiplicar(V.r.get(), G.b.get());
+    std::fill(G.x.get(), G.x.get() + m, 0.0);
+
+    int repeticiones = (opciones.ciclo == CicloMultigrid::W && nivel + 1 < numNiveles - 1) ? 2 : 1;
+    for (int rep = 0; rep < repeticiones; rep++) {
+        ciclo(nivel + 1, vectores);
+    }
+
+    // Corrección con el error interpolado desde el nivel grueso
+    N.P.multiplicar(G.x.get(), V.r.get());
+    for (int i = 0; i < n; i++) V.x[i] += V.r[i];
+
+    suavizar(nivel, V, opciones.postsuavizado, true);
+}
+
+int MultigridAlgebraico::getSize() const {
+    return niveles[0].A->getRows();
+}
+
+int MultigridAlgebraico::getNumNiveles() const {
+    return numNiveles;
+}
+
+int MultigridAlgebraico::getTamanoNivel(int nivel) const {
+    if (nivel < 0 || nivel >= numNiveles) {
+        throw std::out_of_range("El nivel no existe en la jerarquía.");
+    }
+    return niveles[nivel].A->getRows();
+}
+
+double MultigridAlgebraico::getComplejidadOperador() const {
+    double total = 0.0;
+    for (int l = 0; l < numNiveles; l++) total += niveles[l].A->getNoCeros();
+    return total / std::max(1, niveles[0].A->getNoCeros());
+}
+
+void MultigridAlgebraico::aplicar(const double* r, double* z) const {
+    int n = niveles[0].A->getRows();
+    std::unique_ptr<VectoresNivel[]> vectores = reservarVectores();
+    VectoresNivel& V = vectores[0];
+    std::copy(r, r + n, V.b.get());
+    std::fill(V.x.get(), V.x.get() + n, 0.0);
+    ciclo(0, vectores.get());
+    std::copy(V.x.get(), V.x.get() + n, z);
+}
+
+Matrix MultigridAlgebraico::resolver(const Matrix& b, const OpcionesIterativas& opcionesIteracion) const {
+    const SparseMatrix& A = *niveles[0].A;
+    int n = A.getRows();
+    if (b.getRows() != n || b.getCols() != 1) {
+        throw std::invalid_argument("Las dimensiones de A y b no son compatibles.");
+    }
+    const Matrix* inicial = opcionesIteracion.aproximacionInicial;
+    if (inicial != nullptr && (inicial->getRows() != n || inicial->getCols() != 1)) {
+        throw std::invalid_argument("La aproximación inicial debe ser un vector columna del tamaño del sistema.");
+    }
+    std::unique_ptr<double[]> anterior = std::make_unique<double[]>(n);
+    std::unique_ptr<VectoresNivel[]> vectores = reservarVectores();
+    VectoresNivel& V = vectores[0];
+    for (int i = 0; i < n; i++) {
+        V.b[i] = b.at(i, 0);
+        V.x[i] = inicial != nullptr ? inicial->at(i, 0) : 0.0;
+    }
+
+    ControlParada control(opcionesIteracion, b);
+    for (int iter = 0; iter < opcionesIteracion.maxIter; iter++) {
+        std::copy(V.x.get(), V.x.get() + n, anterior.get());
+        ciclo(0, vectores.get());
+        // El ciclo deja en V.b el término independiente original; el residuo se calcula en temporal
+        A.multiplicar(V.x.get(), V.temporal.get());
+        ResultadoBarrido resultado{0.0, 0.0};
+        for (int i = 0; i < n; i++) {
+            resultado.cambio = std::max(resultado.cambio, std::abs(V.x[i] - anterior[i]));
+            resultado.residuo = std::max(resultado.residuo, std::abs(V.b[i] - V.temporal[i]));
+        }
+        if (control.evaluar(resultado)) {
+            Matrix x(n, 1);
+            for (int i = 0; i < n; i++) x.at(i, 0) = V.x[i];
+            return x;
+        }
+    }
+    control.noConvergio();
+}
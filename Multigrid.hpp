@@ -0,0 +1,144 @@
+/**
+ * @file Multigrid.hpp
+ * @brief Declaración del método multimalla algebraico por agregación suavizada.
+ *
+ * Jacobi y Gauss-Seidel eliminan rápido las componentes oscilatorias del error pero casi no reducen las
+ * suaves, por eso sus iteraciones crecen con el tamaño del problema. El multimalla corrige las componentes
+ * suaves en una jerarquía de sistemas cada vez más pequeños (niveles gruesos), construidos solo a partir de
+ * los coeficientes de la matriz: las incógnitas fuertemente acopladas se agrupan en agregados y el
+ * prolongador constante por agregado se suaviza con un paso de Jacobi. Con los barridos de utils como
+ * suavizadores, el número de ciclos necesarios no depende del tamaño de la malla.
+ */
+#ifndef MULTIGRID_HPP
+#define MULTIGRID_HPP
+
+#include <memory>
+#include "Matrix.hpp"
+#include "SparseMatrix.hpp"
+#include "IterativeOptions.hpp"
+#include "Preconditioner.hpp"
+#include "LU.hpp"
+
+/**
+ * @brief Forma del ciclo multimalla.
+ */
+enum class CicloMultigrid {
+    V,  ///< Una corrección gruesa por nivel.
+    W   ///< Dos correcciones gruesas por nivel (más robusto, más costoso).
+};
+
+/**
+ * @brief Barrido usado para suavizar en cada nivel.
+ */
+enum class SuavizadorMultigrid {
+    Jacobi,      ///< Jacobi amortiguado con `pesoJacobi`.
+    GaussSeidel  ///< Gauss-Seidel hacia adelante al bajar y hacia atrás al subir (ciclo simétrico).
+};
+
+/**
+ * @brief Opciones de construcción y de ciclo del multimalla algebraico.
+ */
+struct OpcionesMultigrid {
+    CicloMultigrid ciclo = CicloMultigrid::V;                       ///< Forma del ciclo.
+    SuavizadorMultigrid suavizador = SuavizadorMultigrid::GaussSeidel; ///< Suavizador de cada nivel.
+    int presuavizado = 1;                                          ///< Barridos antes de la corrección gruesa.
+    int postsuavizado = 1;                                         ///< Barridos después de la corrección gruesa.
+    double pesoJacobi = 2.0 / 3.0;                                 ///< Amortiguamiento del suavizador de Jacobi.
+    double umbralFuerza = 0.08;                                    ///< θ: a_ij es fuerte si |a_ij| ≥ θ·sqrt(|a_ii·a_jj|).
+    int tamanoGrueso = 200;                                        ///< Tamaño a partir del cual se deja de engrosar.
+    int maxNiveles = 25;                                           ///< Número máximo de niveles de la jerarquía.
+    int maxTamanoDirecto = 4000;                                   ///< Tamaño máximo del nivel más grueso que se factoriza como matriz densa.
+    int barridosGruesos = 10;                                      ///< Pares de barridos (adelante y atrás) en el nivel más grueso si no se factoriza.
+};
+
+/**
+ * @class MultigridAlgebraico
+ * @brief Jerarquía multimalla por agregación suavizada, usable como método independiente o como precondicionador.
+ *
+ * La construcción (fase de configuración) se hace una sola vez por matriz; cada ciclo cuesta O(nnz).
+ * La matriz del nivel más fino no se copia: debe seguir existiendo mientras se use el objeto.
+ * Como precondicionador aplica un ciclo partiendo de cero; con Gauss-Seidel o Jacobi el ciclo es simétrico
+ * y puede usarse con gradienteConjugado. Los vectores de trabajo de cada nivel se reservan en cada llamada a
+ * `aplicar` o `resolver`, así que varios hilos pueden usar la misma jerarquía a la vez.
+ */
+class MultigridAlgebraico : public Precondicionador {
+    private:
+        struct Nivel {
+            const SparseMatrix* A;            // Matriz del nivel (la del usuario en el nivel 0). //
+            SparseMatrix propia;              // Almacén de la matriz en los niveles gruesos. //
+            SparseMatrix P;                   // Prolongador hacia este nivel desde el siguiente. //
+            SparseMatrix R;                   // Restricción (Pᵀ). //
+        };
+
+        /**
+        * @brief Vectores de trabajo de un nivel durante un ciclo.
+        */
+        struct VectoresNivel {
+            std::unique_ptr<double[]> x, b, r, temporal;
+        };
+
+        OpcionesMultigrid opciones;
+        int numNiveles;
+        std::unique_ptr<Nivel[]> niveles;
+        std::unique_ptr<FactorizacionLU> directo; // Nulo si el nivel más grueso excede maxTamanoDirecto. //
+
+        bool engrosar(int nivel);
+        std::unique_ptr<VectoresNivel[]> reservarVectores() const;
+        void suavizar(int nivel, VectoresNivel& V, int barridos, bool haciaAtras) const;
+        void ciclo(int nivel, VectoresNivel* vectores) const;
+    public:
+        /**
+        * @brief Construye la jerarquía para la matriz A.
+        *
+        * El nivel más grueso se factoriza con FactorizacionLU sobre su forma densa. Si la agregación se detiene antes
+        * de llegar a `maxTamanoDirecto` incógnitas (por `maxNiveles` o porque ya no reduce el problema), ese nivel
+        * no se densifica: se aproxima con `barridosGruesos` pares de barridos del suavizador.
+        *
+        * @param A Matriz dispersa cuadrada, típicamente simétrica definida positiva.
+        * @param opciones Opciones de construcción y de ciclo.
+        *
+        * @throws std::invalid_argument Si A no es cuadrada o las opciones no son válidas.
+        * @throws std::runtime_error Si la matriz del nivel más grueso es singular.
+        */
+        explicit MultigridAlgebraico(const SparseMatrix& A, const OpcionesMultigrid& opciones = OpcionesMultigrid());
+
+        int getSize() const override;
+
+        /**
+        * @brief Devuelve el número de niveles de la jerarquía (1 si A ya era pequeña).
+        */
+        int getNumNiveles() const;
+
+        /**
+        * @brief Devuelve el número de incógnitas del nivel indicado (0 es el más fino).
+        *
+        * @throws std::out_of_range Si el nivel no existe.
+        */
+        int getTamanoNivel(int nivel) const;
+
+        /**
+        * @brief Complejidad de operador: entradas de todos los niveles entre las del nivel más fino.
+        */
+        double getComplejidadOperador() const;
+
+        /**
+        * @brief Aplica un ciclo partiendo de z = 0 (uso como precondicionador).
+        */
+        void aplicar(const double* r, double* z) const override;
+
+        /**
+        * @brief Resuelve A·x = b con ciclos sucesivos hasta cumplir el criterio de parada.
+        *
+        * El residuo se calcula exactamente al final de cada ciclo (un producto matriz-vector).
+        *
+        * @param b Vector columna de términos independientes.
+        * @param opcionesIteracion Tolerancia, criterio, ciclos máximos, aproximación inicial y estadísticas.
+        * @return Matrix Vector solución del sistema.
+        *
+        * @throw std::invalid_argument Si las dimensiones no son compatibles.
+        * @throw std::runtime_error Si el método no converge, diverge o se estanca.
+        */
+        Matrix resolver(const Matrix& b, const OpcionesIterativas& opcionesIteracion) const;
+};
+
+#endif
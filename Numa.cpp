@@ -0,0 +1,265 @@
+/**
+ * @file Numa.cpp
+ * @brief Implementación de la detección de la topología NUMA y de la fijación de hilos.
+ *
+ * @section features_sec Características principales
+ * -Lectura de los nodos, núcleos y memoria desde /sys/devices/system/node.
+ * -Políticas de afinidad compacta y dispersa con pthread_setaffinity_np.
+ */
+#include "Numa.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+#include "String.hpp"
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace {
+
+/**
+ * @brief Lee la primera línea de un archivo; devuelve false si no existe.
+ */
+bool leerLinea(const char* ruta, char* linea, int capacidad) {
+    std::FILE* archivo = std::fopen(ruta, "r");
+    if (archivo == nullptr) return false;
+    bool leida = std::fgets(linea, capacidad, archivo) != nullptr;
+    std::fclose(archivo);
+    return leida;
+}
+
+/**
+ * @brief Máximo de elementos que se leen de una lista de nodos o núcleos del kernel.
+ */
+const int MAX_ELEMENTOS_LISTA = 8192;
+
+/**
+ * @brief Interpreta una lista del kernel como "0-3,8-11" y escribe sus elementos en `valores`.
+ *
+ * @return int Número de elementos escritos (a lo más `capacidad`; el resto se descarta).
+ */
+int interpretarLista(const char* texto, int* valores, int capacidad) {
+    const char* c = texto;
+    int cantidad = 0;
+    while (*c != '\0' && *c != '\n') {
+        char* fin = nullptr;
+        long desde = std::strtol(c, &fin, 10);
+        if (fin == c) break;
+        long hasta = desde;
+        c = fin;
+        if (*c == '-') {
+            hasta = std::strtol(c + 1, &fin, 10);
+            c = fin;
+        }
+        for (long v = desde; v <= hasta && cantidad < capacidad; v++) valores[cantidad++] = static_cast<int>(v);
+        if (*c == ',') c++;
+    }
+    return cantidad;
+}
+
+/**
+ * @brief Lee la memoria total del nodo de su archivo meminfo ("Node 0 MemTotal: 123 kB").
+ */
+long long leerMemoriaNodo(int nodo) {
+    String nodoStr; nodoStr.fromInt(nodo);
+    String ruta = String("/sys/devices/system/node/node") + nodoStr + String("/meminfo");
+    std::FILE* archivo = std::fopen(ruta.c_str(), "r");
+    if (archivo == nullptr) return 0;
+    char linea[256];
+    long long memoria = 0;
+    while (std::fgets(linea, sizeof(linea), archivo) != nullptr) {
+        int id = 0;
+        long long valor = 0;
+        if (std::sscanf(linea, "Node %d MemTotal: %lld", &id, &valor) == 2) {
+            memoria = valor;
+            break;
+        }
+    }
+    std::fclose(archivo);
+    return memoria;
+}
+
+} // namespace
+
+TopologiaNuma::TopologiaNuma() : numNodos(0) {}
+
+TopologiaNuma::TopologiaNuma(const TopologiaNuma& other) : numNodos(other.numNodos) {
+    int total = other.getNumCpus();
+    idNodo = std::make_unique<int[]>(numNodos);
+    inicioCpus = std::make_unique<int[]>(numNodos + 1);
+    cpus = std::make_unique<int[]>(total);
+    memoriaKB = std::make_unique<long long[]>(numNodos);
+    std::copy(other.idNodo.get(), other.idNodo.get() + numNodos, idNodo.get());
+    std::copy(other.inicioCpus.get(), other.inicioCpus.get() + numNodos + 1, inicioCpus.get());
+    std::copy(other.cpus.get(), other.cpus.get() + total, cpus.get());
+    std::copy(other.memoriaKB.get(), other.memoriaKB.get() + numNodos, memoriaKB.get());
+}
+
+TopologiaNuma& TopologiaNuma::operator=(const TopologiaNuma& other) {
+    if (this != &other) {
+        TopologiaNuma copia(other);
+        *this = std::move(copia);
+    }
+    return *this;
+}
+
+TopologiaNuma TopologiaNuma::detectar() {
+    char linea[4096];
+    const int capacidad = MAX_ELEMENTOS_LISTA;
+    std::unique_ptr<int[]> candidatos = std::make_unique<int[]>(capacidad);
+    std::unique_ptr<int[]> nodos = std::make_unique<int[]>(capacidad);
+    std::unique_ptr<int[]> inicio = std::make_unique<int[]>(capacidad + 1);
+    std::unique_ptr<int[]> listaCpus = std::make_unique<int[]>(capacidad);
+    std::unique_ptr<long long[]> memorias = std::make_unique<long long[]>(capacidad);
+    int numNodos = 0;
+    int numCpus = 0;
+
+    if (leerLinea("/sys/devices/system/node/online", linea, sizeof(linea))) {
+        int numCandidatos = interpretarLista(linea, candidatos.get(), capacidad);
+        for (int c = 0; c < numCandidatos; c++) {
+            int nodo = candidatos[c];
+            String nodoStr; nodoStr.fromInt(nodo);
+            String ruta = String("/sys/devices/system/node/node") + nodoStr + String("/cpulist");
+            int propios = 0;
+            if (leerLinea(ruta.c_str(), linea, sizeof(linea))) {
+                propios = interpretarLista(linea, listaCpus.get() + numCpus, capacidad - numCpus);
+            }
+            if (propios == 0) continue; // Nodos solo de memoria: no tienen núcleos donde fijar hilos
+            nodos[numNodos] = nodo;
+            memorias[numNodos] = leerMemoriaNodo(nodo);
+            numCpus += propios;
+            inicio[++numNodos] = numCpus;
+        }
+    }
+    if (numNodos == 0) {
+        // Sin información NUMA: un solo nodo con los núcleos en línea
+        numCpus = 0;
+        if (leerLinea("/sys/devices/system/cpu/online", linea, sizeof(linea))) {
+            numCpus = interpretarLista(linea, listaCpus.get(), capacidad);
+        }
+        if (numCpus == 0) {
+            numCpus = std::min(capacidad, std::max(1, static_cast<int>(std::thread::hardware_concurrency())));
+            for (int cpu = 0; cpu < numCpus; cpu++) listaCpus[cpu] = cpu;
+        }
+        nodos[0] = 0;
+        memorias[0] = 0;
+        numNodos = 1;
+        inicio[1] = numCpus;
+    }
+    inicio[0] = 0;
+
+    TopologiaNuma topologia;
+    topologia.numNodos = numNodos;
+    topologia.idNodo = std::make_unique<int[]>(numNodos);
+    topologia.inicioCpus = std::make_unique<int[]>(numNodos + 1);
+    topologia.cpus = std::make_unique<int[]>(numCpus);
+    topologia.memoriaKB = std::make_unique<long long[]>(numNodos);
+    std::copy(nodos.get(), nodos.get() + numNodos, topologia.idNodo.get());
+    std::copy(inicio.get(), inicio.get() + numNodos + 1, topologia.inicioCpus.get());
+    std::copy(listaCpus.get(), listaCpus.get() + numCpus, topologia.cpus.get());
+    std::copy(memorias.get(), memorias.get() + numNodos, topologia.memoriaKB.get());
+    return topologia;
+}
+
+int TopologiaNuma::getNumNodos() const {
+    return numNodos;
+}
+
+int TopologiaNuma::getIdNodo(int k) const {
+    if (k < 0 || k >= numNodos) {
+        throw std::out_of_range("Nodo fuera de rango.");
+    }
+    return idNodo[k];
+}
+
+int TopologiaNuma::getNumCpus() const {
+    return numNodos > 0 ? inicioCpus[numNodos] : 0;
+}
+
+int TopologiaNuma::getNumCpusNodo(int k) const {
+    if (k < 0 || k >= numNodos) {
+        throw std::out_of_range("Nodo fuera de rango.");
+    }
+    return inicioCpus[k + 1] - inicioCpus[k];
+}
+
+int TopologiaNuma::getCpu(int k, int i) const {
+    if (i < 0 || i >= getNumCpusNodo(k)) {
+        throw std::out_of_range("Núcleo fuera de rango.");
+    }
+    return cpus[inicioCpus[k] + i];
+}
+
+long long TopologiaNuma::getMemoriaKB(int k) const {
+    if (k < 0 || k >= numNodos) {
+        throw std::out_of_range("Nodo fuera de rango.");
+    }
+    return memoriaKB[k];
+}
+
+int TopologiaNuma::nodoDeCpu(int cpu) const {
+    for (int k = 0; k < numNodos; k++) {
+        for (int p = inicioCpus[k]; p < inicioCpus[k + 1]; p++) {
+            if (cpus[p] == cpu) return k;
+        }
+    }
+    return -1;
+}
+
+int TopologiaNuma::cpuParaHilo(PoliticaAfinidad politica, int hilo) const {
+    int total = getNumCpus();
+    if (politica == PoliticaAfinidad::Ninguna || total == 0 || hilo < 0) {
+        return -1;
+    }
+    if (politica == PoliticaAfinidad::Compacta) {
+        return cpus[hilo % total];
+    }
+    // Dispersa: nodo hilo % numNodos y, dentro de él, el siguiente núcleo libre
+    int nodo = hilo % numNodos;
+    int posicion = (hilo / numNodos) % getNumCpusNodo(nodo);
+    return cpus[inicioCpus[nodo] + posicion];
+}
+
+void TopologiaNuma::imprimir() const {
+    std::cout << "Topología: " << numNodos << (numNodos == 1 ? " nodo" : " nodos") << " NUMA, "
+              << getNumCpus() << " núcleos en línea.\n";
+    for (int k = 0; k < numNodos; k++) {
+        std::cout << "Nodo " << idNodo[k] << ": " << getNumCpusNodo(k) << " núcleos (";
+        for (int p = inicioCpus[k]; p < inicioCpus[k + 1]; p++) {
+            std::cout << (p > inicioCpus[k] ? "," : "") << cpus[p];
+        }
+        std::cout << ")";
+        if (memoriaKB[k] > 0) {
+            std::cout << ", " << memoriaKB[k] / 1024 << " MiB de memoria";
+        }
+        std::cout << "\n";
+    }
+}
+
+const TopologiaNuma& topologiaSistema() {
+    static const TopologiaNuma topologia = TopologiaNuma::detectar();
+    return topologia;
+}
+
+bool fijarHiloActual(int cpu) {
+#ifdef __linux__
+    if (cpu < 0 || cpu >= CPU_SETSIZE) return false;
+    cpu_set_t conjunto;
+    CPU_ZERO(&conjunto);
+    CPU_SET(cpu, &conjunto);
+    return pthread_setaffinity_np(pthread_self(), sizeof(conjunto), &conjunto) == 0;
+#else
+    (void)cpu;
+    return false;
+#endif
+}
+
+bool fijarHilo(PoliticaAfinidad politica, int hilo) {
+    int cpu = topologiaSistema().cpuParaHilo(politica, hilo);
+    return cpu >= 0 && fijarHiloActual(cpu);
+}
@@ -0,0 +1,116 @@
+/**
+ * @file Numa.hpp
+ * @brief Declaración de la detección de la topología NUMA y de la fijación de hilos a núcleos.
+ *
+ * En una máquina de varios sockets cada nodo NUMA tiene su propia memoria; un hilo que lee memoria de otro
+ * nodo obtiene aproximadamente la mitad del ancho de banda. Para que los barridos de Jacobi y las
+ * eliminaciones aprovechen todo el ancho de banda, cada hilo debe quedarse en un núcleo fijo y encontrar
+ * sus datos en la memoria de su nodo: la solución por lotes y los métodos por bloques reservan y ponen en
+ * cero cada bloque en el hilo que lo procesará (política de primer toque, ver LoteSistemas). Matrix no se
+ * reparte entre nodos: sus filas quedan donde las reserva el hilo que la construye.
+ */
+#ifndef NUMA_HPP
+#define NUMA_HPP
+
+#include <memory>
+
+/**
+ * @brief Forma de asignar los hilos a los núcleos.
+ */
+enum class PoliticaAfinidad {
+    Ninguna,  ///< No fija los hilos; el sistema operativo decide.
+    Compacta, ///< Llena primero los núcleos del nodo 0, luego los del 1, etc. (comparten caché y memoria).
+    Dispersa  ///< Reparte los hilos entre los nodos de forma alternada (suma el ancho de banda de todos).
+};
+
+/**
+ * @class TopologiaNuma
+ * @brief Nodos NUMA de la máquina, con sus núcleos y su memoria, leídos de /sys/devices/system/node.
+ *
+ * Si la información no está disponible (otro sistema operativo o un kernel sin NUMA) se considera un solo
+ * nodo con todos los núcleos.
+ */
+class TopologiaNuma {
+    private:
+        int numNodos;
+        std::unique_ptr<int[]> idNodo;        // Número del nodo en el sistema. //
+        std::unique_ptr<int[]> inicioCpus;    // Los núcleos del nodo k son cpus[inicioCpus[k] .. inicioCpus[k+1]). //
+        std::unique_ptr<int[]> cpus;
+        std::unique_ptr<long long[]> memoriaKB;
+
+        TopologiaNuma();
+    public:
+        /**
+        * @brief Lee la topología de la máquina.
+        */
+        static TopologiaNuma detectar();
+
+        TopologiaNuma(const TopologiaNuma& other);
+        TopologiaNuma& operator=(const TopologiaNuma& other);
+        TopologiaNuma(TopologiaNuma&& other) noexcept = default;
+        TopologiaNuma& operator=(TopologiaNuma&& other) noexcept = default;
+
+        int getNumNodos() const;
+
+        /**
+        * @brief Número del nodo k en el sistema (puede no coincidir con k si hay nodos fuera de línea).
+        */
+        int getIdNodo(int k) const;
+
+        /**
+        * @brief Total de núcleos en línea.
+        */
+        int getNumCpus() const;
+
+        int getNumCpusNodo(int k) const;
+
+        /**
+        * @brief i-ésimo núcleo del nodo k.
+        *
+        * @throws std::out_of_range Si k o i están fuera de rango.
+        */
+        int getCpu(int k, int i) const;
+
+        /**
+        * @brief Memoria total del nodo k en KiB (0 si no se conoce).
+        */
+        long long getMemoriaKB(int k) const;
+
+        /**
+        * @brief Índice del nodo al que pertenece el núcleo `cpu`, o -1 si no está en línea.
+        */
+        int nodoDeCpu(int cpu) const;
+
+        /**
+        * @brief Núcleo asignado al hilo número `hilo` según la política (-1 con PoliticaAfinidad::Ninguna).
+        */
+        int cpuParaHilo(PoliticaAfinidad politica, int hilo) const;
+
+        /**
+        * @brief Imprime los nodos, sus núcleos y su memoria.
+        */
+        void imprimir() const;
+};
+
+/**
+ * @brief Topología de la máquina, detectada una sola vez.
+ */
+const TopologiaNuma& topologiaSistema();
+
+/**
+ * @brief Fija el hilo que llama al núcleo `cpu`.
+ *
+ * @return true si se pudo fijar; false si la plataforma no lo permite o el núcleo no existe.
+ */
+bool fijarHiloActual(int cpu);
+
+/**
+ * @brief Fija el hilo que llama al núcleo que le corresponde al hilo número `hilo` según la política.
+ *
+ * Con PoliticaAfinidad::Ninguna no hace nada. Está pensada para llamarse al inicio de cada hilo de un método paralelo.
+ *
+ * @return true si el hilo quedó fijado.
+ */
+bool fijarHilo(PoliticaAfinidad politica, int hilo);
+
+#endif
@@ -0,0 +1,218 @@
+/**
+ * @file PerfCounters.cpp
+ * @brief Implementación de las sesiones y regiones de medición con contadores de hardware.
+ *
+ * @section features_sec Características principales
+ * -Grupo de contadores perf_event_open leído con una sola llamada por extremo de región.
+ * -Escalado de los valores cuando el núcleo multiplexa los contadores.
+ * -Degradación a solo tiempo y operaciones cuando los contadores no están disponibles.
+ */
+#include "PerfCounters.hpp"
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+
+#ifdef __linux__
+#include <cerrno>
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+thread_local SesionRendimiento* sesionActiva = nullptr;
+
+const double BYTES_POR_LINEA = 64.0;
+
+double segundosActuales() {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+#ifdef __linux__
+/**
+ * @brief Abre un contador de hardware del hilo actual en modo usuario; devuelve -1 si no se puede.
+ */
+int abrirContador(std::uint64_t configuracion, int grupo) {
+    perf_event_attr atributos;
+    std::memset(&atributos, 0, sizeof(atributos));
+    atributos.size = sizeof(atributos);
+    atributos.type = PERF_TYPE_HARDWARE;
+    atributos.config = configuracion;
+    atributos.disabled = grupo == -1 ? 1 : 0;
+    atributos.exclude_kernel = 1;
+    atributos.exclude_hv = 1;
+    atributos.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    long descriptor = syscall(SYS_perf_event_open, &atributos, 0, -1, grupo, PERF_FLAG_FD_CLOEXEC);
+    return static_cast<int>(descriptor);
+}
+#endif
+
+} // namespace
+
+bool MedicionRendimiento::tieneContador(ContadorHardware contador) const {
+    return disponible[static_cast<int>(contador)];
+}
+
+const ContadoresRegion& MedicionRendimiento::region(RegionMedida region) const {
+    return regiones[static_cast<int>(region)];
+}
+
+double MedicionRendimiento::ipc(RegionMedida r) const {
+    const ContadoresRegion& datos = region(r);
+    double ciclos = datos.contadores[static_cast<int>(ContadorHardware::Ciclos)];
+    if (!tieneContador(ContadorHardware::Ciclos) || !tieneContador(ContadorHardware::Instrucciones) || ciclos <= 0.0) {
+        return NAN;
+    }
+    return datos.contadores[static_cast<int>(ContadorHardware::Instrucciones)] / ciclos;
+}
+
+double MedicionRendimiento::gflops(RegionMedida r) const {
+    const ContadoresRegion& datos = region(r);
+    if (datos.operaciones <= 0.0 || datos.segundos <= 0.0) {
+        return NAN;
+    }
+    return datos.operaciones / datos.segundos * 1e-9;
+}
+
+double MedicionRendimiento::bytesPorOperacion(RegionMedida r) const {
+    const ContadoresRegion& datos = region(r);
+    if (!tieneContador(ContadorHardware::FallosCache) || datos.operaciones <= 0.0) {
+        return NAN;
+    }
+    return datos.contadores[static_cast<int>(ContadorHardware::FallosCache)] * BYTES_POR_LINEA / datos.operaciones;
+}
+
+void MedicionRendimiento::imprimir() const {
+    std::streamsize precisionOriginal = std::cout.precision();
+    for (int k = 0; k < CANTIDAD_REGIONES_MEDIDAS; k++) {
+        RegionMedida r = static_cast<RegionMedida>(k);
+        const ContadoresRegion& datos = regiones[k];
+        if (datos.llamadas == 0) continue;
+        std::cout << "  " << std::left << std::setw(12) << nombreRegionMedida(r) << std::right << std::fixed
+                  << std::setprecision(4) << datos.segundos << " s";
+        double valores[3] = {gflops(r), ipc(r), bytesPorOperacion(r)};
+        const char* etiquetas[3] = {" GFLOP/s", " IPC", " bytes/flop"};
+        std::cout << std::setprecision(2);
+        for (int m = 0; m < 3; m++) {
+            std::cout << ", ";
+            if (std::isnan(valores[m])) {
+                std::cout << "n/d";
+            } else {
+                std::cout << valores[m];
+            }
+            std::cout << etiquetas[m];
+        }
+        std::cout << "\n";
+        std::cout.unsetf(std::ios::floatfield);
+    }
+    std::cout.precision(precisionOriginal);
+}
+
+SesionRendimiento::SesionRendimiento(MedicionRendimiento* destino)
+    : destino(destino), anterior(sesionActiva), abiertos(0), lider(-1) {
+    for (int k = 0; k < CANTIDAD_CONTADORES; k++) {
+        descriptores[k] = -1;
+        posicion[k] = -1;
+    }
+    if (destino == nullptr) return;
+#ifdef __linux__
+    const std::uint64_t configuraciones[CANTIDAD_CONTADORES] = {
+        PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES
+    };
+    int error = 0;
+    for (int k = 0; k < CANTIDAD_CONTADORES; k++) {
+        int descriptor = abrirContador(configuraciones[k], lider);
+        if (descriptor < 0) {
+            if (error == 0) error = errno;
+            continue;
+        }
+        if (lider == -1) lider = descriptor;
+        descriptores[k] = descriptor;
+        posicion[k] = abiertos++;
+        destino->disponible[k] = true;
+    }
+    if (lider != -1) {
+        ioctl(lider, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(lider, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    } else {
+        destino->motivo = String("perf_event_open falló (") + String(std::strerror(error)) + String(")");
+    }
+#else
+    destino->motivo = String("la plataforma no tiene perf_event_open");
+#endif
+    sesionActiva = this;
+}
+
+SesionRendimiento::~SesionRendimiento() {
+    if (destino == nullptr) return;
+#ifdef __linux__
+    for (int k = 0; k < CANTIDAD_CONTADORES; k++) {
+        if (descriptores[k] != -1 && descriptores[k] != lider) close(descriptores[k]);
+    }
+    if (lider != -1) close(lider);
+#endif
+    sesionActiva = anterior;
+}
+
+SesionRendimiento* SesionRendimiento::activa() {
+    return sesionActiva;
+}
+
+MedicionRendimiento* SesionRendimiento::getDestino() const {
+    return destino;
+}
+
+bool SesionRendimiento::leer(double* valores) const {
+#ifdef __linux__
+    if (lider == -1) return false;
+    // Formato del grupo: número de contadores, tiempo habilitado, tiempo en ejecución y los valores
+    std::uint64_t datos[3 + CANTIDAD_CONTADORES];
+    ssize_t leidos = read(lider, datos, sizeof(datos));
+    if (leidos < static_cast<ssize_t>((3 + abiertos) * sizeof(std::uint64_t))) return false;
+    // Si el núcleo multiplexó los contadores, se extrapola al tiempo completo
+    double escala = datos[2] > 0 ? static_cast<double>(datos[1]) / static_cast<double>(datos[2]) : 1.0;
+    for (int k = 0; k < CANTIDAD_CONTADORES; k++) {
+        valores[k] = posicion[k] >= 0 ? static_cast<double>(datos[3 + posicion[k]]) * escala : 0.0;
+    }
+    return true;
+#else
+    (void)valores;
+    return false;
+#endif
+}
+
+RegionRendimiento::RegionRendimiento(RegionMedida region, double operaciones)
+    : sesion(sesionActiva), region(region), operaciones(operaciones), inicio(0.0), contadoresLeidos(false) {
+    if (sesion == nullptr) return;
+    contadoresLeidos = sesion->leer(valoresIniciales);
+    inicio = segundosActuales();
+}
+
+RegionRendimiento::~RegionRendimiento() {
+    if (sesion == nullptr) return;
+    double fin = segundosActuales();
+    ContadoresRegion& datos = sesion->getDestino()->regiones[static_cast<int>(region)];
+    datos.llamadas++;
+    datos.segundos += fin - inicio;
+    datos.operaciones += operaciones;
+    double valoresFinales[CANTIDAD_CONTADORES];
+    if (contadoresLeidos && sesion->leer(valoresFinales)) {
+        for (int k = 0; k < CANTIDAD_CONTADORES; k++) {
+            datos.contadores[k] += valoresFinales[k] - valoresIniciales[k];
+        }
+    }
+}
+
+const char* nombreRegionMedida(RegionMedida region) {
+    switch (region) {
+    case RegionMedida::Eliminacion: return "eliminacion";
+    case RegionMedida::Sustitucion: return "sustitucion";
+    case RegionMedida::Iteracion: return "iteracion";
+    }
+    return "desconocida";
+}
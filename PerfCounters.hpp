@@ -0,0 +1,168 @@
+/**
+ * @file PerfCounters.hpp
+ * @brief Declaración de la medición con contadores de hardware de las regiones críticas de los métodos.
+ *
+ * El tiempo total de una solución no indica si la eliminación está limitada por el cómputo, por el ancho de
+ * banda de la memoria o por los fallos de caché. Las regiones de la eliminación, la sustitución y las
+ * iteraciones leen los contadores de Linux (perf_event_open: ciclos, instrucciones y fallos del último nivel
+ * de caché) y acumulan también el tiempo y las operaciones de punto flotante que cuenta el propio método,
+ * de donde se obtienen el IPC, los GFLOP/s alcanzados y los bytes traídos de memoria por operación.
+ *
+ * La medición es opcional: las regiones solo hacen algo si el hilo tiene una SesionRendimiento activa.
+ * Si los contadores no están disponibles (otro sistema operativo, un contenedor sin permisos o
+ * perf_event_paranoid demasiado alto) se siguen midiendo el tiempo y las operaciones.
+ */
+#ifndef PERF_COUNTERS_HPP
+#define PERF_COUNTERS_HPP
+
+#include "String.hpp"
+
+/**
+ * @brief Contadores de hardware que se intentan abrir.
+ */
+enum class ContadorHardware {
+    Ciclos,        ///< Ciclos del procesador en modo usuario.
+    Instrucciones, ///< Instrucciones completadas en modo usuario.
+    FallosCache    ///< Fallos del último nivel de caché (cada uno trae una línea de 64 bytes de memoria).
+};
+
+/**
+ * @brief Cantidad de valores de ContadorHardware.
+ */
+const int CANTIDAD_CONTADORES = 3;
+
+/**
+ * @brief Partes de los métodos que se miden por separado.
+ */
+enum class RegionMedida {
+    Eliminacion, ///< Eliminación hacia adelante o factorización.
+    Sustitucion, ///< Sustitución regresiva o eliminación hacia atrás.
+    Iteracion    ///< Barridos de Jacobi y Gauss-Seidel y productos A·x de los métodos de Krylov.
+};
+
+/**
+ * @brief Cantidad de valores de RegionMedida.
+ */
+const int CANTIDAD_REGIONES_MEDIDAS = 3;
+
+/**
+ * @brief Valores acumulados de todas las ejecuciones de una región.
+ */
+struct ContadoresRegion {
+    int llamadas = 0;                              ///< Veces que se ejecutó la región.
+    double segundos = 0.0;                         ///< Tiempo de pared total.
+    double operaciones = 0.0;                      ///< Operaciones de punto flotante según el método (0 si no se conocen).
+    double contadores[CANTIDAD_CONTADORES] = {};   ///< Valores de los contadores de hardware disponibles.
+};
+
+/**
+ * @brief Resultado de una sesión de medición; las métricas que no pueden calcularse valen NaN.
+ */
+struct MedicionRendimiento {
+    bool disponible[CANTIDAD_CONTADORES] = {};     ///< Contadores que se pudieron abrir.
+    ContadoresRegion regiones[CANTIDAD_REGIONES_MEDIDAS];
+    String motivo;                                 ///< Por qué no hay contadores, si no se abrió ninguno.
+
+    /**
+    * @brief Indica si el contador se abrió en la sesión.
+    */
+    bool tieneContador(ContadorHardware contador) const;
+
+    /**
+    * @brief Valores de una región.
+    */
+    const ContadoresRegion& region(RegionMedida region) const;
+
+    /**
+    * @brief Instrucciones por ciclo de la región.
+    */
+    double ipc(RegionMedida region) const;
+
+    /**
+    * @brief Miles de millones de operaciones de punto flotante por segundo en la región.
+    */
+    double gflops(RegionMedida region) const;
+
+    /**
+    * @brief Bytes traídos de memoria (fallos de caché · 64) por operación de punto flotante.
+    */
+    double bytesPorOperacion(RegionMedida region) const;
+
+    /**
+    * @brief Imprime una línea por cada región ejecutada, con sus métricas ("n/d" si no pueden calcularse).
+    */
+    void imprimir() const;
+};
+
+/**
+ * @class SesionRendimiento
+ * @brief Abre los contadores para el hilo actual y activa la medición de las regiones mientras existe.
+ *
+ * Los contadores solo cuentan el hilo que creó la sesión. Las sesiones pueden anidarse: al destruirse se
+ * reactiva la anterior. Con destino nullptr la sesión no hace nada, lo que permite activarla según una opción.
+ */
+class SesionRendimiento {
+    private:
+        MedicionRendimiento* destino;
+        SesionRendimiento* anterior;
+        int descriptores[CANTIDAD_CONTADORES];
+        int posicion[CANTIDAD_CONTADORES];          // Lugar del contador en la lectura del grupo (-1 si no está). //
+        int abiertos;
+        int lider;
+    public:
+        explicit SesionRendimiento(MedicionRendimiento* destino);
+        ~SesionRendimiento();
+
+        SesionRendimiento(const SesionRendimiento&) = delete;
+        SesionRendimiento& operator=(const SesionRendimiento&) = delete;
+
+        /**
+        * @brief Sesión activa del hilo actual, o nullptr si no se está midiendo.
+        */
+        static SesionRendimiento* activa();
+
+        /**
+        * @brief Medición donde se acumulan las regiones.
+        */
+        MedicionRendimiento* getDestino() const;
+
+        /**
+        * @brief Lee los contadores abiertos en `valores` (indexado por ContadorHardware).
+        *
+        * @return false si no hay contadores o la lectura falló.
+        */
+        bool leer(double* valores) const;
+};
+
+/**
+ * @class RegionRendimiento
+ * @brief Mide el bloque donde vive (RAII) y lo acumula en la sesión activa del hilo.
+ *
+ * Sin sesión activa el constructor y el destructor solo consultan una variable del hilo.
+ */
+class RegionRendimiento {
+    private:
+        SesionRendimiento* sesion;
+        RegionMedida region;
+        double operaciones;
+        double inicio;
+        double valoresIniciales[CANTIDAD_CONTADORES];
+        bool contadoresLeidos;
+    public:
+        /**
+        * @param region Parte del método que se mide.
+        * @param operaciones Operaciones de punto flotante que realizará el bloque (0 si no se conocen).
+        */
+        RegionRendimiento(RegionMedida region, double operaciones);
+        ~RegionRendimiento();
+
+        RegionRendimiento(const RegionRendimiento&) = delete;
+        RegionRendimiento& operator=(const RegionRendimiento&) = delete;
+};
+
+/**
+ * @brief Nombre de la región para reportes y JSON.
+ */
+const char* nombreRegionMedida(RegionMedida region);
+
+#endif
@@ -0,0 +1,40 @@
+/**
+ * @file Preconditioner.cpp
+ * @brief Implementación del precondicionador diagonal (Jacobi).
+ */
+#include "Preconditioner.hpp"
+#include <stdexcept>
+
+PrecondicionadorJacobi::PrecondicionadorJacobi(const SparseMatrix& A) : n(A.getRows()) {
+    if (A.getCols() != n) {
+        throw std::invalid_argument("El precondicionador requiere una matriz cuadrada.");
+    }
+    diagonalInversa = std::make_unique<double[]>(n);
+    A.diagonal(diagonalInversa.get());
+    invertirDiagonal();
+}
+
+PrecondicionadorJacobi::PrecondicionadorJacobi(const OperadorLineal& A) : n(A.getSize()) {
+    diagonalInversa = std::make_unique<double[]>(n);
+    A.diagonal(diagonalInversa.get());
+    invertirDiagonal();
+}
+
+void PrecondicionadorJacobi::invertirDiagonal() {
+    for (int i = 0; i < n; i++) {
+        if (diagonalInversa[i] == 0.0) {
+            throw std::runtime_error("La matriz tiene ceros en la diagonal; no se puede usar el precondicionador de Jacobi.");
+        }
+        diagonalInversa[i] = 1.0 / diagonalInversa[i];
+    }
+}
+
+int PrecondicionadorJacobi::getSize() const {
+    return n;
+}
+
+void PrecondicionadorJacobi::aplicar(const double* r, double* z) const {
+    for (int i = 0; i < n; i++) {
+        z[i] = diagonalInversa[i] * r[i];
+    }
+}
@@ -0,0 +1,73 @@
+/**
+ * @file Preconditioner.hpp
+ * @brief Declaración de la interfaz Precondicionador y del precondicionador diagonal (Jacobi).
+ *
+ * Un precondicionador M aproxima la inversa de A de forma barata: los métodos de Krylov resuelven
+ * M⁻¹·A·x = M⁻¹·b, cuyo número de condición es mucho menor, y cada iteración solo necesita aplicar M⁻¹
+ * a un vector. Las implementaciones (diagonal, multimalla, factorizaciones incompletas) comparten esta
+ * interfaz para poder intercambiarse sin modificar los métodos que las usan.
+ */
+#ifndef PRECONDITIONER_HPP
+#define PRECONDITIONER_HPP
+
+#include <memory>
+#include "SparseMatrix.hpp"
+#include "LinearOperator.hpp"
+
+/**
+ * @class Precondicionador
+ * @brief Interfaz de los precondicionadores: calcula z ≈ A⁻¹·r.
+ *
+ * `aplicar` es const para que pueda llamarse desde los métodos que reciben el precondicionador por
+ * referencia constante, y no modifica el objeto: los arreglos de trabajo son de cada llamada o son el
+ * propio vector de salida, así que un mismo precondicionador puede aplicarse desde varios hilos a la vez.
+ */
+class Precondicionador {
+    public:
+        virtual ~Precondicionador() = default;
+
+        /**
+        * @brief Devuelve el tamaño del sistema para el que se construyó.
+        */
+        virtual int getSize() const = 0;
+
+        /**
+        * @brief Calcula z ≈ A⁻¹·r.
+        *
+        * @param r Vector de `getSize()` elementos.
+        * @param z Vector de salida de `getSize()` elementos (distinto de r).
+        */
+        virtual void aplicar(const double* r, double* z) const = 0;
+};
+
+/**
+ * @class PrecondicionadorJacobi
+ * @brief Precondicionador diagonal: z_i = r_i / a_ii.
+ */
+class PrecondicionadorJacobi : public Precondicionador {
+    private:
+        int n;
+        std::unique_ptr<double[]> diagonalInversa;
+
+        void invertirDiagonal();
+    public:
+        /**
+        * @brief Construye el precondicionador a partir de la diagonal de A.
+        *
+        * @throws std::invalid_argument Si A no es cuadrada.
+        * @throws std::runtime_error Si algún elemento de la diagonal es cero.
+        */
+        explicit PrecondicionadorJacobi(const SparseMatrix& A);
+
+        /**
+        * @brief Construye el precondicionador a partir de la diagonal de un operador lineal.
+        *
+        * @throws std::runtime_error Si algún elemento de la diagonal es cero.
+        */
+        explicit PrecondicionadorJacobi(const OperadorLineal& A);
+
+        int getSize() const override;
+        void aplicar(const double* r, double* z) const override;
+};
+
+#endif
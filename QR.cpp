@@ -0,0 +1,469 @@
+/**
+ * @file QR.cpp
+ * @brief Implementación de la factorización QR de Householder por bloques y de los mínimos cuadrados.
+ *
+ * @section features_sec Características principales
+ * -Paneles copiados por columnas y factorizados reflector por reflector, y actualización del resto de la matriz con la representación
+ *  WY compacta (I - V·T·Vᵀ), como productos de matrices recorridos por filas.
+ * -Pivoteo de columnas por norma máxima, con actualización de las normas y recálculo cuando pierden precisión.
+ * -Mínimos cuadrados para m > n y solución de norma mínima para m < n sin formar Q ni las ecuaciones normales.
+ */
+#include "QR.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include "ExecutionControl.hpp"
+#include "PerfCounters.hpp"
+
+namespace {
+
+/**
+ * @brief Norma euclidiana de un vector contiguo, escalada para evitar desbordamientos.
+ */
+double normaVector(const double* x, int cantidad) {
+    double maximo = 0.0;
+    for (int i = 0; i < cantidad; i++) maximo = std::max(maximo, std::abs(x[i]));
+    if (maximo == 0.0) return 0.0;
+    double suma = 0.0;
+    for (int i = 0; i < cantidad; i++) {
+        double valor = x[i] / maximo;
+        suma += valor * valor;
+    }
+    return maximo * std::sqrt(suma);
+}
+
+/**
+ * @brief Norma euclidiana de la columna `col` en las filas [desde, hasta).
+ *
+ * `columna` es un espacio de trabajo de al menos hasta - desde elementos.
+ */
+double normaColumna(double* const* filas, int desde, int hasta, int col, double* columna) {
+    for (int i = desde; i < hasta; i++) columna[i - desde] = filas[i][col];
+    return normaVector(columna, hasta - desde);
+}
+
+/**
+ * @brief Genera el reflector que anula x[1..cantidad) (un vector contiguo).
+ *
+ * Deja β = ∓||x|| en x[0] y v (sin su primer elemento, que vale 1) en x[1..cantidad).
+ *
+ * @return double Coeficiente tau del reflector (0 si x ya es nulo después del primer elemento).
+ */
+double generarReflector(double* x, int cantidad) {
+    bool colaNula = true;
+    for (int i = 1; i < cantidad && colaNula; i++) colaNula = x[i] == 0.0;
+    if (colaNula) return 0.0;
+    double alfa = x[0];
+    double norma = normaVector(x, cantidad);
+    double beta = alfa >= 0.0 ? -norma : norma;
+    double escala = 1.0 / (alfa - beta);
+    for (int i = 1; i < cantidad; i++) x[i] *= escala;
+    x[0] = beta;
+    return (beta - alfa) / beta;
+}
+
+/**
+ * @brief Factoriza un panel de `ancho` columnas guardado por columnas (cada columna tiene `alto` elementos).
+ *
+ * Con las columnas contiguas cada reflector recorre memoria consecutiva, en lugar de tocar una línea de
+ * caché distinta por cada fila de la matriz.
+ */
+void factorizarPanel(double* panel, int alto, int ancho, double* tau) {
+    for (int j = 0; j < ancho && j < alto; j++) {
+        double* v = panel + static_cast<size_t>(j) * alto;
+        tau[j] = generarReflector(v + j, alto - j);
+        if (tau[j] == 0.0) continue;
+        for (int q = j + 1; q < ancho; q++) {
+            double* columna = panel + static_cast<size_t>(q) * alto;
+            double d = columna[j];
+            for (int i = j + 1; i < alto; i++) d += v[i] * columna[i];
+            d *= tau[j];
+            columna[j] -= d;
+            for (int i = j + 1; i < alto; i++) columna[i] -= d * v[i];
+        }
+    }
+}
+
+/**
+ * @brief Aplica H_j = I - tau·v·vᵀ a las columnas [desde, hasta) de las filas [j, m).
+ *
+ * `w` es un espacio de trabajo de al menos hasta - desde elementos.
+ */
+void aplicarReflector(double* const* filas, int m, int j, double tau, int desde, int hasta, double* w) {
+    if (tau == 0.0 || desde >= hasta) return;
+    int ancho = hasta - desde;
+    for (int c = 0; c < ancho; c++) w[c] = filas[j][desde + c];
+    for (int i = j + 1; i < m; i++) {
+        double v = filas[i][j];
+        if (v == 0.0) continue;
+        const double* fila = filas[i] + desde;
+        for (int c = 0; c < ancho; c++) w[c] += v * fila[c];
+    }
+    for (int c = 0; c < ancho; c++) {
+        w[c] *= tau;
+        filas[j][desde + c] -= w[c];
+    }
+    for (int i = j + 1; i < m; i++) {
+        double v = filas[i][j];
+        if (v == 0.0) continue;
+        double* fila = filas[i] + desde;
+        for (int c = 0; c < ancho; c++) fila[c] -= v * w[c];
+    }
+}
+
+/**
+ * @brief Operaciones de punto flotante de la factorización de Householder de una matriz de m x n.
+ */
+double operacionesQR(int m, int n) {
+    double filas = m, cols = n;
+    if (m >= n) return 2.0 * cols * cols * (filas - cols / 3.0);
+    return 2.0 * filas * filas * (cols - filas / 3.0);
+}
+
+/**
+ * @brief Punteros a las filas de una matriz, para los ciclos internos.
+ */
+std::unique_ptr<double*[]> punterosFilas(Matrix& A) {
+    std::unique_ptr<double*[]> filas(new double*[A.getRows()]);
+    for (int i = 0; i < A.getRows(); i++) filas[i] = &A.at(i, 0);
+    return filas;
+}
+
+/**
+ * @brief Verifica que `b` sea un vector columna de `filas` elementos.
+ */
+void verificarVector(const Matrix& b, int filas) {
+    if (b.getRows() != filas || b.getCols() != 1) {
+        throw std::invalid_argument("El vector no tiene las dimensiones de la factorización QR.");
+    }
+}
+
+} // namespace
+
+FactorizacionQR::FactorizacionQR(const Matrix& A, bool pivoteoColumnas, int tamanoBloque, double toleranciaRango)
+    : m(A.getRows()), n(A.getCols()), rango(0), pivoteo(pivoteoColumnas), factores(A) {
+    if (tamanoBloque <= 0) {
+        throw std::invalid_argument("El tamaño de bloque de la factorización QR debe ser positivo.");
+    }
+    int k = std::min(m, n);
+    tau = std::make_unique<double[]>(std::max(1, k));
+    columnas = std::make_unique<int[]>(std::max(1, n));
+    for (int j = 0; j < n; j++) columnas[j] = j;
+
+    {
+        RegionRendimiento region(RegionMedida::Eliminacion, operacionesQR(m, n));
+        if (pivoteo) {
+            factorizarConPivoteo();
+        } else {
+            factorizarBloques(tamanoBloque);
+        }
+    }
+
+    // Rango numérico: con pivoteo la diagonal decrece; sin él, cualquier elemento pequeño indica rango deficiente
+    double referencia = 0.0;
+    for (int j = 0; j < k; j++) referencia = std::max(referencia, std::abs(factores.at(j, j)));
+    double umbral = toleranciaRango * referencia;
+    while (rango < k && referencia > 0.0 && std::abs(factores.at(rango, rango)) > umbral) rango++;
+}
+
+/**
+ * @brief Factorización sin pivoteo por paneles de `tamanoBloque` columnas.
+ *
+ * Cada panel se copia por columnas y se factoriza reflector por reflector; después se forma T (triangular
+ * superior) tal que H_k···H_{k+b-1} = I - V·T·Vᵀ y el resto de la matriz C se actualiza como C - V·(Tᵀ·(Vᵀ·C)).
+ */
+void FactorizacionQR::factorizarBloques(int tamanoBloque) {
+    std::unique_ptr<double*[]> filas = punterosFilas(factores);
+    int k = std::min(m, n);
+    // Espacios de trabajo del panel más ancho, reservados una sola vez para toda la factorización
+    size_t anchoMaximo = std::min(tamanoBloque, k);
+    std::unique_ptr<double[]> w(new double[n]);
+    std::unique_ptr<double[]> panel(new double[static_cast<size_t>(m) * anchoMaximo]);
+    std::unique_ptr<double[]> T(new double[anchoMaximo * anchoMaximo]);
+    std::unique_ptr<double[]> gram(new double[anchoMaximo * anchoMaximo]);
+    std::unique_ptr<double[]> W(new double[anchoMaximo * n]);
+
+    for (int k0 = 0; k0 < k; k0 += tamanoBloque) {
+        verificarInterrupcion(RegionMedida::Eliminacion, k0, k);
+        int b = std::min(tamanoBloque, k - k0);
+        int finPanel = k0 + b;
+
+        // 1. Panel: se copia por columnas, se factoriza y se devuelve a sus filas
+        int alto = m - k0;
+        for (int i = k0; i < m; i++) {
+            const double* fila = filas[i] + k0;
+            for (int p = 0; p < b; p++) panel[static_cast<size_t>(p) * alto + (i - k0)] = fila[p];
+        }
+        factorizarPanel(panel.get(), alto, b, &tau[k0]);
+        for (int i = k0; i < m; i++) {
+            double* fila = filas[i] + k0;
+            for (int p = 0; p < b; p++) fila[p] = panel[static_cast<size_t>(p) * alto + (i - k0)];
+        }
+        int resto = n - finPanel;
+        if (resto <= 0) continue;
+        if (b == 1) {
+            aplicarReflector(filas.get(), m, k0, tau[k0], finPanel, n, w.get());
+            continue;
+        }
+
+        // 2. T a partir de los productos Vᵀ·V del panel (v_p es nulo arriba de la fila k0 + p)
+        std::fill(T.get(), T.get() + static_cast<size_t>(b) * b, 0.0);
+        std::fill(gram.get(), gram.get() + static_cast<size_t>(b) * b, 0.0);
+        for (int i = k0; i < m; i++) {
+            const double* fila = filas[i];
+            int activos = std::min(b, i - k0 + 1);
+            for (int p = 0; p < activos; p++) {
+                double vp = (i == k0 + p) ? 1.0 : fila[k0 + p];
+                for (int q = p + 1; q < activos; q++) {
+                    double vq = (i == k0 + q) ? 1.0 : fila[k0 + q];
+                    gram[static_cast<size_t>(p) * b + q] += vp * vq;
+                }
+            }
+        }
+        for (int q = 0; q < b; q++) {
+            double tq = tau[k0 + q];
+            T[static_cast<size_t>(q) * b + q] = tq;
+            // T[0:q, q] = -tau_q · T[0:q, 0:q] · (V[:, 0:q]ᵀ · v_q)
+            for (int p = 0; p < q; p++) {
+                double suma = 0.0;
+                for (int r = p; r < q; r++) {
+                    suma += T[static_cast<size_t>(p) * b + r] * gram[static_cast<size_t>(r) * b + q];
+                }
+                T[static_cast<size_t>(p) * b + q] = -tq * suma;
+            }
+        }
+
+        // 3. W = Vᵀ·C, recorriendo las filas de C una sola vez
+        std::fill(W.get(), W.get() + static_cast<size_t>(b) * resto, 0.0);
+        for (int i = k0; i < m; i++) {
+            const double* fila = filas[i];
+            const double* c = fila + finPanel;
+            int activos = std::min(b, i - k0 + 1);
+            for (int p = 0; p < activos; p++) {
+                double v = (i == k0 + p) ? 1.0 : fila[k0 + p];
+                if (v == 0.0) continue;
+                double* wp = &W[static_cast<size_t>(p) * resto];
+                for (int col = 0; col < resto; col++) wp[col] += v * c[col];
+            }
+        }
+        // 4. W = Tᵀ·W en el lugar (Tᵀ es triangular inferior: la fila p solo usa las filas q ≤ p)
+        for (int p = b - 1; p >= 0; p--) {
+            double* wp = &W[static_cast<size_t>(p) * resto];
+            double tpp = T[static_cast<size_t>(p) * b + p];
+            for (int col = 0; col < resto; col++) wp[col] *= tpp;
+            for (int q = 0; q < p; q++) {
+                double tqp = T[static_cast<size_t>(q) * b + p];
+                if (tqp == 0.0) continue;
+                const double* wq = &W[static_cast<size_t>(q) * resto];
+                for (int col = 0; col < resto; col++) wp[col] += tqp * wq[col];
+            }
+        }
+        // 5. C = C - V·W
+        for (int i = k0; i < m; i++) {
+            double* fila = filas[i];
+            double* c = fila + finPanel;
+            int activos = std::min(b, i - k0 + 1);
+            for (int p = 0; p < activos; p++) {
+                double v = (i == k0 + p) ? 1.0 : fila[k0 + p];
+                if (v == 0.0) continue;
+                const double* wp = &W[static_cast<size_t>(p) * resto];
+                for (int col = 0; col < resto; col++) c[col] -= v * wp[col];
+            }
+        }
+    }
+}
+
+/**
+ * @brief Factorización con pivoteo de columnas (Businger-Golub).
+ *
+ * Después de cada reflector las normas de las columnas restantes se actualizan con
+ * ||x'||² = ||x||² - r², y se recalculan cuando la actualización ya canceló demasiados dígitos.
+ */
+void FactorizacionQR::factorizarConPivoteo() {
+    std::unique_ptr<double*[]> filas = punterosFilas(factores);
+    int k = std::min(m, n);
+    std::unique_ptr<double[]> normas(new double[n]);
+    std::unique_ptr<double[]> originales(new double[n]);
+    std::unique_ptr<double[]> w(new double[n]);
+    std::unique_ptr<double[]> columna(new double[m]);
+    const double LIMITE = std::sqrt(std::numeric_limits<double>::epsilon());
+    for (int j = 0; j < n; j++) {
+        normas[j] = normaColumna(filas.get(), 0, m, j, columna.get());
+        originales[j] = normas[j];
+    }
+
+    for (int j = 0; j < k; j++) {
+        verificarInterrupcion(RegionMedida::Eliminacion, j, k);
+        int maxCol = j;
+        for (int col = j + 1; col < n; col++) {
+            if (normas[col] > normas[maxCol]) maxCol = col;
+        }
+        if (maxCol != j) {
+            for (int i = 0; i < m; i++) std::swap(filas[i][j], filas[i][maxCol]);
+            std::swap(normas[j], normas[maxCol]);
+            std::swap(originales[j], originales[maxCol]);
+            std::swap(columnas[j], columnas[maxCol]);
+        }
+
+        for (int i = j; i < m; i++) columna[i - j] = filas[i][j];
+        tau[j] = generarReflector(columna.get(), m - j);
+        for (int i = j; i < m; i++) filas[i][j] = columna[i - j];
+        aplicarReflector(filas.get(), m, j, tau[j], j + 1, n, w.get());
+
+        for (int col = j + 1; col < n; col++) {
+            if (normas[col] == 0.0) continue;
+            double razon = std::abs(filas[j][col]) / normas[col];
+            double factor = std::max(0.0, (1.0 + razon) * (1.0 - razon));
+            double relativa = normas[col] / originales[col];
+            if (factor * relativa * relativa <= LIMITE) {
+                normas[col] = normaColumna(filas.get(), j + 1, m, col, columna.get());
+                originales[col] = normas[col];
+            } else {
+                normas[col] *= std::sqrt(factor);
+            }
+        }
+    }
+}
+
+int FactorizacionQR::getRows() const {
+    return m;
+}
+
+int FactorizacionQR::getCols() const {
+    return n;
+}
+
+int FactorizacionQR::getRango() const {
+    return rango;
+}
+
+int FactorizacionQR::getColumna(int k) const {
+    if (k < 0 || k >= n) {
+        throw std::out_of_range("Columna fuera de rango.");
+    }
+    return columnas[k];
+}
+
+Matrix FactorizacionQR::getR() const {
+    int k = std::min(m, n);
+    Matrix R(std::max(1, k), n);
+    for (int i = 0; i < k; i++) {
+        for (int j = i; j < n; j++) R.at(i, j) = factores.at(i, j);
+    }
+    return R;
+}
+
+Matrix FactorizacionQR::aplicarQt(const Matrix& b) const {
+    verificarVector(b, m);
+    Matrix y(b);
+    int k = std::min(m, n);
+    // Qᵀ = H_{k-1}···H_0: los reflectores se aplican en orden
+    for (int j = 0; j < k; j++) {
+        if (tau[j] == 0.0) continue;
+        double d = y.at(j, 0);
+        for (int i = j + 1; i < m; i++) d += factores.at(i, j) * y.at(i, 0);
+        d *= tau[j];
+        y.at(j, 0) -= d;
+        for (int i = j + 1; i < m; i++) y.at(i, 0) -= d * factores.at(i, j);
+    }
+    return y;
+}
+
+Matrix FactorizacionQR::aplicarQ(const Matrix& y) const {
+    verificarVector(y, m);
+    Matrix x(y);
+    int k = std::min(m, n);
+    // Q = H_0···H_{k-1}: los reflectores se aplican en orden inverso
+    for (int j = k - 1; j >= 0; j--) {
+        if (tau[j] == 0.0) continue;
+        double d = x.at(j, 0);
+        for (int i = j + 1; i < m; i++) d += factores.at(i, j) * x.at(i, 0);
+        d *= tau[j];
+        x.at(j, 0) -= d;
+        for (int i = j + 1; i < m; i++) x.at(i, 0) -= d * factores.at(i, j);
+    }
+    return x;
+}
+
+Matrix FactorizacionQR::resolver(const Matrix& b, double* normaResiduo) const {
+    if (m < n) {
+        throw std::invalid_argument("Los mínimos cuadrados con QR requieren al menos tantas filas como columnas.");
+    }
+    verificarVector(b, m);
+    if (!pivoteo && rango < n) {
+        throw std::runtime_error("La matriz no tiene rango completo; use la factorización QR con pivoteo de columnas.");
+    }
+    RegionRendimiento region(RegionMedida::Sustitucion, 4.0 * m * n + static_cast<double>(rango) * rango);
+    Matrix y = aplicarQt(b);
+
+    // Sustitución regresiva con el bloque R₁₁ de r x r
+    std::unique_ptr<double[]> z(new double[std::max(1, rango)]);
+    for (int row = rango - 1; row >= 0; row--) {
+        double suma = y.at(row, 0);
+        for (int col = row + 1; col < rango; col++) suma -= factores.at(row, col) * z[col];
+        z[row] = suma / factores.at(row, row);
+    }
+    Matrix x(n, 1);
+    for (int j = 0; j < rango; j++) x.at(columnas[j], 0) = z[j];
+
+    if (normaResiduo != nullptr) {
+        // A·P·[z; 0] = Q·[R₁₁·z; 0], así que el residuo es la parte de Qᵀ·b que R no alcanza
+        double suma = 0.0;
+        for (int i = rango; i < m; i++) suma += y.at(i, 0) * y.at(i, 0);
+        *normaResiduo = std::sqrt(suma);
+    }
+    return x;
+}
+
+Matrix FactorizacionQR::resolverTraspuesta(const Matrix& c) const {
+    if (m < n) {
+        throw std::invalid_argument("La solución de norma mínima con QR requiere al menos tantas filas como columnas.");
+    }
+    verificarVector(c, n);
+    if (!pivoteo && rango < n) {
+        throw std::runtime_error("La matriz no tiene rango completo; use la factorización QR con pivoteo de columnas.");
+    }
+    RegionRendimiento region(RegionMedida::Sustitucion, 4.0 * m * n + static_cast<double>(rango) * rango);
+
+    // Sustitución progresiva con R₁₁ᵀ sobre Pᵀ·c
+    Matrix z(m, 1);
+    for (int row = 0; row < rango; row++) {
+        double suma = c.at(columnas[row], 0);
+        for (int col = 0; col < row; col++) suma -= factores.at(col, row) * z.at(col, 0);
+        z.at(row, 0) = suma / factores.at(row, row);
+    }
+    return aplicarQ(z);
+}
+
+Matrix minimosCuadrados(const Matrix& A, const Matrix& b, bool pivoteoColumnas, double* normaResiduo) {
+    int m = A.getRows();
+    int n = A.getCols();
+    if (b.getRows() != m || b.getCols() != 1) {
+        throw std::invalid_argument("El vector b debe tener una entrada por cada fila de A.");
+    }
+    if (m >= n) {
+        FactorizacionQR qr(A, pivoteoColumnas);
+        return qr.resolver(b, normaResiduo);
+    }
+
+    // Sistema subdeterminado: A = (Aᵀ)ᵀ y Aᵀ tiene más filas que columnas
+    Matrix traspuesta(n, m);
+    for (int i = 0; i < m; i++) {
+        for (int j = 0; j < n; j++) traspuesta.at(j, i) = A.at(i, j);
+    }
+    FactorizacionQR qr(traspuesta, pivoteoColumnas);
+    Matrix x = qr.resolverTraspuesta(b);
+    if (normaResiduo != nullptr) {
+        // Solo es distinto de cero si A tiene rango deficiente y el sistema es inconsistente
+        double suma = 0.0;
+        for (int i = 0; i < m; i++) {
+            double r = -b.at(i, 0);
+            for (int j = 0; j < n; j++) r += A.at(i, j) * x.at(j, 0);
+            suma += r * r;
+        }
+        *normaResiduo = std::sqrt(suma);
+    }
+    return x;
+}
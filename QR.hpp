@@ -0,0 +1,137 @@
+/**
+ * @file QR.hpp
+ * @brief Declaración de la factorización QR de Householder por bloques y de la solución por mínimos cuadrados.
+ *
+ * Los demás métodos del programa resuelven sistemas cuadrados. Para ajustar m observaciones con n parámetros
+ * (m > n) la alternativa habitual, las ecuaciones normales AᵀA·x = Aᵀb, eleva al cuadrado el número de
+ * condición y pierde la mitad de los dígitos; la factorización A = Q·R trabaja directamente con A.
+ *
+ * Los reflectores se agrupan en paneles de `tamanoBloque` columnas con la representación WY compacta
+ * H₁·H₂···H_b = I - V·T·Vᵀ, de modo que el resto de la matriz se actualiza con dos productos de matrices
+ * (Vᵀ·C y V·W) recorridos por filas, en lugar de una pasada completa por cada reflector.
+ */
+#ifndef QR_HPP
+#define QR_HPP
+
+#include <memory>
+#include "Matrix.hpp"
+
+/**
+ * @class FactorizacionQR
+ * @brief Factorización A·P = Q·R de una matriz de m x n mediante reflectores de Householder.
+ *
+ * Sin pivoteo P es la identidad y la factorización se hace por bloques. Con pivoteo de columnas cada paso
+ * elige la columna restante de mayor norma, de modo que la diagonal de R decrece y el rango numérico es el
+ * número de elementos de la diagonal mayores que `toleranciaRango`·|R₀₀|; esta variante necesita las normas
+ * actualizadas después de cada reflector y no usa bloques.
+ *
+ * Q no se forma: se guarda como los vectores de Householder debajo de la diagonal de R.
+ */
+class FactorizacionQR {
+    private:
+        int m;
+        int n;
+        int rango;
+        bool pivoteo;
+        Matrix factores;                 // R en el triángulo superior y los vectores v_k debajo (v_k[k] = 1 implícito). //
+        std::unique_ptr<double[]> tau;   // H_k = I - tau[k]·v_k·v_kᵀ. //
+        std::unique_ptr<int[]> columnas; // La columna k de A·P es la columna columnas[k] de A. //
+
+        void factorizarBloques(int tamanoBloque);
+        void factorizarConPivoteo();
+    public:
+        /**
+        * @brief Factoriza una copia de A (A no se modifica).
+        *
+        * @param A Matriz de m x n, de cualquier forma.
+        * @param pivoteoColumnas Si es verdadero, usa pivoteo de columnas para matrices de rango deficiente.
+        * @param tamanoBloque Columnas por panel de la versión por bloques (1 aplica los reflectores uno por uno).
+        * @param toleranciaRango Tolerancia relativa a |R₀₀| para decidir el rango numérico.
+        *
+        * @throws std::invalid_argument Si el tamaño de bloque no es positivo.
+        */
+        explicit FactorizacionQR(const Matrix& A, bool pivoteoColumnas = false, int tamanoBloque = 32,
+                                 double toleranciaRango = 1e-12);
+
+        int getRows() const;
+        int getCols() const;
+
+        /**
+        * @brief Rango numérico de A (sin pivoteo solo indica si A tiene rango completo).
+        */
+        int getRango() const;
+
+        /**
+        * @brief Columna de A que ocupa la posición k en A·P.
+        *
+        * @throws std::out_of_range Si k está fuera de rango.
+        */
+        int getColumna(int k) const;
+
+        /**
+        * @brief Devuelve R, de min(m, n) x n.
+        */
+        Matrix getR() const;
+
+        /**
+        * @brief Calcula Qᵀ·b para un vector columna de m elementos.
+        *
+        * @throws std::invalid_argument Si b no es un vector de m elementos.
+        */
+        Matrix aplicarQt(const Matrix& b) const;
+
+        /**
+        * @brief Calcula Q·y para un vector columna de m elementos.
+        *
+        * @throws std::invalid_argument Si y no es un vector de m elementos.
+        */
+        Matrix aplicarQ(const Matrix& y) const;
+
+        /**
+        * @brief Solución por mínimos cuadrados de A·x ≈ b (m ≥ n): minimiza ||A·x - b||₂.
+        *
+        * Con rango deficiente (solo con pivoteo) devuelve la solución básica, con ceros en las n - r
+        * incógnitas de las columnas descartadas.
+        *
+        * @param b Vector columna de m elementos.
+        * @param normaResiduo Si no es nulo, recibe ||A·x - b||₂, que se obtiene de Qᵀ·b sin formar A·x.
+        * @return Matrix Vector solución de n elementos.
+        *
+        * @throws std::invalid_argument Si m < n o b no es un vector de m elementos.
+        * @throws std::runtime_error Si A no tiene rango completo y la factorización no usa pivoteo.
+        */
+        Matrix resolver(const Matrix& b, double* normaResiduo = nullptr) const;
+
+        /**
+        * @brief Solución de norma mínima del sistema subdeterminado Aᵀ·x = c (m ≥ n).
+        *
+        * La solución es x = Q·[R⁻ᵀ·Pᵀ·c; 0], que está en el espacio de filas de Aᵀ y por eso es la de menor
+        * norma. Con rango deficiente se usan las r primeras ecuaciones pivotadas.
+        *
+        * @param c Vector columna de n elementos.
+        * @return Matrix Vector solución de m elementos.
+        *
+        * @throws std::invalid_argument Si m < n o c no es un vector de n elementos.
+        * @throws std::runtime_error Si A no tiene rango completo y la factorización no usa pivoteo.
+        */
+        Matrix resolverTraspuesta(const Matrix& c) const;
+};
+
+/**
+ * @brief Resuelve A·x ≈ b para una matriz rectangular de m x n con la factorización QR.
+ *
+ * Si m ≥ n devuelve la solución por mínimos cuadrados; si m < n factoriza Aᵀ y devuelve la solución de
+ * norma mínima. Con m = n coincide con la solución del sistema cuadrado.
+ *
+ * @param A Matriz de coeficientes (no se modifica).
+ * @param b Vector columna de m elementos.
+ * @param pivoteoColumnas Si es verdadero, tolera matrices de rango deficiente.
+ * @param normaResiduo Si no es nulo, recibe ||A·x - b||₂.
+ * @return Matrix Vector solución de n elementos.
+ *
+ * @throws std::invalid_argument Si b no es un vector de m elementos.
+ * @throws std::runtime_error Si A no tiene rango completo y no se pidió pivoteo.
+ */
+Matrix minimosCuadrados(const Matrix& A, const Matrix& b, bool pivoteoColumnas = false, double* normaResiduo = nullptr);
+
+#endif
@@ -0,0 +1,180 @@
+/**
+ * @file RecursiveLU.cpp
+ * @brief Implementación de la factorización LU recursiva con pivoteo parcial.
+ *
+ * @section features_sec Características principales
+ * -División recursiva de las columnas: panel izquierdo, sustitución triangular, producto y panel derecho.
+ * -Sustitución triangular y producto de matrices recursivos que dividen siempre la dimensión mayor.
+ * -Intercambio de filas por sus punteros, de modo que los factores son los mismos que los de forwardElimination.
+ */
+#include "RecursiveLU.hpp"
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include "ExecutionControl.hpp"
+#include "PerfCounters.hpp"
+
+namespace {
+
+/**
+ * @brief Tamaño a partir del cual se deja de dividir. Solo amortiza el costo de las llamadas; no depende de la caché.
+ */
+const int TAMANO_BASE = 16;
+
+const double TOLERANCIA_PIVOTE = 1e-12;
+
+/**
+ * @brief C ← C - A·B sobre bloques de la misma matriz (accedida por sus filas).
+ *
+ * C son las filas [i0, i0 + m) y columnas [j0, j0 + nc); A, las mismas filas y las columnas [p0, p0 + kc);
+ * B, las filas [p0, p0 + kc) y las columnas de C. Divide a la mitad la dimensión mayor hasta llegar al caso base.
+ */
+void restarProducto(double* const* filas, int i0, int m, int j0, int nc, int p0, int kc) {
+    if (m <= 0 || nc <= 0 || kc <= 0) return;
+    if (m <= TAMANO_BASE && nc <= TAMANO_BASE && kc <= TAMANO_BASE) {
+        for (int i = i0; i < i0 + m; i++) {
+            double* filaC = filas[i];
+            for (int p = p0; p < p0 + kc; p++) {
+                double a = filaC[p];
+                const double* filaB = filas[p];
+                for (int j = j0; j < j0 + nc; j++) filaC[j] -= a * filaB[j];
+            }
+        }
+        return;
+    }
+    if (m >= nc && m >= kc) {
+        int h = m / 2;
+        restarProducto(filas, i0, h, j0, nc, p0, kc);
+        restarProducto(filas, i0 + h, m - h, j0, nc, p0, kc);
+    } else if (nc >= kc) {
+        int h = nc / 2;
+        restarProducto(filas, i0, m, j0, h, p0, kc);
+        restarProducto(filas, i0, m, j0 + h, nc - h, p0, kc);
+    } else {
+        int h = kc / 2;
+        restarProducto(filas, i0, m, j0, nc, p0, h);
+        restarProducto(filas, i0, m, j0, nc, p0 + h, kc - h);
+    }
+}
+
+/**
+ * @brief B ← L⁻¹·B, con L el bloque triangular inferior unitario de filas y columnas [d0, d0 + t).
+ *
+ * B son las filas [d0, d0 + t) y las columnas [j0, j0 + nc). Divide L en dos triángulos y un bloque
+ * rectangular, que se resta con restarProducto.
+ */
+void sustitucionTriangular(double* const* filas, int d0, int t, int j0, int nc) {
+    if (t <= 1 || nc <= 0) return;
+    if (t <= TAMANO_BASE) {
+        for (int i = d0 + 1; i < d0 + t; i++) {
+            double* filaB = filas[i];
+            for (int p = d0; p < i; p++) {
+                double l = filaB[p];
+                const double* filaP = filas[p];
+                for (int j = j0; j < j0 + nc; j++) filaB[j] -= l * filaP[j];
+            }
+        }
+        return;
+    }
+    int h = t / 2;
+    sustitucionTriangular(filas, d0, h, j0, nc);
+    restarProducto(filas, d0 + h, t - h, j0, nc, d0, h);
+    sustitucionTriangular(filas, d0 + h, t - h, j0, nc);
+}
+
+/**
+ * @brief Factoriza el panel de columnas [c0, c0 + w) y filas [c0, n).
+ *
+ * Los intercambios de filas abarcan las n columnas, igual que en la eliminación de Gauss, para que las
+ * columnas de la izquierda (multiplicadores de L) y las de la derecha (aún sin actualizar) queden consistentes.
+ * Se intercambian los punteros, en `filas` y en A a la vez, sin copiar los datos.
+ */
+void factorizarPanel(Matrix& A, double** filas, int n, int* pivotes, int c0, int w) {
+    if (w <= TAMANO_BASE) {
+        for (int column = c0; column < c0 + w; column++) {
+            verificarInterrupcion(RegionMedida::Eliminacion, column, n);
+            int maxRow = column;
+            for (int row = column + 1; row < n; row++) {
+                if (std::abs(filas[row][column]) > std::abs(filas[maxRow][column])) {
+                    maxRow = row;
+                }
+            }
+            if (std::abs(filas[maxRow][column]) < TOLERANCIA_PIVOTE) {
+                throw std::runtime_error("El sistema es numéricamente inestable o no tiene solución única.");
+            }
+            if (maxRow != column) {
+                std::swap(filas[column], filas[maxRow]);
+                A.intercambiarFilas(column, maxRow);
+                std::swap(pivotes[column], pivotes[maxRow]);
+            }
+            const double* filaPivote = filas[column];
+            double pivote = filaPivote[column];
+            for (int row = column + 1; row < n; row++) {
+                double* fila = filas[row];
+                double factor = fila[column] / pivote;
+                fila[column] = factor;
+                for (int col = column + 1; col < c0 + w; col++) fila[col] -= factor * filaPivote[col];
+            }
+        }
+        return;
+    }
+    int h = w / 2;
+    factorizarPanel(A, filas, n, pivotes, c0, h);
+    // U12 = L11⁻¹·A12 y A22 ← A22 - L21·U12
+    sustitucionTriangular(filas, c0, h, c0 + h, w - h);
+    restarProducto(filas, c0 + h, n - c0 - h, c0 + h, w - h, c0, h);
+    factorizarPanel(A, filas, n, pivotes, c0 + h, w - h);
+}
+
+} // namespace
+
+void factorizarLURecursiva(Matrix& A, int* pivotes) {
+    int n = A.getRows();
+    if (A.getCols() != n) {
+        throw std::invalid_argument("La factorización LU requiere una matriz cuadrada.");
+    }
+    if (n == 0) return;
+    // Las mismas operaciones que la eliminación de Gauss, sin el término independiente: ≈ 2n³/3
+    double operaciones = 0.0;
+    for (int c = 0; c < n; c++) operaciones += (n - c - 1.0) * (2.0 * (n - c - 1.0) + 1.0);
+    RegionRendimiento region(RegionMedida::Eliminacion, operaciones);
+    std::unique_ptr<double*[]> filas = std::make_unique<double*[]>(n);
+    for (int i = 0; i < n; i++) {
+        filas[i] = &A.at(i, 0);
+        pivotes[i] = i;
+    }
+    factorizarPanel(A, filas.get(), n, pivotes, 0, n);
+}
+
+Matrix luRecursiva(Matrix& A, Matrix& b) {
+    int n = A.getRows();
+    if (A.getCols() != n || b.getRows() != n || b.getCols() != 1) {
+        throw std::invalid_argument("Las dimensiones de A y b no son compatibles.");
+    }
+    std::unique_ptr<int[]> pivotes = std::make_unique<int[]>(n);
+    factorizarLURecursiva(A, pivotes.get());
+
+    // b ← L⁻¹·P·b
+    RegionRendimiento region(RegionMedida::Sustitucion, 2.0 * n * n);
+    std::unique_ptr<double[]> permutado = std::make_unique<double[]>(n);
+    for (int i = 0; i < n; i++) permutado[i] = b.at(pivotes[i], 0);
+    for (int row = 0; row < n; row++) {
+        const double* fila = &A.at(row, 0);
+        double sum = permutado[row];
+        for (int col = 0; col < row; col++) sum -= fila[col] * permutado[col];
+        permutado[row] = sum;
+        b.at(row, 0) = sum;
+    }
+
+    // Sustitución regresiva con U
+    Matrix vectorSolucion(n, 1);
+    for (int row = n - 1; row >= 0; row--) {
+        const double* fila = &A.at(row, 0);
+        double sum = permutado[row];
+        for (int col = row + 1; col < n; col++) sum -= fila[col] * permutado[col];
+        permutado[row] = sum / fila[row];
+        vectorSolucion.at(row, 0) = permutado[row];
+    }
+    return vectorSolucion;
+}
@@ -0,0 +1,45 @@
+/**
+ * @file RecursiveLU.hpp
+ * @brief Declaración de la factorización LU recursiva (independiente del tamaño de la caché).
+ *
+ * La eliminación de forwardElimination recorre toda la submatriz restante en cada columna, por lo que solo
+ * aprovecha la caché mientras la matriz completa cabe en ella. La versión recursiva divide las columnas a la
+ * mitad, factoriza la mitad izquierda, actualiza la derecha con una sustitución triangular y un producto de
+ * matrices (también recursivos) y repite con la mitad derecha. Los subproblemas se van reduciendo hasta caber
+ * en cada nivel de la jerarquía de memoria sin ajustar ningún tamaño de bloque a la máquina.
+ */
+#ifndef RECURSIVE_LU_HPP
+#define RECURSIVE_LU_HPP
+
+#include "Matrix.hpp"
+
+/**
+ * @brief Factoriza en el lugar P·A = L·U con pivoteo parcial mediante el algoritmo recursivo.
+ *
+ * Al terminar, A contiene L (diagonal unitaria, bajo la diagonal) y U (sobre la diagonal). Los pivotes se
+ * eligen igual que en forwardElimination (el mayor valor absoluto de la columna, el primero en caso de empate).
+ *
+ * @param A Matriz cuadrada (se reemplaza por sus factores).
+ * @param pivotes Arreglo de n enteros: la fila i de P·A es la fila pivotes[i] de la A original.
+ *
+ * @throw std::invalid_argument Si A no es cuadrada.
+ * @throw std::runtime_error Si el sistema es numéricamente inestable o no tiene solución única.
+ */
+void factorizarLURecursiva(Matrix& A, int* pivotes);
+
+/**
+ * @brief Resuelve A·x = b con la factorización LU recursiva.
+ *
+ * Equivale a gaussElimination sin pasos: A queda con los factores L y U, y b con L⁻¹·P·b, el término
+ * independiente del sistema triangular U·x = L⁻¹·P·b.
+ *
+ * @param A Matriz cuadrada de coeficientes (modificada).
+ * @param b Vector columna de términos independientes (modificado).
+ * @return Matrix Vector solución del sistema.
+ *
+ * @throw std::invalid_argument Si las dimensiones de A y b no son compatibles.
+ * @throw std::runtime_error Si el sistema es numéricamente inestable o no tiene solución única.
+ */
+Matrix luRecursiva(Matrix& A, Matrix& b);
+
+#endif
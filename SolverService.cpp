@@ -0,0 +1,260 @@
+/**
+ * @file SolverService.cpp
+ * @brief Implementación del servicio asíncrono de solución de sistemas de ecuaciones lineales.
+ *
+ * @section features_sec Características principales
+ * -Grupo de hilos con una cola por hilo y robo de trabajo entre colas.
+ * -Tres niveles de prioridad por trabajo.
+ * -Cancelación de trabajos pendientes y límite de trabajos en cola para dar contrapresión.
+ * -Cancelación, plazo y avisos de progreso también durante la ejecución, mediante el ControlEjecucion de cada trabajo.
+ */
+#include "SolverService.hpp"
+#include <stdexcept>
+#include <utility>
+
+TrabajoSolucion::TrabajoSolucion(Matrix&& coeficientes, Matrix&& terminos, MetodoSolucion m, double tol, int iteraciones, bool cache)
+    : A(std::move(coeficientes)), b(std::move(terminos)), metodo(m), tolerancia(tol), maxIter(iteraciones), usarCache(cache) {}
+
+ManejadorTrabajo::ManejadorTrabajo(std::shared_ptr<TrabajoSolucion> t, std::future<Matrix>&& f)
+    : trabajo(std::move(t)), futuro(std::move(f)) {}
+
+bool ManejadorTrabajo::valido() const {
+    return futuro.valid();
+}
+
+bool ManejadorTrabajo::listo() const {
+    return futuro.valid() && futuro.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
+void ManejadorTrabajo::esperar() const {
+    if (!futuro.valid()) {
+        throw std::runtime_error("El manejador no está asociado a ningún trabajo.");
+    }
+    futuro.wait();
+}
+
+Matrix ManejadorTrabajo::obtener() {
+    if (!futuro.valid()) {
+        throw std::runtime_error("El manejador no está asociado a ningún trabajo.");
+    }
+    return futuro.get();
+}
+
+void ManejadorTrabajo::cancelar() {
+    if (trabajo) {
+        trabajo->control.cancelar();
+    }
+}
+
+EstadoEjecucion ManejadorTrabajo::interrupcion() const {
+    return trabajo ? trabajo->control.getInterrupcion() : EstadoEjecucion::Activa;
+}
+
+void SolverService::AnilloTrabajos::reservar(int maximo) {
+    trabajos = std::make_unique<std::shared_ptr<TrabajoSolucion>[]>(maximo);
+    capacidad = maximo;
+    inicio = 0;
+    cantidad = 0;
+}
+
+void SolverService::AnilloTrabajos::agregarAlFinal(std::shared_ptr<TrabajoSolucion>&& trabajo) {
+    trabajos[(inicio + cantidad) % capacidad] = std::move(trabajo);
+    cantidad++;
+}
+
+std::shared_ptr<TrabajoSolucion> SolverService::AnilloTrabajos::quitarDelFrente() {
+    std::shared_ptr<TrabajoSolucion> trabajo = std::move(trabajos[inicio]);
+    inicio = (inicio + 1) % capacidad;
+    cantidad--;
+    return trabajo;
+}
+
+std::shared_ptr<TrabajoSolucion> SolverService::AnilloTrabajos::quitarDelFinal() {
+    cantidad--;
+    return std::move(trabajos[(inicio + cantidad) % capacidad]);
+}
+
+SolverService::SolverService(int trabajadores, int capacidad)
+    : numTrabajadores(trabajadores), capacidadMaxima(capacidad), pendientes(0), detener(false), siguienteCola(0) {
+    if (capacidad <= 0) {
+        throw std::invalid_argument("La capacidad de la cola debe ser positiva.");
+    }
+    if (numTrabajadores <= 0) {
+        numTrabajadores = static_cast<int>(std::thread::hardware_concurrency());
+        if (numTrabajadores <= 0) numTrabajadores = 1;
+    }
+    colas = std::make_unique<ColaTrabajador[]>(numTrabajadores);
+    for (int i = 0; i < numTrabajadores; i++) {
+        for (auto& cola : colas[i].colas) cola.reservar(capacidadMaxima);
+    }
+    hilos = std::make_unique<std::thread[]>(numTrabajadores);
+    for (int i = 0; i < numTrabajadores; i++) {
+        hilos[i] = std::thread(&SolverService::cicloTrabajador, this, i);
+    }
+}
+
+SolverService::~SolverService() {
+    {
+        std::lock_guard<std::mutex> lock(mutexEstado);
+        detener = true;
+    }
+    hayTrabajo.notify_all();
+    hayEspacio.notify_all();
+    for (int i = 0; i < numTrabajadores; i++) {
+        hilos[i].join();
+    }
+
+    // Los trabajos que quedaron en cola se cancelan para no dejar manejadores esperando para siempre
+    for (int i = 0; i < numTrabajadores; i++) {
+        for (auto& cola : colas[i].colas) {
+            while (cola.cantidad > 0) {
+                cola.quitarDelFrente()->resultado.set_exception(std::make_exception_ptr(
+                    std::runtime_error("El servicio se detuvo antes de ejecutar el trabajo.")));
+            }
+        }
+    }
+}
+
+int SolverService::getNumTrabajadores() const {
+    return numTrabajadores;
+}
+
+int SolverService::trabajosPendientes() {
+    std::lock_guard<std::mutex> lock(mutexEstado);
+    return pendientes;
+}
+
+ManejadorTrabajo SolverService::enviar(Matrix&& A, Matrix&& b, MetodoSolucion metodo, double tolerancia,
+                                       int maxIter, PrioridadTrabajo prioridad, bool usarCache) {
+    OpcionesTrabajo opciones;
+    opciones.prioridad = prioridad;
+    opciones.usarCache = usarCache;
+    return enviar(std::move(A), std::move(b), metodo, tolerancia, maxIter, opciones);
+}
+
+ManejadorTrabajo SolverService::enviar(Matrix&& A, Matrix&& b, MetodoSolucion metodo, double tolerancia, int maxIter,
+                                       const OpcionesTrabajo& opciones) {
+    if (opciones.presupuestoSegundos < 0.0) {
+        throw std::invalid_argument("El presupuesto de tiempo no puede ser negativo.");
+    }
+    std::unique_lock<std::mutex> lock(mutexEstado);
+    hayEspacio.wait(lock, [this]() { return detener || pendientes < capacidadMaxima; });
+    if (detener) {
+        throw std::runtime_error("El servicio de solución se está deteniendo.");
+    }
+    ManejadorTrabajo manejador = encolar(std::move(A), std::move(b), metodo, tolerancia, maxIter, opciones);
+    lock.unlock();
+    hayTrabajo.notify_one();
+    return manejador;
+}
+
+bool SolverService::intentarEnviar(Matrix&& A, Matrix&& b, MetodoSolucion metodo, double tolerancia, int maxIter,
+                                   PrioridadTrabajo prioridad, ManejadorTrabajo& salida, bool usarCache) {
+    OpcionesTrabajo opciones;
+    opciones.prioridad = prioridad;
+    opciones.usarCache = usarCache;
+    return intentarEnviar(std::move(A), std::move(b), metodo, tolerancia, maxIter, opciones, salida);
+}
+
+bool SolverService::intentarEnviar(Matrix&& A, Matrix&& b, MetodoSolucion metodo, double tolerancia, int maxIter,
+                                   const OpcionesTrabajo& opciones, ManejadorTrabajo& salida) {
+    if (opciones.presupuestoSegundos < 0.0) {
+        throw std::invalid_argument("El presupuesto de tiempo no puede ser negativo.");
+    }
+    std::unique_lock<std::mutex> lock(mutexEstado);
+    if (detener) {
+        throw std::runtime_error("El servicio de solución se está deteniendo.");
+    }
+    if (pendientes >= capacidadMaxima) {
+        return false;
+    }
+    salida = encolar(std::move(A), std::move(b), metodo, tolerancia, maxIter, opciones);
+    lock.unlock();
+    hayTrabajo.notify_one();
+    return true;
+}
+
+/**
+ * @brief Crea un trabajo, lo coloca en la cola del siguiente hilo por turnos y lo cuenta en `pendientes`.
+ *
+ * Debe llamarse con `mutexEstado` tomado y con espacio en las colas. El plazo y la función de progreso se fijan
+ * antes de que el trabajo sea visible para los trabajadores; si la creación lanza una excepción, ni las colas
+ * ni el contador cambian.
+ */
+ManejadorTrabajo SolverService::encolar(Matrix&& A, Matrix&& b, MetodoSolucion metodo, double tolerancia, int maxIter,
+                                        const OpcionesTrabajo& opciones) {
+    auto trabajo = std::make_shared<TrabajoSolucion>(std::move(A), std::move(b), metodo, tolerancia, maxIter,
+                                                     opciones.usarCache);
+    if (opciones.presupuestoSegundos > 0.0) trabajo->control.fijarPresupuesto(opciones.presupuestoSegundos);
+    if (opciones.progreso) trabajo->control.fijarProgreso(opciones.progreso, opciones.intervaloProgreso);
+    PrioridadTrabajo prioridad = opciones.prioridad;
+    ManejadorTrabajo manejador(trabajo, trabajo->resultado.get_future());
+    int destino = static_cast<int>(siguienteCola++ % static_cast<unsigned>(numTrabajadores));
+    colas[destino].colas[static_cast<int>(prioridad)].agregarAlFinal(std::move(trabajo));
+    pendientes++;
+    return manejador;
+}
+
+/**
+ * @brief Toma el siguiente trabajo para el hilo `id`.
+ *
+ * Recorre los niveles de prioridad de mayor a menor; en cada nivel toma primero del frente de su propia cola
+ * y, si está vacía, roba del final de la cola de otro hilo. Debe llamarse con `mutexEstado` tomado.
+ *
+ * @return Trabajo a ejecutar o nullptr si no encontró ninguno.
+ */
+std::shared_ptr<TrabajoSolucion> SolverService::tomarTrabajo(int id) {
+    for (int nivel = 0; nivel < 3; nivel++) {
+        auto& propia = colas[id].colas[nivel];
+        if (propia.cantidad > 0) {
+            return propia.quitarDelFrente();
+        }
+        for (int desplazamiento = 1; desplazamiento < numTrabajadores; desplazamiento++) {
+            int victima = (id + desplazamiento) % numTrabajadores;
+            auto& ajena = colas[victima].colas[nivel];
+            if (ajena.cantidad > 0) {
+                return ajena.quitarDelFinal();
+            }
+        }
+    }
+    return nullptr;
+}
+
+void SolverService::cicloTrabajador(int id) {
+    while (true) {
+        std::shared_ptr<TrabajoSolucion> trabajo;
+        {
+            std::unique_lock<std::mutex> lock(mutexEstado);
+            hayTrabajo.wait(lock, [this]() { return detener || pendientes > 0; });
+            if (detener) {
+                return;
+            }
+            // `pendientes` cuenta exactamente los trabajos en las colas, así que la búsqueda siempre encuentra uno
+            trabajo = tomarTrabajo(id);
+            pendientes--;
+        }
+        hayEspacio.notify_one();
+
+        ejecutar(*trabajo);
+    }
+}
+
+/**
+ * @brief Ejecuta un trabajo con su control de ejecución activo y publica su resultado o la excepción que produjo.
+ */
+void SolverService::ejecutar(TrabajoSolucion& trabajo) {
+    EstadoEjecucion estado = trabajo.control.comprobar();
+    if (estado != EstadoEjecucion::Activa) {
+        const char* mensaje = estado == EstadoEjecucion::Cancelada ? "El trabajo fue cancelado antes de ejecutarse."
+                                                                   : "El plazo del trabajo venció antes de ejecutarse.";
+        trabajo.resultado.set_exception(std::make_exception_ptr(std::runtime_error(mensaje)));
+        return;
+    }
+    try {
+        SesionControl sesion(&trabajo.control);
+        trabajo.resultado.set_value(resolverSistema(trabajo.metodo, trabajo.A, trabajo.b,
+                                                    trabajo.tolerancia, trabajo.maxIter, trabajo.usarCache));
+    } catch (...) {
+        trabajo.resultado.set_exception(std::current_exception());
+    }
+}
@@ -0,0 +1,259 @@
+/**
+ * @file SolverService.hpp
+ * @brief Declaración del servicio asíncrono de solución de sistemas de ecuaciones lineales.
+ *
+ * La clase SolverService permite usar LinSys como biblioteca desde un proceso servidor: recibe trabajos
+ * de solución (matriz, vector, método y tolerancias), los ejecuta en un grupo de hilos con robo de trabajo
+ * y devuelve un ManejadorTrabajo con el que se espera el resultado o se cancela el trabajo.
+ * Cada trabajo lleva su propio ControlEjecucion, de modo que puede cancelarse o tener un plazo también
+ * mientras se ejecuta.
+ */
+#ifndef SOLVER_SERVICE_HPP
+#define SOLVER_SERVICE_HPP
+
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include "Matrix.hpp"
+#include "Methods.hpp"
+#include "ExecutionControl.hpp"
+
+/**
+ * @brief Prioridad de un trabajo; los trabajos de mayor prioridad se atienden primero.
+ */
+enum class PrioridadTrabajo {
+    Alta = 0,
+    Normal = 1,
+    Baja = 2
+};
+
+/**
+ * @brief Opciones de un trabajo enviado a SolverService.
+ */
+struct OpcionesTrabajo {
+    PrioridadTrabajo prioridad = PrioridadTrabajo::Normal; ///< Prioridad del trabajo.
+    bool usarCache = false;                                ///< Los métodos directos reutilizan la caché global de factorizaciones.
+    double presupuestoSegundos = 0.0;                      ///< Tiempo máximo desde el envío, incluida la espera en cola; 0 no tiene límite.
+    std::function<void(const ProgresoSolucion&)> progreso; ///< Avisos de progreso, llamados desde el hilo trabajador.
+    double intervaloProgreso = 0.0;                        ///< Tiempo mínimo en segundos entre dos avisos.
+};
+
+/**
+ * @brief Estado compartido entre un trabajo en cola y su manejador.
+ */
+struct TrabajoSolucion {
+    Matrix A;
+    Matrix b;
+    MetodoSolucion metodo;
+    double tolerancia;
+    int maxIter;
+    bool usarCache;
+    ControlEjecucion control;
+    std::promise<Matrix> resultado;
+
+    TrabajoSolucion(Matrix&& coeficientes, Matrix&& terminos, MetodoSolucion m, double tol, int iteraciones, bool cache);
+};
+
+/**
+ * @class ManejadorTrabajo
+ * @brief Resultado futuro de un trabajo enviado a SolverService.
+ *
+ * Funciona como un `std::future<Matrix>` con la posibilidad adicional de cancelar el trabajo
+ * y de saber si terminó antes de tiempo por cancelación o por su plazo.
+ */
+class ManejadorTrabajo {
+    private:
+        std::shared_ptr<TrabajoSolucion> trabajo;
+        std::future<Matrix> futuro;
+    public:
+        ManejadorTrabajo() = default;
+        ManejadorTrabajo(std::shared_ptr<TrabajoSolucion> t, std::future<Matrix>&& f);
+
+        /**
+        * @brief Indica si el manejador está asociado a un trabajo.
+        */
+        bool valido() const;
+
+        /**
+        * @brief Indica si el resultado ya está disponible (sin bloquear).
+        */
+        bool listo() const;
+
+        /**
+        * @brief Bloquea hasta que el trabajo termine.
+        */
+        void esperar() const;
+
+        /**
+        * @brief Bloquea hasta que el trabajo termine y devuelve la solución.
+        *
+        * Solo puede llamarse una vez por manejador.
+        *
+        * @return Matrix Vector solución del sistema.
+        *
+        * @throw std::runtime_error Si el método no pudo resolver el sistema, o si el trabajo fue cancelado o venció
+        *        su plazo antes de empezar o durante un método directo.
+        */
+        Matrix obtener();
+
+        /**
+        * @brief Solicita la cancelación del trabajo.
+        *
+        * Un trabajo que todavía está en la cola se descarta y su resultado lanza una excepción. Un trabajo en
+        * ejecución se detiene en su siguiente punto de verificación: los métodos iterativos entregan su última
+        * iteración y los directos lanzan una excepción.
+        */
+        void cancelar();
+
+        /**
+        * @brief Indica si el trabajo se detuvo antes de tiempo (Cancelada o PlazoVencido) o no (Activa).
+        *
+        * Después de obtener el resultado distingue la última iteración de un método interrumpido de una
+        * solución convergida.
+        */
+        EstadoEjecucion interrupcion() const;
+};
+
+/**
+ * @class SolverService
+ * @brief Servicio de solución asíncrono con cola de trabajos y grupo de hilos con robo de trabajo.
+ *
+ * Cada hilo trabajador tiene su propia cola por prioridad. Los trabajos nuevos se reparten entre las colas
+ * por turnos y un hilo sin trabajo roba del extremo opuesto de las colas de los demás, de modo que los
+ * sistemas grandes no dejan núcleos ociosos mientras otros hilos acumulan sistemas pequeños.
+ * El número total de trabajos pendientes está acotado: al llegar al límite, `enviar` bloquea al llamador
+ * y `intentarEnviar` devuelve falso, lo que da contrapresión al proceso que genera los trabajos.
+ * Las colas y el contador de pendientes comparten un mutex, así que el contador es siempre el número exacto de
+ * trabajos en las colas: un hilo despertado siempre encuentra trabajo.
+ */
+class SolverService {
+    private:
+        /**
+        * @brief Cola circular de trabajos de capacidad fija, con extracción por ambos extremos.
+        *
+        * Cada cola tiene capacidad para `capacidadMaxima` trabajos, el total que puede haber pendiente, así que
+        * nunca se llena aunque todos los trabajos caigan en la misma cola y el mismo nivel.
+        */
+        struct AnilloTrabajos {
+            std::unique_ptr<std::shared_ptr<TrabajoSolucion>[]> trabajos;
+            int capacidad = 0;
+            int inicio = 0;
+            int cantidad = 0;
+
+            void reservar(int maximo);
+            void agregarAlFinal(std::shared_ptr<TrabajoSolucion>&& trabajo);
+            std::shared_ptr<TrabajoSolucion> quitarDelFrente();
+            std::shared_ptr<TrabajoSolucion> quitarDelFinal();
+        };
+
+        /**
+        * @brief Colas de un hilo trabajador, una por nivel de prioridad.
+        */
+        struct ColaTrabajador {
+            AnilloTrabajos colas[3];
+        };
+
+        int numTrabajadores;
+        int capacidadMaxima;
+        std::unique_ptr<ColaTrabajador[]> colas;
+        std::unique_ptr<std::thread[]> hilos;
+
+        std::mutex mutexEstado;  // Protege las colas, `pendientes`, `detener` y `siguienteCola`. //
+        std::condition_variable hayTrabajo;
+        std::condition_variable hayEspacio;
+        int pendientes;
+        bool detener;
+        unsigned siguienteCola;
+
+        void cicloTrabajador(int id);
+        std::shared_ptr<TrabajoSolucion> tomarTrabajo(int id);
+        ManejadorTrabajo encolar(Matrix&& A, Matrix&& b, MetodoSolucion metodo, double tolerancia, int maxIter,
+                                 const OpcionesTrabajo& opciones);
+        static void ejecutar(TrabajoSolucion& trabajo);
+    public:
+        /**
+        * @brief Crea el servicio y arranca sus hilos trabajadores.
+        *
+        * @param trabajadores Número de hilos; 0 usa todos los núcleos disponibles.
+        * @param capacidad Número máximo de trabajos pendientes en cola.
+        *
+        * @throws std::invalid_argument Si la capacidad no es positiva.
+        */
+        explicit SolverService(int trabajadores = 0, int capacidad = 1024);
+
+        /**
+        * @brief Detiene el servicio: los trabajos pendientes se cancelan y se espera a los que están en ejecución.
+        */
+        ~SolverService();
+
+        SolverService(const SolverService&) = delete;
+        SolverService& operator=(const SolverService&) = delete;
+
+        /**
+        * @brief Envía un trabajo de solución; bloquea si la cola está llena.
+        *
+        * @param A Matriz de coeficientes (el servicio toma posesión de ella).
+        * @param b Vector columna de términos independientes (el servicio toma posesión de él).
+        * @param metodo Método de solución a utilizar.
+        * @param tolerancia Criterio de parada de los métodos iterativos.
+        * @param maxIter Número máximo de iteraciones de los métodos iterativos.
+        * @param prioridad Prioridad del trabajo.
+        * @param usarCache Si es verdadero, los métodos directos reutilizan la caché global de factorizaciones.
+        * @return ManejadorTrabajo Manejador para obtener el resultado o cancelar el trabajo.
+        *
+        * @throws std::runtime_error Si el servicio ya se está deteniendo.
+        */
+        ManejadorTrabajo enviar(Matrix&& A, Matrix&& b, MetodoSolucion metodo, double tolerancia = 1e-6,
+                                int maxIter = 500, PrioridadTrabajo prioridad = PrioridadTrabajo::Normal,
+                                bool usarCache = false);
+
+        /**
+        * @brief Envía un trabajo con plazo, aviso de progreso y demás opciones; bloquea si la cola está llena.
+        *
+        * Si el presupuesto se agota mientras el trabajo espera en la cola, se descarta sin ejecutarse.
+        *
+        * @throws std::runtime_error Si el servicio ya se está deteniendo.
+        * @throws std::invalid_argument Si el presupuesto es negativo.
+        */
+        ManejadorTrabajo enviar(Matrix&& A, Matrix&& b, MetodoSolucion metodo, double tolerancia, int maxIter,
+                                const OpcionesTrabajo& opciones);
+
+        /**
+        * @brief Intenta enviar un trabajo sin bloquear.
+        *
+        * @param salida Manejador del trabajo si fue aceptado.
+        * @return true si el trabajo fue aceptado, false si la cola está llena. A y b solo se mueven si el trabajo
+        *         es aceptado; si no, el llamador los conserva y puede volver a intentarlo.
+        *
+        * @throws std::runtime_error Si el servicio ya se está deteniendo.
+        */
+        bool intentarEnviar(Matrix&& A, Matrix&& b, MetodoSolucion metodo, double tolerancia, int maxIter,
+                            PrioridadTrabajo prioridad, ManejadorTrabajo& salida, bool usarCache = false);
+
+        /**
+        * @brief Intenta enviar un trabajo con las opciones dadas sin bloquear.
+        *
+        * @return true si el trabajo fue aceptado, false si la cola está llena. A y b solo se mueven si el trabajo
+        *         es aceptado; si no, el llamador los conserva y puede volver a intentarlo.
+        *
+        * @throws std::runtime_error Si el servicio ya se está deteniendo.
+        * @throws std::invalid_argument Si el presupuesto es negativo.
+        */
+        bool intentarEnviar(Matrix&& A, Matrix&& b, MetodoSolucion metodo, double tolerancia, int maxIter,
+                            const OpcionesTrabajo& opciones, ManejadorTrabajo& salida);
+
+        /**
+        * @brief Devuelve el número de trabajos en cola que todavía no han comenzado.
+        */
+        int trabajosPendientes();
+
+        /**
+        * @brief Devuelve el número de hilos trabajadores.
+        */
+        int getNumTrabajadores() const;
+};
+
+#endif
@@ -0,0 +1,1149 @@
+/**
+ * @file SparseDirect.cpp
+ * @brief Implementación de los métodos directos dispersos y de los ordenamientos que reducen el llenado.
+ *
+ * @section features_sec Características principales
+ * -Cuthill-McKee inverso desde un nodo pseudoperiférico de cada componente.
+ * -Grado mínimo aproximado sobre el grafo cociente, con absorción de elementos y cota del grado externo.
+ * -Disección anidada recursiva con separadores de niveles refinados.
+ * -Árbol de eliminación y conteo de columnas en O(nnz(L)), reutilizables entre matrices con el mismo patrón.
+ * -Cholesky por filas y LU de Gilbert-Peierls con pivoteo parcial por umbral; el costo es proporcional a las
+ *  operaciones y no a n.
+ * -Puntos de verificación del control de ejecución en cada pivote del grado mínimo y en cada columna.
+ */
+#include "SparseDirect.hpp"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+#include "ExecutionControl.hpp"
+#include "PerfCounters.hpp"
+#include "String.hpp"
+
+namespace {
+
+const double TOLERANCIA_PIVOTE_RELATIVA = 1e-14;
+const int TAMANO_HOJA_DISECCION = 64;
+
+/**
+ * @brief Grafo no dirigido del patrón de A + Aᵀ, sin la diagonal, en formato de listas comprimidas.
+ */
+struct GrafoPatron {
+    int n = 0;
+    std::unique_ptr<int[]> inicio;
+    std::unique_ptr<int[]> vecinos;
+
+    int grado(int i) const {
+        return inicio[i + 1] - inicio[i];
+    }
+};
+
+GrafoPatron grafoSimetrico(const SparseMatrix& A) {
+    SparseMatrix T = A.transpuesta();
+    GrafoPatron grafo;
+    grafo.n = A.getRows();
+    grafo.inicio = std::make_unique<int[]>(grafo.n + 1);
+    grafo.vecinos = std::make_unique<int[]>(2 * static_cast<size_t>(A.getNoCeros()));
+    const int* inicioA = A.getInicioFila();
+    const int* columnasA = A.getColumnas();
+    const int* inicioT = T.getInicioFila();
+    const int* columnasT = T.getColumnas();
+    // Mezcla de las filas ordenadas de A y Aᵀ sin repetir ni incluir la diagonal
+    int cuenta = 0;
+    for (int i = 0; i < grafo.n; i++) {
+        int p = inicioA[i];
+        int q = inicioT[i];
+        while (p < inicioA[i + 1] || q < inicioT[i + 1]) {
+            int j;
+            if (q >= inicioT[i + 1] || (p < inicioA[i + 1] && columnasA[p] < columnasT[q])) {
+                j = columnasA[p++];
+            } else if (p >= inicioA[i + 1] || columnasT[q] < columnasA[p]) {
+                j = columnasT[q++];
+            } else {
+                j = columnasA[p++];
+                q++;
+            }
+            if (j != i) grafo.vecinos[cuenta++] = j;
+        }
+        grafo.inicio[i + 1] = cuenta;
+    }
+    return grafo;
+}
+
+/**
+ * @brief Estructura de niveles de una búsqueda en anchura: los nodos del nivel l son orden[inicioNivel[l] ..).
+ *
+ * Se reserva para los n nodos del grafo y se reutiliza entre búsquedas.
+ */
+struct EstructuraNiveles {
+    std::unique_ptr<int[]> orden;
+    std::unique_ptr<int[]> inicioNivel;
+    int numNodos = 0;
+    int niveles = 0;
+
+    explicit EstructuraNiveles(int n)
+        : orden(std::make_unique<int[]>(n)), inicioNivel(std::make_unique<int[]>(n + 1)) {}
+
+    int numNiveles() const {
+        return niveles;
+    }
+};
+
+/**
+ * @brief Búsquedas en anchura restringidas a los nodos con una etiqueta dada.
+ */
+class BuscadorNiveles {
+    private:
+        const GrafoPatron& grafo;
+        std::unique_ptr<int[]> marca;
+        int sello;
+        EstructuraNiveles prueba;   // Niveles desde cada candidato de periferico. //
+    public:
+        std::unique_ptr<int[]> nivel;   // Nivel de cada nodo en la última búsqueda. //
+
+        explicit BuscadorNiveles(const GrafoPatron& grafo)
+            : grafo(grafo), marca(std::make_unique<int[]>(grafo.n)), sello(0), prueba(grafo.n),
+              nivel(std::make_unique<int[]>(grafo.n)) {
+            std::fill(nivel.get(), nivel.get() + grafo.n, -1);
+        }
+
+        void recorrer(int raiz, const int* etiqueta, int actual, EstructuraNiveles& niveles) {
+            sello++;
+            int* orden = niveles.orden.get();
+            niveles.inicioNivel[0] = 0;
+            niveles.niveles = 0;
+            int numNodos = 0;
+            orden[numNodos++] = raiz;
+            marca[raiz] = sello;
+            nivel[raiz] = 0;
+            int desde = 0;
+            while (desde < numNodos) {
+                int hasta = numNodos;
+                int siguiente = ++niveles.niveles;
+                niveles.inicioNivel[siguiente] = hasta;
+                for (int p = desde; p < hasta; p++) {
+                    int u = orden[p];
+                    for (int q = grafo.inicio[u]; q < grafo.inicio[u + 1]; q++) {
+                        int v = grafo.vecinos[q];
+                        if (etiqueta[v] != actual || marca[v] == sello) continue;
+                        marca[v] = sello;
+                        nivel[v] = siguiente;
+                        orden[numNodos++] = v;
+                    }
+                }
+                desde = hasta;
+            }
+            niveles.numNodos = numNodos;
+        }
+
+        /**
+        * @brief Busca un nodo pseudoperiférico (algoritmo de George y Liu) y deja en `niveles` su estructura.
+        */
+        int periferico(int inicio, const int* etiqueta, int actual, EstructuraNiveles& niveles) {
+            int raiz = inicio;
+            recorrer(raiz, etiqueta, actual, niveles);
+            for (int intento = 0; intento < 8; intento++) {
+                int ultimo = niveles.numNiveles() - 1;
+                int candidato = niveles.orden[niveles.inicioNivel[ultimo]];
+                for (int p = niveles.inicioNivel[ultimo]; p < niveles.inicioNivel[ultimo + 1]; p++) {
+                    if (grafo.grado(niveles.orden[p]) < grafo.grado(candidato)) candidato = niveles.orden[p];
+                }
+                recorrer(candidato, etiqueta, actual, prueba);
+                if (prueba.numNiveles() <= niveles.numNiveles()) {
+                    recorrer(raiz, etiqueta, actual, niveles);
+                    break;
+                }
+                raiz = candidato;
+                std::swap(niveles, prueba);
+            }
+            return raiz;
+        }
+};
+
+void ordenCuthillMcKeeInverso(const GrafoPatron& grafo, int* permutacion) {
+    int n = grafo.n;
+    std::unique_ptr<int[]> etiqueta = std::make_unique<int[]>(n);   // 0 mientras el nodo no tiene posición. //
+    BuscadorNiveles buscador(grafo);
+    EstructuraNiveles niveles(n);
+    std::unique_ptr<int[]> orden = std::make_unique<int[]>(n);
+    std::unique_ptr<int[]> candidatos = std::make_unique<int[]>(n);
+    int numOrdenados = 0;
+    for (int semilla = 0; semilla < n; semilla++) {
+        if (etiqueta[semilla] != 0) continue;
+        int raiz = buscador.periferico(semilla, etiqueta.get(), 0, niveles);
+        int desde = numOrdenados;
+        orden[numOrdenados++] = raiz;
+        etiqueta[raiz] = 1;
+        for (int p = desde; p < numOrdenados; p++) {
+            int u = orden[p];
+            int numCandidatos = 0;
+            for (int q = grafo.inicio[u]; q < grafo.inicio[u + 1]; q++) {
+                int v = grafo.vecinos[q];
+                if (etiqueta[v] == 0) {
+                    etiqueta[v] = 1;
+                    candidatos[numCandidatos++] = v;
+                }
+            }
+            std::stable_sort(candidatos.get(), candidatos.get() + numCandidatos,
+                             [&](int a, int b) { return grafo.grado(a) < grafo.grado(b); });
+            std::copy(candidatos.get(), candidatos.get() + numCandidatos, orden.get() + numOrdenados);
+            numOrdenados += numCandidatos;
+        }
+    }
+    for (int k = 0; k < n; k++) permutacion[k] = orden[n - 1 - k];
+}
+
+/**
+ * @brief Listas de enteros de longitud variable guardadas en un solo arreglo, como el grafo cociente de AMD.
+ *
+ * Cada lista ocupa un bloque [lista, espacio, valores...]. La lista que ya no cabe en su bloque se copia al final
+ * con holgura y su bloque queda libre (lista = -1); cuando el final se llena se compactan los bloques vivos y, si
+ * aun así queda poco espacio, se duplica el arreglo.
+ */
+class ListasEnteros {
+    private:
+        std::unique_ptr<int[]> datos;
+        long long capacidad;
+        long long usado;
+        std::unique_ptr<long long[]> inicio;   // Posición del primer valor; 0 si la lista no tiene bloque. //
+        std::unique_ptr<int[]> largo;
+
+        void compactar() {
+            long long destino = 0;
+            for (long long bloque = 0; bloque < usado; ) {
+                int lista = datos[bloque];
+                long long espacio = datos[bloque + 1];
+                if (lista >= 0 && largo[lista] == 0) {
+                    inicio[lista] = 0;
+                } else if (lista >= 0) {
+                    int cantidad = largo[lista];
+                    datos[destino] = lista;
+                    datos[destino + 1] = cantidad;
+                    if (destino != bloque) {
+                        std::copy(datos.get() + bloque + 2, datos.get() + bloque + 2 + cantidad, datos.get() + destino + 2);
+                    }
+                    inicio[lista] = destino + 2;
+                    destino += 2 + cantidad;
+                }
+                bloque += 2 + espacio;
+            }
+            usado = destino;
+        }
+
+        /**
+        * @brief Mueve la lista a un bloque nuevo al final del arreglo con lugar para `espacio` valores.
+        */
+        void reubicar(int lista, int espacio) {
+            long long necesario = 2LL + espacio;
+            if (usado + necesario > capacidad) {
+                compactar();
+                if (usado + necesario > capacidad - capacidad / 4) {
+                    long long nueva = std::max(2 * capacidad, usado + necesario);
+                    std::unique_ptr<int[]> ampliado(new int[nueva]);
+                    std::copy(datos.get(), datos.get() + usado, ampliado.get());
+                    datos = std::move(ampliado);
+                    capacidad = nueva;
+                }
+            }
+            long long anterior = inicio[lista];
+            datos[usado] = lista;
+            datos[usado + 1] = espacio;
+            if (anterior > 0) {
+                std::copy(datos.get() + anterior, datos.get() + anterior + largo[lista], datos.get() + usado + 2);
+                datos[anterior - 2] = -1;
+            }
+            inicio[lista] = usado + 2;
+            usado += necesario;
+        }
+    public:
+        ListasEnteros(int numListas, long long capacidadInicial)
+            : datos(new int[capacidadInicial]), capacidad(capacidadInicial), usado(0),
+              inicio(std::make_unique<long long[]>(numListas)), largo(std::make_unique<int[]>(numListas)) {}
+
+        int tamano(int lista) const {
+            return largo[lista];
+        }
+
+        /**
+        * @brief Valores de la lista; el puntero deja de ser válido al agregar o asignar cualquier lista.
+        */
+        int* valores(int lista) {
+            return datos.get() + inicio[lista];
+        }
+
+        /**
+        * @brief Conserva solo los primeros `cantidad` valores de la lista.
+        */
+        void recortar(int lista, int cantidad) {
+            largo[lista] = cantidad;
+        }
+
+        void vaciar(int lista) {
+            if (inicio[lista] > 0) datos[inicio[lista] - 2] = -1;
+            inicio[lista] = 0;
+            largo[lista] = 0;
+        }
+
+        void agregar(int lista, int valor) {
+            if (inicio[lista] == 0 || largo[lista] == datos[inicio[lista] - 1]) {
+                reubicar(lista, std::max(4, 2 * largo[lista]));
+            }
+            datos[inicio[lista] + largo[lista]++] = valor;
+        }
+
+        /**
+        * @brief Reemplaza la lista por una copia de `cantidad` valores (que no deben estar en este arreglo).
+        */
+        void asignar(int lista, const int* nuevos, int cantidad) {
+            vaciar(lista);
+            if (cantidad == 0) return;
+            reubicar(lista, cantidad);
+            std::copy(nuevos, nuevos + cantidad, datos.get() + inicio[lista]);
+            largo[lista] = cantidad;
+        }
+};
+
+/**
+ * @brief Grado mínimo aproximado sobre el grafo cociente.
+ *
+ * Las incógnitas eliminadas se convierten en elementos (cliques implícitos) en lugar de agregar sus aristas de
+ * llenado. El grado de cada variable afectada se acota como en AMD: |A_i| + |L_p \ i| + Σ_e |L_e \ L_p|, y los
+ * elementos contenidos en L_p se absorben.
+ */
+void ordenGradoMinimo(const GrafoPatron& grafo, int* permutacion) {
+    int n = grafo.n;
+    // Las variables adyacentes a i (una copia del grafo) solo se depuran, en su lugar desde grafo.inicio[i]
+    std::unique_ptr<int[]> variables = std::make_unique<int[]>(grafo.inicio[n]);
+    std::copy(grafo.vecinos.get(), grafo.vecinos.get() + grafo.inicio[n], variables.get());
+    std::unique_ptr<int[]> numVariables = std::make_unique<int[]>(n);
+    // Listas 0 .. n-1: elementos adyacentes a cada variable; n .. 2n-1: variables de cada elemento
+    ListasEnteros listas(2 * n, grafo.inicio[n] + 4LL * n + 16);
+    std::unique_ptr<char[]> estado = std::make_unique<char[]>(n);   // 0 variable, 1 elemento, 2 elemento absorbido. //
+    std::unique_ptr<int[]> grado = std::make_unique<int[]>(n);
+    std::unique_ptr<int[]> cabeza = std::make_unique<int[]>(n + 1);
+    std::unique_ptr<int[]> siguiente = std::make_unique<int[]>(n);
+    std::unique_ptr<int[]> anterior = std::make_unique<int[]>(n);
+    std::unique_ptr<int[]> marcaPivote = std::make_unique<int[]>(n);
+    std::unique_ptr<int[]> marcaElemento = std::make_unique<int[]>(n);
+    std::unique_ptr<int[]> externo = std::make_unique<int[]>(n);   // |L_e \ L_p| de los elementos vecinos del pivote actual. //
+    std::unique_ptr<int[]> Lp = std::make_unique<int[]>(n);
+    std::fill(cabeza.get(), cabeza.get() + n + 1, -1);
+    std::fill(marcaPivote.get(), marcaPivote.get() + n, -1);
+    std::fill(marcaElemento.get(), marcaElemento.get() + n, -1);
+
+    auto insertar = [&](int i) {
+        int d = grado[i];
+        anterior[i] = -1;
+        siguiente[i] = cabeza[d];
+        if (cabeza[d] != -1) anterior[cabeza[d]] = i;
+        cabeza[d] = i;
+    };
+    auto quitar = [&](int i) {
+        if (anterior[i] != -1) siguiente[anterior[i]] = siguiente[i];
+        else cabeza[grado[i]] = siguiente[i];
+        if (siguiente[i] != -1) anterior[siguiente[i]] = anterior[i];
+    };
+
+    for (int i = 0; i < n; i++) {
+        numVariables[i] = grafo.grado(i);
+        grado[i] = grafo.grado(i);
+        insertar(i);
+    }
+
+    int gradoMinimo = 0;
+    for (int k = 0; k < n; k++) {
+        verificarInterrupcion(RegionMedida::Eliminacion, k, n);
+        while (cabeza[gradoMinimo] == -1) gradoMinimo++;
+        int p = cabeza[gradoMinimo];
+        quitar(p);
+        permutacion[k] = p;
+
+        // 1. L_p: variables de los elementos vecinos y variables vecinas; los elementos vecinos se absorben
+        int tamanoLp = 0;
+        marcaPivote[p] = k;
+        const int* E = listas.valores(p);
+        for (int q = 0; q < listas.tamano(p); q++) {
+            int e = E[q];
+            if (estado[e] != 1) continue;
+            const int* M = listas.valores(n + e);
+            for (int r = 0; r < listas.tamano(n + e); r++) {
+                int v = M[r];
+                if (estado[v] == 0 && marcaPivote[v] != k) {
+                    marcaPivote[v] = k;
+                    Lp[tamanoLp++] = v;
+                }
+            }
+            estado[e] = 2;
+            listas.vaciar(n + e);
+        }
+        const int* V = variables.get() + grafo.inicio[p];
+        for (int q = 0; q < numVariables[p]; q++) {
+            int v = V[q];
+            if (estado[v] == 0 && marcaPivote[v] != k) {
+                marcaPivote[v] = k;
+                Lp[tamanoLp++] = v;
+            }
+        }
+        estado[p] = 1;
+        numVariables[p] = 0;
+        listas.vaciar(p);
+        listas.asignar(n + p, Lp.get(), tamanoLp);
+
+        // 2. Depurar las listas de cada variable de L_p y agregar el nuevo elemento
+        for (int t = 0; t < tamanoLp; t++) {
+            int i = Lp[t];
+            quitar(i);
+            int* elementos = listas.valores(i);
+            int cuenta = 0;
+            for (int q = 0; q < listas.tamano(i); q++) {
+                if (estado[elementos[q]] == 1) elementos[cuenta++] = elementos[q];
+            }
+            listas.recortar(i, cuenta);
+            listas.agregar(i, p);
+            int* vecinas = variables.get() + grafo.inicio[i];
+            cuenta = 0;
+            for (int q = 0; q < numVariables[i]; q++) {
+                if (estado[vecinas[q]] == 0 && marcaPivote[vecinas[q]] != k) vecinas[cuenta++] = vecinas[q];
+            }
+            numVariables[i] = cuenta;
+        }
+
+        // 3. |L_e \ L_p| de cada elemento vecino
+        for (int t = 0; t < tamanoLp; t++) {
+            int i = Lp[t];
+            const int* elementos = listas.valores(i);
+            for (int q = 0; q < listas.tamano(i); q++) {
+                int e = elementos[q];
+                if (e == p) continue;
+                if (marcaElemento[e] != k) {
+                    marcaElemento[e] = k;
+                    externo[e] = listas.tamano(n + e);
+                }
+                externo[e]--;
+            }
+        }
+
+        // 4. Grado aproximado; los elementos contenidos en L_p se absorben
+        int restantes = n - k - 1;
+        for (int t = 0; t < tamanoLp; t++) {
+            int i = Lp[t];
+            long long d = static_cast<long long>(numVariables[i]) + tamanoLp - 1;
+            const int* elementos = listas.valores(i);
+            for (int q = 0; q < listas.tamano(i); q++) {
+                int e = elementos[q];
+                if (e == p || estado[e] != 1) continue;
+                if (externo[e] == 0) {
+                    estado[e] = 2;
+                    continue;
+                }
+                d += externo[e];
+            }
+            d = std::min<long long>(d, static_cast<long long>(grado[i]) + tamanoLp - 1);
+            d = std::min<long long>(d, restantes - 1);
+            grado[i] = static_cast<int>(std::max<long long>(d, 0));
+            insertar(i);
+            gradoMinimo = std::min(gradoMinimo, grado[i]);
+        }
+    }
+}
+
+/**
+ * @brief Disección anidada: separa cada parte con el nivel central de una estructura de niveles, ordena las dos
+ * mitades recursivamente y deja el separador al final.
+ *
+ * Los nodos de cada parte se reacomodan en su propio tramo del arreglo de la parte que la contiene, de modo que
+ * la recursión no necesita más memoria que la de ese arreglo.
+ */
+class DiseccionAnidada {
+    private:
+        const GrafoPatron& grafo;
+        BuscadorNiveles buscador;
+        EstructuraNiveles niveles;
+        std::unique_ptr<int[]> etiqueta;   // Parte a la que pertenece cada nodo; -1 si ya tiene posición. //
+        int siguienteEtiqueta;
+        std::unique_ptr<int[]> orden;
+        int numOrdenados;
+        std::unique_ptr<int[]> auxiliar;   // Reacomodo de los nodos de la parte que se divide. //
+
+        void hoja(const int* nodos, int cantidad) {
+            for (int t = 0; t < cantidad; t++) {
+                etiqueta[nodos[t]] = -1;
+                orden[numOrdenados++] = nodos[t];
+            }
+        }
+
+        int nuevaParte(const int* nodos, int cantidad) {
+            int id = siguienteEtiqueta++;
+            for (int t = 0; t < cantidad; t++) etiqueta[nodos[t]] = id;
+            return id;
+        }
+    public:
+        explicit DiseccionAnidada(const GrafoPatron& grafo)
+            : grafo(grafo), buscador(grafo), niveles(grafo.n), etiqueta(std::make_unique<int[]>(grafo.n)),
+              siguienteEtiqueta(1), orden(std::make_unique<int[]>(grafo.n)), numOrdenados(0),
+              auxiliar(std::make_unique<int[]>(grafo.n)) {}
+
+        void disecar(int* nodos, int cantidad, bool conexa) {
+            if (cantidad <= TAMANO_HOJA_DISECCION) {
+                hoja(nodos, cantidad);
+                return;
+            }
+            int actual = etiqueta[nodos[0]];
+            if (!conexa) {
+                // Cada componente se ordena por separado; quedan contiguas en `nodos`
+                buscador.recorrer(nodos[0], etiqueta.get(), actual, niveles);
+                if (niveles.numNodos < cantidad) {
+                    std::unique_ptr<int[]> limites = std::make_unique<int[]>(cantidad + 1);
+                    int numComponentes = 0;
+                    for (int t = 0; t < cantidad; t++) {
+                        if (etiqueta[nodos[t]] != actual) continue;
+                        buscador.recorrer(nodos[t], etiqueta.get(), actual, niveles);
+                        nuevaParte(niveles.orden.get(), niveles.numNodos);
+                        std::copy(niveles.orden.get(), niveles.orden.get() + niveles.numNodos,
+                                  auxiliar.get() + limites[numComponentes]);
+                        limites[numComponentes + 1] = limites[numComponentes] + niveles.numNodos;
+                        numComponentes++;
+                    }
+                    std::copy(auxiliar.get(), auxiliar.get() + cantidad, nodos);
+                    for (int c = 0; c < numComponentes; c++) {
+                        disecar(nodos + limites[c], limites[c + 1] - limites[c], true);
+                    }
+                    return;
+                }
+            }
+            buscador.periferico(nodos[0], etiqueta.get(), actual, niveles);
+            int numNiveles = niveles.numNiveles();
+            if (numNiveles < 3) {
+                hoja(nodos, cantidad);
+                return;
+            }
+            // Nivel central: el primero que deja atrás la mitad de los nodos
+            const int* inicioNivel = niveles.inicioNivel.get();
+            const int* ordenNiveles = niveles.orden.get();
+            int mitad = cantidad / 2;
+            int s = 1;
+            while (s < numNiveles - 2 && inicioNivel[s + 1] < mitad) s++;
+
+            // nodos queda como [parte A | parte B | separador]. Los nodos del nivel s sin vecinos en el nivel s + 1
+            // no separan nada y pasan a la parte A
+            int tamanoA = inicioNivel[s];
+            int tamanoSeparador = 0;
+            std::copy(ordenNiveles, ordenNiveles + tamanoA, nodos);
+            for (int p = inicioNivel[s]; p < inicioNivel[s + 1]; p++) {
+                int v = ordenNiveles[p];
+                bool separa = false;
+                for (int q = grafo.inicio[v]; q < grafo.inicio[v + 1] && !separa; q++) {
+                    int w = grafo.vecinos[q];
+                    separa = etiqueta[w] == actual && buscador.nivel[w] == s + 1;
+                }
+                if (separa) auxiliar[tamanoSeparador++] = v;
+                else nodos[tamanoA++] = v;
+            }
+            int tamanoB = cantidad - inicioNivel[s + 1];
+            std::copy(ordenNiveles + inicioNivel[s + 1], ordenNiveles + cantidad, nodos + tamanoA);
+            int* separador = nodos + tamanoA + tamanoB;
+            std::copy(auxiliar.get(), auxiliar.get() + tamanoSeparador, separador);
+
+            for (int t = 0; t < tamanoSeparador; t++) etiqueta[separador[t]] = -1;
+            nuevaParte(nodos, tamanoA);
+            nuevaParte(nodos + tamanoA, tamanoB);
+            disecar(nodos, tamanoA, false);
+            disecar(nodos + tamanoA, tamanoB, false);
+            std::copy(separador, separador + tamanoSeparador, orden.get() + numOrdenados);
+            numOrdenados += tamanoSeparador;
+        }
+
+        void ordenar(int* permutacion) {
+            std::unique_ptr<int[]> todos = std::make_unique<int[]>(grafo.n);
+            for (int i = 0; i < grafo.n; i++) todos[i] = i;
+            disecar(todos.get(), grafo.n, false);
+            std::copy(orden.get(), orden.get() + grafo.n, permutacion);
+        }
+};
+
+/**
+ * @brief Columnas de la mitad superior de C = P·A·Pᵀ (entradas (r, c) con r ≤ c), agrupadas por columna.
+ */
+struct TrianguloPermutado {
+    std::unique_ptr<int[]> inicio;
+    std::unique_ptr<int[]> filas;
+    std::unique_ptr<double[]> valores;
+};
+
+TrianguloPermutado trianguloSuperior(const SparseMatrix& A, const int* inversa) {
+    int n = A.getRows();
+    const int* inicioA = A.getInicioFila();
+    const int* columnasA = A.getColumnas();
+    const double* valoresA = A.getValores();
+    TrianguloPermutado C;
+    C.inicio = std::make_unique<int[]>(n + 1);
+    for (int i = 0; i < n; i++) {
+        for (int p = inicioA[i]; p < inicioA[i + 1]; p++) {
+            if (inversa[i] <= inversa[columnasA[p]]) C.inicio[inversa[columnasA[p]] + 1]++;
+        }
+    }
+    for (int c = 0; c < n; c++) C.inicio[c + 1] += C.inicio[c];
+    C.filas = std::make_unique<int[]>(C.inicio[n]);
+    C.valores = std::make_unique<double[]>(C.inicio[n]);
+    std::unique_ptr<int[]> siguiente = std::make_unique<int[]>(n);
+    std::copy(C.inicio.get(), C.inicio.get() + n, siguiente.get());
+    for (int i = 0; i < n; i++) {
+        for (int p = inicioA[i]; p < inicioA[i + 1]; p++) {
+            int r = inversa[i];
+            int c = inversa[columnasA[p]];
+            if (r > c) continue;
+            int destino = siguiente[c]++;
+            C.filas[destino] = r;
+            C.valores[destino] = valoresA[p];
+        }
+    }
+    return C;
+}
+
+/**
+ * @brief Construye en formato CSR la matriz cuyas columnas están dadas (inicio, filas, valores).
+ *
+ * Al recorrer las columnas en orden, las columnas de cada fila del resultado quedan ordenadas. Se omite la
+ * diagonal si `sinDiagonal` es verdadero.
+ */
+SparseMatrix desdeColumnas(int n, const int* inicio, const int* filas, const double* valores, bool sinDiagonal) {
+    std::unique_ptr<int[]> conteo = std::make_unique<int[]>(n + 1);
+    for (int c = 0; c < n; c++) {
+        for (int p = inicio[c]; p < inicio[c + 1]; p++) {
+            if (!sinDiagonal || filas[p] != c) conteo[filas[p] + 1]++;
+        }
+    }
+    for (int r = 0; r < n; r++) conteo[r + 1] += conteo[r];
+    SparseMatrix resultado(n, n, conteo[n]);
+    int* inicioFila = resultado.datosInicioFila();
+    int* columnas = resultado.datosColumnas();
+    double* valoresFila = resultado.datosValores();
+    std::copy(conteo.get(), conteo.get() + n + 1, inicioFila);
+    for (int c = 0; c < n; c++) {
+        for (int p = inicio[c]; p < inicio[c + 1]; p++) {
+            if (sinDiagonal && filas[p] == c) continue;
+            int destino = conteo[filas[p]]++;
+            columnas[destino] = c;
+            valoresFila[destino] = valores[p];
+        }
+    }
+    return resultado;
+}
+
+/**
+ * @brief Cambia el arreglo por uno de `capacidad` elementos que conserva los primeros `usados`.
+ */
+template <typename T>
+void ampliar(std::unique_ptr<T[]>& datos, long long usados, long long capacidad) {
+    std::unique_ptr<T[]> ampliado(new T[capacidad]);
+    std::copy(datos.get(), datos.get() + usados, ampliado.get());
+    datos = std::move(ampliado);
+}
+
+void verificarTermino(const Matrix& b, int n) {
+    if (b.getRows() != n || b.getCols() != 1) {
+        throw std::invalid_argument("El vector de términos independientes no coincide con el tamaño del sistema.");
+    }
+}
+
+void verificarPatron(const AnalisisSimbolico* simbolico, const SparseMatrix& A) {
+    if (simbolico == nullptr) {
+        throw std::invalid_argument("El análisis simbólico no puede ser nulo.");
+    }
+    if (!simbolico->mismoPatron(A)) {
+        throw std::invalid_argument("La matriz no tiene el patrón del análisis simbólico.");
+    }
+}
+
+} // namespace
+
+AnalisisSimbolico::AnalisisSimbolico(const SparseMatrix& A, OrdenamientoDispersa ordenamiento)
+    : n(A.getRows()), ordenamiento(ordenamiento), noCerosL(0), operaciones(0.0) {
+    if (A.getCols() != n || n <= 0) {
+        throw std::invalid_argument("El análisis simbólico requiere una matriz cuadrada no vacía.");
+    }
+    patron = SparseMatrix(n, n, A.getNoCeros());
+    std::copy(A.getInicioFila(), A.getInicioFila() + n + 1, patron.datosInicioFila());
+    std::copy(A.getColumnas(), A.getColumnas() + A.getNoCeros(), patron.datosColumnas());
+
+    // 1. Ordenamiento sobre el grafo de A + Aᵀ
+    GrafoPatron grafo = grafoSimetrico(A);
+    permutacion = std::make_unique<int[]>(n);
+    switch (ordenamiento) {
+        case OrdenamientoDispersa::Natural:
+            for (int k = 0; k < n; k++) permutacion[k] = k;
+            break;
+        case OrdenamientoDispersa::CuthillMcKeeInverso:
+            ordenCuthillMcKeeInverso(grafo, permutacion.get());
+            break;
+        case OrdenamientoDispersa::GradoMinimoAproximado:
+            ordenGradoMinimo(grafo, permutacion.get());
+            break;
+        case OrdenamientoDispersa::DiseccionAnidada:
+            DiseccionAnidada(grafo).ordenar(permutacion.get());
+            break;
+    }
+    inversa = std::make_unique<int[]>(n);
+    for (int k = 0; k < n; k++) inversa[permutacion[k]] = k;
+
+    // 2. Árbol de eliminación (algoritmo de Liu con compresión de caminos)
+    padre = std::make_unique<int[]>(n);
+    std::unique_ptr<int[]> ancestro = std::make_unique<int[]>(n);
+    std::fill(ancestro.get(), ancestro.get() + n, -1);
+    for (int k = 0; k < n; k++) {
+        padre[k] = -1;
+        int v = permutacion[k];
+        for (int q = grafo.inicio[v]; q < grafo.inicio[v + 1]; q++) {
+            for (int i = inversa[grafo.vecinos[q]]; i != -1 && i < k; ) {
+                int siguiente = ancestro[i];
+                ancestro[i] = k;
+                if (siguiente == -1) padre[i] = k;
+                i = siguiente;
+            }
+        }
+    }
+
+    // 3. Conteo de columnas: el patrón de la fila k de L es la unión de los caminos del árbol desde sus vecinos
+    conteoColumnas = std::make_unique<int[]>(n);
+    std::unique_ptr<int[]> marca = std::make_unique<int[]>(n);
+    std::fill(marca.get(), marca.get() + n, -1);
+    for (int k = 0; k < n; k++) conteoColumnas[k] = 1;
+    for (int k = 0; k < n; k++) {
+        marca[k] = k;
+        int v = permutacion[k];
+        for (int q = grafo.inicio[v]; q < grafo.inicio[v + 1]; q++) {
+            for (int i = inversa[grafo.vecinos[q]]; i < k && marca[i] != k; i = padre[i]) {
+                marca[i] = k;
+                conteoColumnas[i]++;
+            }
+        }
+    }
+    for (int k = 0; k < n; k++) {
+        noCerosL += conteoColumnas[k];
+        operaciones += static_cast<double>(conteoColumnas[k]) * conteoColumnas[k];
+    }
+}
+
+int AnalisisSimbolico::getSize() const {
+    return n;
+}
+
+OrdenamientoDispersa AnalisisSimbolico::getOrdenamiento() const {
+    return ordenamiento;
+}
+
+const int* AnalisisSimbolico::getPermutacion() const {
+    return permutacion.get();
+}
+
+const int* AnalisisSimbolico::getInversa() const {
+    return inversa.get();
+}
+
+const int* AnalisisSimbolico::getPadre() const {
+    return padre.get();
+}
+
+const int* AnalisisSimbolico::getConteoColumnas() const {
+    return conteoColumnas.get();
+}
+
+long long AnalisisSimbolico::getNoCerosCholesky() const {
+    return noCerosL;
+}
+
+double AnalisisSimbolico::getOperacionesCholesky() const {
+    return operaciones;
+}
+
+bool AnalisisSimbolico::mismoPatron(const SparseMatrix& B) const {
+    if (B.getRows() != n || B.getCols() != n || B.getNoCeros() != patron.getNoCeros()) {
+        return false;
+    }
+    return std::equal(B.getInicioFila(), B.getInicioFila() + n + 1, patron.getInicioFila()) &&
+           std::equal(B.getColumnas(), B.getColumnas() + B.getNoCeros(), patron.getColumnas());
+}
+
+FactorizacionCholeskyDispersa::FactorizacionCholeskyDispersa(const SparseMatrix& A, OrdenamientoDispersa ordenamiento)
+    : FactorizacionCholeskyDispersa(A, std::make_shared<const AnalisisSimbolico>(A, ordenamiento)) {}
+
+FactorizacionCholeskyDispersa::FactorizacionCholeskyDispersa(const SparseMatrix& A,
+                                                             std::shared_ptr<const AnalisisSimbolico> simbolico)
+    : simbolico(std::move(simbolico)), n(A.getRows()) {
+    verificarPatron(this->simbolico.get(), A);
+    factorizar(A);
+}
+
+void FactorizacionCholeskyDispersa::refactorizar(const SparseMatrix& A) {
+    verificarPatron(simbolico.get(), A);
+    factorizar(A);
+}
+
+/**
+ * @brief Cholesky por filas: la fila k de L resuelve L(0:k, 0:k)·l = C(0:k, k) sobre el patrón que da el árbol.
+ */
+void FactorizacionCholeskyDispersa::factorizar(const SparseMatrix& A) {
+    if (simbolico->getNoCerosCholesky() > INT_MAX) {
+        throw std::runtime_error("El factor tiene demasiadas entradas para el formato disperso.");
+    }
+    RegionRendimiento region(RegionMedida::Eliminacion, simbolico->getOperacionesCholesky());
+    const int* padre = simbolico->getPadre();
+    const int* conteo = simbolico->getConteoColumnas();
+    TrianguloPermutado C = trianguloSuperior(A, simbolico->getInversa());
+
+    std::unique_ptr<int[]> inicio = std::make_unique<int[]>(n + 1);
+    for (int j = 0; j < n; j++) inicio[j + 1] = inicio[j] + conteo[j];
+    std::unique_ptr<int[]> libre = std::make_unique<int[]>(n);
+    std::copy(inicio.get(), inicio.get() + n, libre.get());
+    std::unique_ptr<int[]> filas = std::make_unique<int[]>(inicio[n]);
+    std::unique_ptr<double[]> valores = std::make_unique<double[]>(inicio[n]);
+    std::unique_ptr<double[]> x = std::make_unique<double[]>(n);
+    std::unique_ptr<int[]> pila = std::make_unique<int[]>(n);
+    std::unique_ptr<int[]> marca = std::make_unique<int[]>(n);
+    std::fill(marca.get(), marca.get() + n, -1);
+
+    for (int k = 0; k < n; k++) {
+        verificarInterrupcion(RegionMedida::Eliminacion, k, n);
+        // Patrón de la fila k en orden topológico, en pila[tope .. n)
+        int tope = n;
+        marca[k] = k;
+        for (int p = C.inicio[k]; p < C.inicio[k + 1]; p++) {
+            int i = C.filas[p];
+            x[i] = C.valores[p];
+            int largo = 0;
+            for (; marca[i] != k; i = padre[i]) {
+                pila[largo++] = i;
+                marca[i] = k;
+            }
+            while (largo > 0) pila[--tope] = pila[--largo];
+        }
+        double d = x[k];
+        x[k] = 0.0;
+        for (; tope < n; tope++) {
+            int i = pila[tope];
+            double lki = x[i] / valores[inicio[i]];
+            x[i] = 0.0;
+            for (int p = inicio[i] + 1; p < libre[i]; p++) x[filas[p]] -= valores[p] * lki;
+            d -= lki * lki;
+            int p = libre[i]++;
+            filas[p] = k;
+            valores[p] = lki;
+        }
+        if (!(d > 0.0)) {
+            String columna; columna.fromInt(k);
+            String msg = String("La matriz no es definida positiva (pivote no positivo en la columna ") + columna +
+                         String(" del orden de eliminación).");
+            throw std::runtime_error(msg.c_str());
+        }
+        int p = libre[k]++;
+        filas[p] = k;
+        valores[p] = std::sqrt(d);
+    }
+    L = desdeColumnas(n, inicio.get(), filas.get(), valores.get(), false);
+}
+
+Matrix FactorizacionCholeskyDispersa::resolver(const Matrix& b) const {
+    verificarTermino(b, n);
+    RegionRendimiento region(RegionMedida::Sustitucion, 4.0 * L.getNoCeros());
+    const int* permutacion = simbolico->getPermutacion();
+    const int* inicio = L.getInicioFila();
+    const int* columnas = L.getColumnas();
+    const double* valores = L.getValores();
+    std::unique_ptr<double[]> y = std::make_unique<double[]>(n);
+    for (int k = 0; k < n; k++) y[k] = b.at(permutacion[k], 0);
+    // L·z = y (la diagonal es la última entrada de cada fila)
+    for (int i = 0; i < n; i++) {
+        double suma = y[i];
+        int diagonal = inicio[i + 1] - 1;
+        for (int p = inicio[i]; p < diagonal; p++) suma -= valores[p] * y[columnas[p]];
+        y[i] = suma / valores[diagonal];
+    }
+    // Lᵀ·w = z, recorriendo las filas de L de abajo hacia arriba
+    for (int i = n - 1; i >= 0; i--) {
+        int diagonal = inicio[i + 1] - 1;
+        y[i] /= valores[diagonal];
+        for (int p = inicio[i]; p < diagonal; p++) y[columnas[p]] -= valores[p] * y[i];
+    }
+    Matrix x(n, 1);
+    for (int k = 0; k < n; k++) x.at(permutacion[k], 0) = y[k];
+    return x;
+}
+
+int FactorizacionCholeskyDispersa::getSize() const {
+    return n;
+}
+
+const SparseMatrix& FactorizacionCholeskyDispersa::getL() const {
+    return L;
+}
+
+long long FactorizacionCholeskyDispersa::getNoCeros() const {
+    return L.getNoCeros();
+}
+
+std::shared_ptr<const AnalisisSimbolico> FactorizacionCholeskyDispersa::getAnalisis() const {
+    return simbolico;
+}
+
+FactorizacionLUDispersa::FactorizacionLUDispersa(const SparseMatrix& A, OrdenamientoDispersa ordenamiento,
+                                                 double umbralPivote)
+    : FactorizacionLUDispersa(A, std::make_shared<const AnalisisSimbolico>(A, ordenamiento), umbralPivote) {}
+
+FactorizacionLUDispersa::FactorizacionLUDispersa(const SparseMatrix& A, std::shared_ptr<const AnalisisSimbolico> simbolico,
+                                                 double umbralPivote)
+    : simbolico(std::move(simbolico)), n(A.getRows()), umbralPivote(umbralPivote), pivotesFueraDiagonal(0) {
+    if (!(umbralPivote > 0.0 && umbralPivote <= 1.0)) {
+        throw std::invalid_argument("El umbral de pivoteo debe estar en (0, 1].");
+    }
+    verificarPatron(this->simbolico.get(), A);
+    factorizar(A);
+}
+
+void FactorizacionLUDispersa::refactorizar(const SparseMatrix& A) {
+    verificarPatron(simbolico.get(), A);
+    factorizar(A);
+}
+
+/**
+ * @brief LU por columnas de Gilbert-Peierls: la columna k resuelve L·x = A(:, q_k) con el patrón que da una
+ * búsqueda en profundidad en el grafo de L, y luego elige el pivote entre las filas que todavía no lo fueron.
+ */
+void FactorizacionLUDispersa::factorizar(const SparseMatrix& A) {
+    // Sin pivoteo fuera de la diagonal la LU de un patrón simétrico hace el doble de operaciones que Cholesky
+    RegionRendimiento region(RegionMedida::Eliminacion, 2.0 * simbolico->getOperacionesCholesky());
+    const int* orden = simbolico->getPermutacion();
+    SparseMatrix columnasA = A.transpuesta();   // La fila j es la columna j de A. //
+    const int* inicioA = columnasA.getInicioFila();
+    const int* filasA = columnasA.getColumnas();
+    const double* valoresA = columnasA.getValores();
+    double maximo = 0.0;
+    for (int p = 0; p < A.getNoCeros(); p++) maximo = std::max(maximo, std::abs(valoresA[p]));
+    const double tolerancia = TOLERANCIA_PIVOTE_RELATIVA * maximo;
+
+    // L y U crecen por columnas; se reservan como el factor de Cholesky y se duplican si no alcanza
+    long long capacidadL = std::min<long long>(simbolico->getNoCerosCholesky(), INT_MAX);
+    long long capacidadU = capacidadL;
+    long long noCerosL = 0;
+    long long noCerosU = 0;
+    std::unique_ptr<int[]> inicioL = std::make_unique<int[]>(n + 1);
+    std::unique_ptr<int[]> filasL(new int[capacidadL]);
+    std::unique_ptr<double[]> valoresL(new double[capacidadL]);
+    std::unique_ptr<int[]> inicioU = std::make_unique<int[]>(n + 1);
+    std::unique_ptr<int[]> filasU(new int[capacidadU]);
+    std::unique_ptr<double[]> valoresU(new double[capacidadU]);
+
+    pasoFila = std::make_unique<int[]>(n);
+    std::fill(pasoFila.get(), pasoFila.get() + n, -1);
+    int* paso = pasoFila.get();
+    pivotesFueraDiagonal = 0;
+    std::unique_ptr<double[]> x = std::make_unique<double[]>(n);
+    std::unique_ptr<int[]> alcance = std::make_unique<int[]>(n);   // Salida de la búsqueda en alcance[tope .. n). //
+    std::unique_ptr<int[]> pila = std::make_unique<int[]>(n);
+    std::unique_ptr<int[]> posicion = std::make_unique<int[]>(n);
+    std::unique_ptr<int[]> visitado = std::make_unique<int[]>(n);
+    std::fill(visitado.get(), visitado.get() + n, -1);
+
+    for (int k = 0; k < n; k++) {
+        verificarInterrupcion(RegionMedida::Eliminacion, k, n);
+        int columna = orden[k];
+
+        // 1. Patrón de L⁻¹·A(:, columna) en orden topológico (búsqueda en profundidad no recursiva)
+        int tope = n;
+        for (int p = inicioA[columna]; p < inicioA[columna + 1]; p++) {
+            int raiz = filasA[p];
+            if (visitado[raiz] == k) continue;
+            int cabeza = 0;
+            pila[0] = raiz;
+            while (cabeza >= 0) {
+                int j = pila[cabeza];
+                int J = paso[j];
+                if (visitado[j] != k) {
+                    visitado[j] = k;
+                    posicion[cabeza] = J < 0 ? 0 : inicioL[J];
+                }
+                bool terminado = true;
+                int fin = J < 0 ? 0 : inicioL[J + 1];
+                for (int q = posicion[cabeza]; q < fin; q++) {
+                    int i = filasL[q];
+                    if (visitado[i] == k) continue;
+                    posicion[cabeza] = q;
+                    pila[++cabeza] = i;
+                    terminado = false;
+                    break;
+                }
+                if (terminado) {
+                    cabeza--;
+                    alcance[--tope] = j;
+                }
+            }
+        }
+
+        // 2. Sustitución triangular dispersa
+        for (int p = inicioA[columna]; p < inicioA[columna + 1]; p++) x[filasA[p]] = valoresA[p];
+        for (int px = tope; px < n; px++) {
+            int j = alcance[px];
+            int J = paso[j];
+            if (J < 0) continue;
+            double xj = x[j];
+            for (int q = inicioL[J] + 1; q < inicioL[J + 1]; q++) x[filasL[q]] -= valoresL[q] * xj;
+        }
+
+        // 3. Pivote por umbral, con preferencia por la diagonal del ordenamiento. La columna agrega a lo más
+        //    n - tope + 1 entradas a cada factor
+        if (noCerosU + n - tope + 1 > capacidadU) {
+            capacidadU = std::max(2 * capacidadU, noCerosU + n - tope + 1);
+            ampliar(filasU, noCerosU, capacidadU);
+            ampliar(valoresU, noCerosU, capacidadU);
+        }
+        if (noCerosL + n - tope + 1 > capacidadL) {
+            capacidadL = std::max(2 * capacidadL, noCerosL + n - tope + 1);
+            ampliar(filasL, noCerosL, capacidadL);
+            ampliar(valoresL, noCerosL, capacidadL);
+        }
+        int filaPivote = -1;
+        double mayor = -1.0;
+        for (int px = tope; px < n; px++) {
+            int i = alcance[px];
+            if (paso[i] < 0) {
+                if (std::abs(x[i]) > mayor) {
+                    mayor = std::abs(x[i]);
+                    filaPivote = i;
+                }
+            } else {
+                filasU[noCerosU] = paso[i];
+                valoresU[noCerosU++] = x[i];
+            }
+        }
+        if (filaPivote == -1 || mayor <= tolerancia) {
+            for (int px = tope; px < n; px++) x[alcance[px]] = 0.0;
+            String numero; numero.fromInt(k);
+            String msg = String("La matriz es singular: no hay pivote en la columna ") + numero +
+                         String(" del orden de eliminación.");
+            throw std::runtime_error(msg.c_str());
+        }
+        if (paso[columna] < 0 && std::abs(x[columna]) >= umbralPivote * mayor) {
+            filaPivote = columna;
+        } else if (filaPivote != columna) {
+            pivotesFueraDiagonal++;
+        }
+        double pivote = x[filaPivote];
+        filasU[noCerosU] = k;
+        valoresU[noCerosU++] = pivote;
+        inicioU[k + 1] = static_cast<int>(noCerosU);
+        paso[filaPivote] = k;
+
+        // 4. Columna k de L (el pivote va primero con valor 1)
+        filasL[noCerosL] = filaPivote;
+        valoresL[noCerosL++] = 1.0;
+        for (int px = tope; px < n; px++) {
+            int i = alcance[px];
+            if (paso[i] < 0) {
+                filasL[noCerosL] = i;
+                valoresL[noCerosL++] = x[i] / pivote;
+            }
+            x[i] = 0.0;
+        }
+        if (noCerosL > INT_MAX || noCerosU > INT_MAX) {
+            throw std::runtime_error("El factor tiene demasiadas entradas para el formato disperso.");
+        }
+        inicioL[k + 1] = static_cast<int>(noCerosL);
+    }
+
+    // Las filas de L pasan al orden de los pivotes
+    for (long long p = 0; p < noCerosL; p++) filasL[p] = paso[filasL[p]];
+    L = desdeColumnas(n, inicioL.get(), filasL.get(), valoresL.get(), true);
+    U = desdeColumnas(n, inicioU.get(), filasU.get(), valoresU.get(), false);
+}
+
+Matrix FactorizacionLUDispersa::resolver(const Matrix& b) const {
+    verificarTermino(b, n);
+    RegionRendimiento region(RegionMedida::Sustitucion, 2.0 * (L.getNoCeros() + U.getNoCeros()));
+    const int* orden = simbolico->getPermutacion();
+    std::unique_ptr<double[]> y = std::make_unique<double[]>(n);
+    for (int i = 0; i < n; i++) y[pasoFila[i]] = b.at(i, 0);
+    const int* inicio = L.getInicioFila();
+    const int* columnas = L.getColumnas();
+    const double* valores = L.getValores();
+    for (int i = 0; i < n; i++) {
+        double suma = y[i];
+        for (int p = inicio[i]; p < inicio[i + 1]; p++) suma -= valores[p] * y[columnas[p]];
+        y[i] = suma;
+    }
+    // U·w = z (la diagonal es la primera entrada de cada fila)
+    inicio = U.getInicioFila();
+    columnas = U.getColumnas();
+    valores = U.getValores();
+    for (int i = n - 1; i >= 0; i--) {
+        double suma = y[i];
+        for (int p = inicio[i] + 1; p < inicio[i + 1]; p++) suma -= valores[p] * y[columnas[p]];
+        y[i] = suma / valores[inicio[i]];
+    }
+    Matrix x(n, 1);
+    for (int k = 0; k < n; k++) x.at(orden[k], 0) = y[k];
+    return x;
+}
+
+int FactorizacionLUDispersa::getSize() const {
+    return n;
+}
+
+const SparseMatrix& FactorizacionLUDispersa::getL() const {
+    return L;
+}
+
+const SparseMatrix& FactorizacionLUDispersa::getU() const {
+    return U;
+}
+
+long long FactorizacionLUDispersa::getNoCeros() const {
+    return static_cast<long long>(L.getNoCeros()) + U.getNoCeros();
+}
+
+int FactorizacionLUDispersa::getPivotesFueraDiagonal() const {
+    return pivotesFueraDiagonal;
+}
+
+std::shared_ptr<const AnalisisSimbolico> FactorizacionLUDispersa::getAnalisis() const {
+    return simbolico;
+}
+
+Matrix resolverDirectoDisperso(const SparseMatrix& A, const Matrix& b, OrdenamientoDispersa ordenamiento) {
+    int n = A.getRows();
+    if (A.getCols() != n || b.getRows() != n || b.getCols() != 1) {
+        throw std::invalid_argument("Las dimensiones de A y b no son compatibles.");
+    }
+    // Simétrica con diagonal positiva: candidata a Cholesky
+    SparseMatrix T = A.transpuesta();
+    bool simetrica = std::equal(A.getInicioFila(), A.getInicioFila() + n + 1, T.getInicioFila()) &&
+                     std::equal(A.getColumnas(), A.getColumnas() + A.getNoCeros(), T.getColumnas());
+    double maximo = 0.0;
+    for (int p = 0; p < A.getNoCeros(); p++) maximo = std::max(maximo, std::abs(A.getValores()[p]));
+    for (int p = 0; p < A.getNoCeros() && simetrica; p++) {
+        simetrica = std::abs(A.getValores()[p] - T.getValores()[p]) <= 1e-12 * maximo;
+    }
+    std::unique_ptr<double[]> diagonal = std::make_unique<double[]>(n);
+    A.diagonal(diagonal.get());
+    bool diagonalPositiva = std::all_of(diagonal.get(), diagonal.get() + n, [](double d) { return d > 0.0; });
+
+    auto simbolico = std::make_shared<const AnalisisSimbolico>(A, ordenamiento);
+    if (simetrica && diagonalPositiva) {
+        try {
+            return FactorizacionCholeskyDispersa(A, simbolico).resolver(b);
+        } catch (const std::runtime_error&) {
+            if (SesionControl::activo() != nullptr && SesionControl::activo()->estado() != EstadoEjecucion::Activa) throw;
+            // No es definida positiva: se usa la LU con el mismo análisis
+        }
+    }
+    return FactorizacionLUDispersa(A, simbolico).resolver(b);
+}
+
+const char* nombreOrdenamiento(OrdenamientoDispersa ordenamiento) {
+    switch (ordenamiento) {
+        case OrdenamientoDispersa::Natural: return "Natural";
+        case OrdenamientoDispersa::CuthillMcKeeInverso: return "Cuthill-McKee inverso";
+        case OrdenamientoDispersa::GradoMinimoAproximado: return "Grado mínimo aproximado";
+        case OrdenamientoDispersa::DiseccionAnidada: return "Disección anidada";
+    }
+    return "Desconocido";
+}
@@ -0,0 +1,259 @@
+/**
+ * @file SparseDirect.hpp
+ * @brief Declaración de los métodos directos dispersos: LU y Cholesky con ordenamientos que reducen el llenado.
+ *
+ * La eliminación de Gauss densa cuesta O(n³) operaciones y O(n²) memoria aunque la matriz sea casi toda ceros.
+ * Las factorizaciones dispersas solo guardan y operan con las entradas no nulas de los factores; su costo
+ * depende del llenado (las entradas que aparecen en L y U donde A tenía ceros), que a su vez depende del orden
+ * de eliminación. Por eso se trabaja en dos fases:
+ * -Análisis simbólico: solo mira el patrón de A; calcula un ordenamiento que reduce el llenado, el árbol de
+ *  eliminación y cuántas entradas tendrá cada columna del factor. Se reutiliza para todas las matrices con
+ *  el mismo patrón (pasos de tiempo, iteraciones de Newton, barridos de parámetros).
+ * -Factorización numérica: Cholesky por filas guiada por el árbol de eliminación para matrices simétricas
+ *  definidas positivas, o LU por columnas de Gilbert-Peierls con pivoteo parcial por umbral para las demás.
+ */
+#ifndef SPARSE_DIRECT_HPP
+#define SPARSE_DIRECT_HPP
+
+#include <memory>
+#include "Matrix.hpp"
+#include "SparseMatrix.hpp"
+
+/**
+ * @brief Ordenamiento simétrico de filas y columnas que se aplica antes de factorizar.
+ *
+ * Todos trabajan sobre el grafo del patrón de A + Aᵀ.
+ */
+enum class OrdenamientoDispersa {
+    Natural,               ///< Sin permutación.
+    CuthillMcKeeInverso,   ///< Cuthill-McKee inverso: reduce el ancho de banda, útil en problemas casi unidimensionales.
+    GradoMinimoAproximado, ///< Grado mínimo aproximado (AMD) sobre el grafo cociente: el de uso general.
+    DiseccionAnidada       ///< Disección anidada por separadores de niveles: el mejor para mallas 2D y 3D grandes.
+};
+
+/**
+ * @class AnalisisSimbolico
+ * @brief Ordenamiento, árbol de eliminación y conteo de columnas del factor de Cholesky de P·(A + Aᵀ)·Pᵀ.
+ *
+ * Para la LU el conteo es el llenado exacto si no hay pivoteo fuera de la diagonal y se usa para reservar
+ * memoria. Se guarda una copia del patrón de A para verificar que las matrices que lo reutilizan lo compartan.
+ */
+class AnalisisSimbolico {
+    private:
+        int n;
+        OrdenamientoDispersa ordenamiento;
+        std::unique_ptr<int[]> permutacion;    // La posición k del orden es la incógnita permutacion[k]. //
+        std::unique_ptr<int[]> inversa;        // inversa[permutacion[k]] = k. //
+        std::unique_ptr<int[]> padre;          // Padre de cada columna permutada en el árbol de eliminación (-1 en las raíces). //
+        std::unique_ptr<int[]> conteoColumnas; // Entradas de cada columna de L, incluida la diagonal. //
+        long long noCerosL;
+        double operaciones;
+        SparseMatrix patron;                   // Patrón de A; sus valores quedan en cero. //
+    public:
+        /**
+        * @param A Matriz dispersa cuadrada; solo se usa su patrón.
+        * @param ordenamiento Ordenamiento que reduce el llenado.
+        *
+        * @throws std::invalid_argument Si A no es cuadrada o está vacía.
+        */
+        explicit AnalisisSimbolico(const SparseMatrix& A,
+                                   OrdenamientoDispersa ordenamiento = OrdenamientoDispersa::GradoMinimoAproximado);
+
+        int getSize() const;
+        OrdenamientoDispersa getOrdenamiento() const;
+
+        /**
+        * @brief Permutación: la posición k del orden de eliminación es la incógnita getPermutacion()[k].
+        */
+        const int* getPermutacion() const;
+
+        /**
+        * @brief Posición de cada incógnita en el orden de eliminación.
+        */
+        const int* getInversa() const;
+
+        /**
+        * @brief Árbol de eliminación en el orden permutado (-1 en las raíces).
+        */
+        const int* getPadre() const;
+
+        /**
+        * @brief Entradas de la columna j del factor de Cholesky (orden permutado), incluida la diagonal.
+        */
+        const int* getConteoColumnas() const;
+
+        /**
+        * @brief Entradas del factor de Cholesky, incluida la diagonal; mide la calidad del ordenamiento.
+        */
+        long long getNoCerosCholesky() const;
+
+        /**
+        * @brief Operaciones de punto flotante de la factorización de Cholesky.
+        */
+        double getOperacionesCholesky() const;
+
+        /**
+        * @brief Indica si B tiene exactamente el mismo patrón que la matriz analizada.
+        */
+        bool mismoPatron(const SparseMatrix& B) const;
+};
+
+/**
+ * @class FactorizacionCholeskyDispersa
+ * @brief Factorización P·A·Pᵀ = L·Lᵀ de una matriz dispersa simétrica definida positiva.
+ *
+ * Cada fila de L se obtiene resolviendo un sistema triangular disperso cuyo patrón es el recorrido del árbol
+ * de eliminación desde las entradas de la fila de A (Cholesky "por filas"). Solo se lee la mitad de A que
+ * queda en el triángulo superior después de permutar, así que A debe ser simétrica.
+ */
+class FactorizacionCholeskyDispersa {
+    private:
+        std::shared_ptr<const AnalisisSimbolico> simbolico;
+        int n;
+        SparseMatrix L;   // Triangular inferior con la diagonal, en el orden permutado. //
+
+        void factorizar(const SparseMatrix& A);
+    public:
+        /**
+        * @brief Analiza el patrón de A con el ordenamiento dado y la factoriza.
+        *
+        * @throws std::invalid_argument Si A no es cuadrada.
+        * @throws std::runtime_error Si A no es definida positiva.
+        */
+        explicit FactorizacionCholeskyDispersa(const SparseMatrix& A,
+                                               OrdenamientoDispersa ordenamiento = OrdenamientoDispersa::GradoMinimoAproximado);
+
+        /**
+        * @brief Factoriza A reutilizando un análisis simbólico de una matriz con el mismo patrón.
+        *
+        * @throws std::invalid_argument Si el análisis es nulo o A no tiene el patrón analizado.
+        * @throws std::runtime_error Si A no es definida positiva.
+        */
+        FactorizacionCholeskyDispersa(const SparseMatrix& A, std::shared_ptr<const AnalisisSimbolico> simbolico);
+
+        /**
+        * @brief Vuelve a factorizar con los valores de otra matriz del mismo patrón, sin repetir el análisis.
+        *
+        * @throws std::invalid_argument Si A no tiene el patrón analizado.
+        * @throws std::runtime_error Si A no es definida positiva.
+        */
+        void refactorizar(const SparseMatrix& A);
+
+        /**
+        * @brief Resuelve A·x = b con las dos sustituciones triangulares.
+        *
+        * @throws std::invalid_argument Si b no es un vector columna del tamaño de A.
+        */
+        Matrix resolver(const Matrix& b) const;
+
+        int getSize() const;
+
+        /**
+        * @brief Factor L en el orden permutado (triangular inferior, con la diagonal).
+        */
+        const SparseMatrix& getL() const;
+
+        long long getNoCeros() const;
+
+        std::shared_ptr<const AnalisisSimbolico> getAnalisis() const;
+};
+
+/**
+ * @class FactorizacionLUDispersa
+ * @brief Factorización P·A·Q = L·U de una matriz dispersa cualquiera (algoritmo de Gilbert-Peierls).
+ *
+ * Las columnas se procesan en el orden del análisis simbólico. Cada columna de L y U se obtiene con una
+ * sustitución triangular dispersa cuyo patrón se calcula antes por búsqueda en profundidad, de modo que el
+ * costo es proporcional a las operaciones y no a n. El pivote es la entrada de mayor magnitud de la columna,
+ * salvo que la diagonal del ordenamiento alcance `umbralPivote` veces ese máximo: así se conserva el
+ * ordenamiento que reduce el llenado mientras sea numéricamente aceptable.
+ */
+class FactorizacionLUDispersa {
+    private:
+        std::shared_ptr<const AnalisisSimbolico> simbolico;
+        int n;
+        double umbralPivote;
+        int pivotesFueraDiagonal;
+        std::unique_ptr<int[]> pasoFila;   // Paso en que cada fila de A fue pivote (fila de P·A). //
+        SparseMatrix L;                    // Estrictamente inferior (diagonal unitaria implícita), orden permutado. //
+        SparseMatrix U;                    // Triangular superior con la diagonal, orden permutado. //
+
+        void factorizar(const SparseMatrix& A);
+    public:
+        /**
+        * @param A Matriz dispersa cuadrada.
+        * @param ordenamiento Ordenamiento que reduce el llenado.
+        * @param umbralPivote Entre 0 y 1: 1 es pivoteo parcial estricto; valores menores favorecen la diagonal.
+        *
+        * @throws std::invalid_argument Si A no es cuadrada o el umbral no está en (0, 1].
+        * @throws std::runtime_error Si A es singular.
+        */
+        explicit FactorizacionLUDispersa(const SparseMatrix& A,
+                                         OrdenamientoDispersa ordenamiento = OrdenamientoDispersa::GradoMinimoAproximado,
+                                         double umbralPivote = 0.1);
+
+        /**
+        * @brief Factoriza A reutilizando un análisis simbólico de una matriz con el mismo patrón.
+        *
+        * @throws std::invalid_argument Si el análisis es nulo, A no tiene el patrón analizado o el umbral no es válido.
+        * @throws std::runtime_error Si A es singular.
+        */
+        FactorizacionLUDispersa(const SparseMatrix& A, std::shared_ptr<const AnalisisSimbolico> simbolico,
+                                double umbralPivote = 0.1);
+
+        /**
+        * @brief Vuelve a factorizar con los valores de otra matriz del mismo patrón, sin repetir el análisis.
+        *
+        * @throws std::invalid_argument Si A no tiene el patrón analizado.
+        * @throws std::runtime_error Si A es singular.
+        */
+        void refactorizar(const SparseMatrix& A);
+
+        /**
+        * @brief Resuelve A·x = b con las dos sustituciones triangulares.
+        *
+        * @throws std::invalid_argument Si b no es un vector columna del tamaño de A.
+        */
+        Matrix resolver(const Matrix& b) const;
+
+        int getSize() const;
+        const SparseMatrix& getL() const;
+        const SparseMatrix& getU() const;
+
+        /**
+        * @brief Entradas guardadas en L y U, incluida la diagonal de U.
+        */
+        long long getNoCeros() const;
+
+        /**
+        * @brief Columnas en las que el pivote no fue la diagonal del ordenamiento.
+        */
+        int getPivotesFueraDiagonal() const;
+
+        std::shared_ptr<const AnalisisSimbolico> getAnalisis() const;
+};
+
+/**
+ * @brief Resuelve A·x = b con el método directo disperso adecuado.
+ *
+ * Si A es simétrica y su diagonal es positiva intenta Cholesky, que usa la mitad de memoria y de operaciones;
+ * si resulta no ser definida positiva, o A no es simétrica, usa la LU con pivoteo por umbral. El análisis
+ * simbólico se hace una sola vez en ambos casos.
+ *
+ * @param A Matriz dispersa cuadrada.
+ * @param b Vector columna de términos independientes.
+ * @param ordenamiento Ordenamiento que reduce el llenado.
+ * @return Matrix Vector solución del sistema.
+ *
+ * @throws std::invalid_argument Si las dimensiones no son compatibles.
+ * @throws std::runtime_error Si A es singular.
+ */
+Matrix resolverDirectoDisperso(const SparseMatrix& A, const Matrix& b,
+                               OrdenamientoDispersa ordenamiento = OrdenamientoDispersa::GradoMinimoAproximado);
+
+/**
+ * @brief Nombre del ordenamiento para reportes.
+ */
+const char* nombreOrdenamiento(OrdenamientoDispersa ordenamiento);
+
+#endif
@@ -0,0 +1,275 @@
+/**
+ * @file SparseMatrix.cpp
+ * @brief Implementación de la clase SparseMatrix en formato CSR.
+ *
+ * @section features_sec Características principales
+ * -Construcción desde tripletes o desde una matriz densa.
+ * -Producto matriz-vector, transpuesta y producto disperso de matrices en O(nnz).
+ */
+#include "SparseMatrix.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+SparseMatrix::SparseMatrix() : SparseMatrix(0, 0, 0) {}
+
+SparseMatrix::SparseMatrix(int r, int c, int nnz) : rows(r), cols(c), noCeros(nnz) {
+    if (r < 0 || c < 0 || nnz < 0) {
+        throw std::invalid_argument("Las dimensiones de la matriz dispersa no pueden ser negativas.");
+    }
+    inicioFila = std::make_unique<int[]>(static_cast<size_t>(r) + 1);
+    columnas = std::make_unique<int[]>(nnz);
+    valores = std::make_unique<double[]>(nnz);
+}
+
+SparseMatrix::SparseMatrix(const Matrix& densa, double tolerancia)
+    : SparseMatrix(densa.getRows(), densa.getCols(), 0) {
+    int cuenta = 0;
+    for (int i = 0; i < rows; i++) {
+        for (int j = 0; j < cols; j++) {
+            if (i == j || std::abs(densa.at(i, j)) > tolerancia) cuenta++;
+        }
+    }
+    noCeros = cuenta;
+    columnas = std::make_unique<int[]>(cuenta);
+    valores = std::make_unique<double[]>(cuenta);
+    int k = 0;
+    for (int i = 0; i < rows; i++) {
+        inicioFila[i] = k;
+        for (int j = 0; j < cols; j++) {
+            if (i == j || std::abs(densa.at(i, j)) > tolerancia) {
+                columnas[k] = j;
+                valores[k] = densa.at(i, j);
+                k++;
+            }
+        }
+    }
+    inicioFila[rows] = k;
+}
+
+SparseMatrix::SparseMatrix(const SparseMatrix& other) : SparseMatrix(other.rows, other.cols, other.noCeros) {
+    std::copy(other.inicioFila.get(), other.inicioFila.get() + rows + 1, inicioFila.get());
+    std::copy(other.columnas.get(), other.columnas.get() + noCeros, columnas.get());
+    std::copy(other.valores.get(), other.valores.get() + noCeros, valores.get());
+}
+
+SparseMatrix& SparseMatrix::operator=(const SparseMatrix& other) {
+    if (this != &other) {
+        SparseMatrix copia(other);
+        *this = std::move(copia);
+    }
+    return *this;
+}
+
+SparseMatrix SparseMatrix::desdeTripletes(int r, int c, int cantidad, const int* filasT, const int* columnasT, const double* valoresT) {
+    // Conteo por filas, ordenamiento de cada fila por columna y suma de repetidos
+    std::unique_ptr<int[]> inicio = std::make_unique<int[]>(static_cast<size_t>(r) + 1);
+    for (int k = 0; k < cantidad; k++) {
+        if (filasT[k] < 0 || filasT[k] >= r || columnasT[k] < 0 || columnasT[k] >= c) {
+            throw std::out_of_range("Triplete fuera de las dimensiones de la matriz dispersa.");
+        }
+        inicio[filasT[k] + 1]++;
+    }
+    for (int i = 0; i < r; i++) inicio[i + 1] += inicio[i];
+    std::unique_ptr<int[]> siguiente = std::make_unique<int[]>(r);
+    std::copy(inicio.get(), inicio.get() + r, siguiente.get());
+    std::unique_ptr<std::pair<int, double>[]> entradas = std::make_unique<std::pair<int, double>[]>(cantidad);
+    for (int k = 0; k < cantidad; k++) {
+        entradas[siguiente[filasT[k]]++] = {columnasT[k], valoresT[k]};
+    }
+
+    int total = 0;
+    for (int i = 0; i < r; i++) {
+        std::pair<int, double>* desde = entradas.get() + inicio[i];
+        std::pair<int, double>* hasta = entradas.get() + inicio[i + 1];
+        std::sort(desde, hasta, [](const std::pair<int, double>& x, const std::pair<int, double>& y) { return x.first < y.first; });
+        for (std::pair<int, double>* it = desde; it != hasta; ++it) {
+            if (it == desde || it->first != (it - 1)->first) total++;
+        }
+    }
+
+    SparseMatrix A(r, c, total);
+    int k = 0;
+    for (int i = 0; i < r; i++) {
+        A.inicioFila[i] = k;
+        for (int p = inicio[i]; p < inicio[i + 1]; p++) {
+            if (p > inicio[i] && entradas[p].first == entradas[p - 1].first) {
+                A.valores[k - 1] += entradas[p].second;
+            } else {
+                A.columnas[k] = entradas[p].first;
+                A.valores[k] = entradas[p].second;
+                k++;
+            }
+        }
+    }
+    A.inicioFila[r] = k;
+    return A;
+}
+
+int SparseMatrix::getRows() const {
+    return rows;
+}
+
+int SparseMatrix::getCols() const {
+    return cols;
+}
+
+int SparseMatrix::getNoCeros() const {
+    return noCeros;
+}
+
+const int* SparseMatrix::getInicioFila() const {
+    return inicioFila.get();
+}
+
+const int* SparseMatrix::getColumnas() const {
+    return columnas.get();
+}
+
+const double* SparseMatrix::getValores() const {
+    return valores.get();
+}
+
+int* SparseMatrix::datosInicioFila() {
+    return inicioFila.get();
+}
+
+int* SparseMatrix::datosColumnas() {
+    return columnas.get();
+}
+
+double* SparseMatrix::datosValores() {
+    return valores.get();
+}
+
+double SparseMatrix::at(int row, int col) const {
+    if (row < 0 || row >= rows || col < 0 || col >= cols) {
+        throw std::out_of_range("Índice fuera de rango.");
+    }
+    const int* desde = columnas.get() + inicioFila[row];
+    const int* hasta = columnas.get() + inicioFila[row + 1];
+    const int* it = std::lower_bound(desde, hasta, col);
+    return (it != hasta && *it == col) ? valores[it - columnas.get()] : 0.0;
+}
+
+void SparseMatrix::multiplicar(const double* x, double* y) const {
+    for (int i = 0; i < rows; i++) {
+        double suma = 0.0;
+        for (int k = inicioFila[i]; k < inicioFila[i + 1]; k++) {
+            suma += valores[k] * x[columnas[k]];
+        }
+        y[i] = suma;
+    }
+}
+
+Matrix SparseMatrix::multiplicar(const Matrix& x) const {
+    if (x.getRows() != cols || x.getCols() != 1) {
+        throw std::invalid_argument("El vector no tiene las dimensiones de la matriz dispersa.");
+    }
+    Matrix y(rows, 1);
+    for (int i = 0; i < rows; i++) {
+        double suma = 0.0;
+        for (int k = inicioFila[i]; k < inicioFila[i + 1]; k++) {
+            suma += valores[k] * x.at(columnas[k], 0);
+        }
+        y.at(i, 0) = suma;
+    }
+    return y;
+}
+
+void SparseMatrix::diagonal(double* d) const {
+    int m = std::min(rows, cols);
+    for (int i = 0; i < m; i++) {
+        d[i] = 0.0;
+        for (int k = inicioFila[i]; k < inicioFila[i + 1]; k++) {
+            if (columnas[k] == i) {
+                d[i] = valores[k];
+                break;
+            }
+        }
+    }
+}
+
+SparseMatrix SparseMatrix::transpuesta() const {
+    SparseMatrix T(cols, rows, noCeros);
+    for (int k = 0; k < noCeros; k++) T.inicioFila[columnas[k] + 1]++;
+    for (int j = 0; j < cols; j++) T.inicioFila[j + 1] += T.inicioFila[j];
+    std::unique_ptr<int[]> siguiente = std::make_unique<int[]>(static_cast<size_t>(cols) + 1);
+    std::copy(T.inicioFila.get(), T.inicioFila.get() + cols, siguiente.get());
+    // Recorrer las filas en orden deja las columnas de T ordenadas
+    for (int i = 0; i < rows; i++) {
+        for (int k = inicioFila[i]; k < inicioFila[i + 1]; k++) {
+            int destino = siguiente[columnas[k]]++;
+            T.columnas[destino] = i;
+            T.valores[destino] = valores[k];
+        }
+    }
+    return T;
+}
+
+SparseMatrix SparseMatrix::producto(const SparseMatrix& B) const {
+    if (cols != B.rows) {
+        throw std::invalid_argument("Las dimensiones de las matrices dispersas no son compatibles para el producto.");
+    }
+    // Primera pasada: estructura de cada fila con un marcador por columna
+    std::unique_ptr<int[]> marca = std::make_unique<int[]>(B.cols);
+    std::fill(marca.get(), marca.get() + B.cols, -1);
+    std::unique_ptr<int[]> inicio = std::make_unique<int[]>(static_cast<size_t>(rows) + 1);
+    long long total = 0;
+    for (int i = 0; i < rows; i++) {
+        inicio[i] = static_cast<int>(total);
+        for (int k = inicioFila[i]; k < inicioFila[i + 1]; k++) {
+            int fila = columnas[k];
+            for (int q = B.inicioFila[fila]; q < B.inicioFila[fila + 1]; q++) {
+                if (marca[B.columnas[q]] != i) {
+                    marca[B.columnas[q]] = i;
+                    total++;
+                }
+            }
+        }
+    }
+    if (total > 2147483647LL) {
+        throw std::length_error("El producto disperso excede el número máximo de entradas.");
+    }
+    inicio[rows] = static_cast<int>(total);
+
+    // Segunda pasada: valores acumulados en un arreglo denso de la fila
+    SparseMatrix C(rows, B.cols, static_cast<int>(total));
+    std::copy(inicio.get(), inicio.get() + rows + 1, C.inicioFila.get());
+    std::unique_ptr<double[]> acumulado = std::make_unique<double[]>(B.cols);
+    std::fill(marca.get(), marca.get() + B.cols, -1);
+    for (int i = 0; i < rows; i++) {
+        int k0 = C.inicioFila[i];
+        int largo = 0;
+        for (int k = inicioFila[i]; k < inicioFila[i + 1]; k++) {
+            int fila = columnas[k];
+            double a = valores[k];
+            for (int q = B.inicioFila[fila]; q < B.inicioFila[fila + 1]; q++) {
+                int j = B.columnas[q];
+                if (marca[j] != i) {
+                    marca[j] = i;
+                    acumulado[j] = 0.0;
+                    C.columnas[k0 + largo++] = j;
+                }
+                acumulado[j] += a * B.valores[q];
+            }
+        }
+        std::sort(C.columnas.get() + k0, C.columnas.get() + k0 + largo);
+        for (int p = k0; p < k0 + largo; p++) {
+            C.valores[p] = acumulado[C.columnas[p]];
+        }
+    }
+    return C;
+}
+
+Matrix SparseMatrix::toMatrix() const {
+    Matrix densa(rows, cols);
+    for (int i = 0; i < rows; i++) {
+        for (int j = 0; j < cols; j++) densa.at(i, j) = 0.0;
+        for (int k = inicioFila[i]; k < inicioFila[i + 1]; k++) {
+            densa.at(i, columnas[k]) = valores[k];
+        }
+    }
+    return densa;
+}
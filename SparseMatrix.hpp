@@ -0,0 +1,132 @@
+/**
+ * @file SparseMatrix.hpp
+ * @brief Declaración de la clase SparseMatrix para matrices dispersas en formato CSR.
+ *
+ * Los sistemas grandes que provienen de discretizaciones (Poisson, difusión, elasticidad) tienen unas pocas
+ * entradas no nulas por fila. Guardarlos como Matrix cuesta n² valores y cada barrido O(n²) operaciones;
+ * en formato CSR (filas comprimidas) tanto la memoria como cada producto matriz-vector son O(nnz).
+ */
+#ifndef SPARSE_MATRIX_HPP
+#define SPARSE_MATRIX_HPP
+
+#include <memory>
+#include "Matrix.hpp"
+
+/**
+ * @class SparseMatrix
+ * @brief Matriz dispersa en formato CSR (Compressed Sparse Row).
+ *
+ * Las entradas de la fila i ocupan las posiciones [inicioFila[i], inicioFila[i+1]) de los arreglos de columnas
+ * y valores, con las columnas en orden creciente y sin repetir. Todas las operaciones de la clase conservan
+ * ese invariante; quien llene los arreglos directamente con los métodos `datos*` debe respetarlo.
+ */
+class SparseMatrix {
+    private:
+        int rows;
+        int cols;
+        int noCeros;
+        std::unique_ptr<int[]> inicioFila;   // rows + 1 posiciones. //
+        std::unique_ptr<int[]> columnas;     // Columna de cada entrada. //
+        std::unique_ptr<double[]> valores;   // Valor de cada entrada. //
+    public:
+        /**
+        * @brief Crea una matriz dispersa vacía de 0 x 0.
+        */
+        SparseMatrix();
+
+        /**
+        * @brief Reserva una matriz de `r` x `c` con espacio para `nnz` entradas.
+        *
+        * Los arreglos quedan en cero (todas las filas vacías si nnz es 0); se llenan con los métodos `datos*`.
+        *
+        * @throws std::invalid_argument Si alguna dimensión es negativa.
+        */
+        SparseMatrix(int r, int c, int nnz);
+
+        /**
+        * @brief Convierte una matriz densa, descartando las entradas con valor absoluto menor o igual a `tolerancia`.
+        *
+        * La diagonal de una matriz cuadrada se conserva aunque sea cero, para que los métodos iterativos
+        * encuentren siempre su posición.
+        */
+        explicit SparseMatrix(const Matrix& densa, double tolerancia = 0.0);
+
+        SparseMatrix(const SparseMatrix& other);
+        SparseMatrix& operator=(const SparseMatrix& other);
+        SparseMatrix(SparseMatrix&& other) noexcept = default;
+        SparseMatrix& operator=(SparseMatrix&& other) noexcept = default;
+
+        /**
+        * @brief Construye la matriz a partir de tripletes (fila, columna, valor) en cualquier orden.
+        *
+        * Las entradas repetidas se suman.
+        *
+        * @param r Número de filas.
+        * @param c Número de columnas.
+        * @param cantidad Número de tripletes.
+        * @param filasT Fila de cada triplete.
+        * @param columnasT Columna de cada triplete.
+        * @param valoresT Valor de cada triplete.
+        *
+        * @throws std::out_of_range Si algún índice está fuera de la matriz.
+        */
+        static SparseMatrix desdeTripletes(int r, int c, int cantidad, const int* filasT, const int* columnasT, const double* valoresT);
+
+        int getRows() const;
+        int getCols() const;
+        int getNoCeros() const;
+
+        const int* getInicioFila() const;
+        const int* getColumnas() const;
+        const double* getValores() const;
+
+        /**
+        * @brief Punteros para llenar la estructura directamente (ver el invariante de la clase).
+        */
+        int* datosInicioFila();
+        int* datosColumnas();
+        double* datosValores();
+
+        /**
+        * @brief Devuelve el elemento (row, col), cero si no está almacenado (búsqueda binaria en la fila).
+        *
+        * @throws std::out_of_range Si los índices están fuera de rango.
+        */
+        double at(int row, int col) const;
+
+        /**
+        * @brief Calcula y = A·x con arreglos de `cols` y `rows` elementos.
+        */
+        void multiplicar(const double* x, double* y) const;
+
+        /**
+        * @brief Calcula A·x para un vector columna.
+        *
+        * @throws std::invalid_argument Si las dimensiones no son compatibles.
+        */
+        Matrix multiplicar(const Matrix& x) const;
+
+        /**
+        * @brief Copia la diagonal en `d` (min(rows, cols) elementos, cero donde no hay entrada).
+        */
+        void diagonal(double* d) const;
+
+        /**
+        * @brief Devuelve la transpuesta, también en formato CSR.
+        */
+        SparseMatrix transpuesta() const;
+
+        /**
+        * @brief Producto disperso A·B (algoritmo de Gustavson, fila por fila).
+        *
+        * @throws std::invalid_argument Si las dimensiones no son compatibles.
+        */
+        SparseMatrix producto(const SparseMatrix& B) const;
+
+        /**
+        * @brief Convierte a matriz densa.
+        */
+        Matrix toMatrix() const;
+};
+
+#endif
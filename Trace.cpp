@@ -0,0 +1,157 @@
+/**
+ * @file Trace.cpp
+ * @brief Implementación de las trazas en memoria y en archivo y de su presentación legible.
+ *
+ * @section features_sec Características principales
+ * -Búfer circular de eventos de tamaño fijo, sin asignaciones durante la eliminación.
+ * -Escritura de eventos a archivo binario con búfer.
+ * -Reconstrucción de los pasos legibles repitiendo los eventos sobre una copia del sistema.
+ */
+#include "Trace.hpp"
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+#include "Methods.hpp"
+
+TrazaMemoria::TrazaMemoria(int capacidad)
+    : capacidad(capacidad), inicio(0), cantidad(0), perdidos(0) {
+    if (capacidad <= 0) {
+        throw std::invalid_argument("La capacidad de la traza debe ser positiva.");
+    }
+    eventos = std::make_unique<EventoTraza[]>(capacidad);
+}
+
+int TrazaMemoria::capacidadGaussJordan(int size) {
+    // Adelante: un pivote, a lo más un intercambio de filas y uno de columnas y (n - 1 - k) eliminaciones por columna.
+    // Atrás: una normalización y k sustituciones por columna. En total n² + 3n eventos.
+    return size * size + 3 * size + 1;
+}
+
+int TrazaMemoria::getCantidad() const {
+    return cantidad;
+}
+
+int TrazaMemoria::getCapacidad() const {
+    return capacidad;
+}
+
+long long TrazaMemoria::getPerdidos() const {
+    return perdidos;
+}
+
+const EventoTraza& TrazaMemoria::evento(int i) const {
+    if (i < 0 || i >= cantidad) {
+        throw std::out_of_range("Índice de evento fuera de rango.");
+    }
+    int posicion = inicio + i;
+    if (posicion >= capacidad) posicion -= capacidad;
+    return eventos[posicion];
+}
+
+void TrazaMemoria::limpiar() {
+    inicio = 0;
+    cantidad = 0;
+    perdidos = 0;
+}
+
+TrazaArchivoBinario::TrazaArchivoBinario(const char* ruta)
+    : archivo(std::fopen(ruta, "wb")), enBufer(0), bufer(std::make_unique<EventoTraza[]>(TAMANO_BUFER)) {
+    if (archivo == nullptr) {
+        throw std::runtime_error("No se pudo abrir el archivo de la traza.");
+    }
+}
+
+TrazaArchivoBinario::~TrazaArchivoBinario() {
+    // Un destructor no debe lanzar: si la última escritura falla, los eventos pendientes se pierden
+    if (enBufer > 0) {
+        std::fwrite(bufer.get(), sizeof(EventoTraza), enBufer, archivo);
+    }
+    std::fclose(archivo);
+}
+
+void TrazaArchivoBinario::vaciar() {
+    if (enBufer == 0) return;
+    size_t pendientes = static_cast<size_t>(enBufer);
+    size_t escritos = std::fwrite(bufer.get(), sizeof(EventoTraza), pendientes, archivo);
+    enBufer = 0;
+    if (escritos != pendientes) {
+        throw std::runtime_error("No se pudo escribir la traza en el archivo.");
+    }
+}
+
+void cargarTraza(const char* ruta, TrazaMemoria& destino) {
+    std::FILE* archivo = std::fopen(ruta, "rb");
+    if (archivo == nullptr) {
+        throw std::runtime_error("No se pudo abrir el archivo de la traza.");
+    }
+    EventoTraza evento;
+    size_t leidos;
+    while ((leidos = std::fread(&evento, 1, sizeof(EventoTraza), archivo)) == sizeof(EventoTraza)) {
+        destino.registrar(evento.tipo, evento.fila, evento.columna, evento.valor);
+    }
+    std::fclose(archivo);
+    if (leidos != 0) {
+        throw std::runtime_error("El archivo de la traza está truncado.");
+    }
+}
+
+void mostrarTraza(const TrazaMemoria& traza, Matrix& A, Matrix& b) {
+    if (traza.getPerdidos() > 0) {
+        throw std::runtime_error("La traza perdió sus primeros eventos; aumente su capacidad para mostrar los pasos.");
+    }
+    int n = A.getRows();
+    int total = traza.getCantidad();
+    for (int i = 0; i < total; i++) {
+        const EventoTraza& e = traza.evento(i);
+        switch (e.tipo) {
+            case TipoEvento::Pivote:
+                break;
+            case TipoEvento::Intercambio:
+                A.intercambiarFilas(e.fila, e.columna);
+                std::swap(b.at(e.fila, 0), b.at(e.columna, 0));
+                std::cout << "\nIntercambio de fila " << e.fila << " con fila " << e.columna << ":\n";
+                imprimirSistema(A, b);
+                break;
+            case TipoEvento::IntercambioColumnas:
+                for (int row = 0; row < n; row++) {
+                    std::swap(A.at(row, e.fila), A.at(row, e.columna));
+                }
+                std::cout << "\nIntercambio de columna " << e.fila << " con columna " << e.columna
+                          << " (también se intercambian las incógnitas):\n";
+                imprimirSistema(A, b);
+                break;
+            case TipoEvento::Eliminacion:
+                for (int col = e.columna; col < n; col++) {
+                    A.at(e.fila, col) -= e.valor * A.at(e.columna, col);
+                }
+                b.at(e.fila, 0) -= e.valor * b.at(e.columna, 0);
+                std::cout << "\nEliminando fila " << e.fila << " usando fila " << e.columna << " (factor = " << e.valor << "):\n";
+                imprimirSistema(A, b);
+                break;
+            case TipoEvento::Normalizacion: {
+                int column = e.fila;
+                A.at(column, column) = 1.0;
+                b.at(column, 0) /= e.valor;
+                std::cout << "Normalizando fila " << column << ":\n";
+                imprimirSistema(A, b);
+                // Las sustituciones de la columna se muestran juntas, como un solo paso
+                while (i + 1 < total && traza.evento(i + 1).tipo == TipoEvento::Sustitucion
+                       && traza.evento(i + 1).columna == column) {
+                    const EventoTraza& s = traza.evento(++i);
+                    A.at(s.fila, column) = 0.0;
+                    b.at(s.fila, 0) -= s.valor * b.at(column, 0);
+                }
+                for (int row = column + 1; row < n; row++) {
+                    A.at(row, column) = 0.0;
+                }
+                std::cout << "Después de eliminar hacia arriba en columna " << column << ":\n";
+                imprimirSistema(A, b);
+                break;
+            }
+            case TipoEvento::Sustitucion:
+                A.at(e.fila, e.columna) = 0.0;
+                b.at(e.fila, 0) -= e.valor * b.at(e.columna, 0);
+                break;
+        }
+    }
+}
@@ -0,0 +1,170 @@
+/**
+ * @file Trace.hpp
+ * @brief Declaración de las políticas de traza para registrar los pasos de los métodos directos.
+ *
+ * Los núcleos de eliminación reciben la traza como parámetro de plantilla, de modo que la política se
+ * resuelve en tiempo de compilación: con TrazaNula las llamadas a `registrar` desaparecen por completo y
+ * el ciclo interno no contiene ninguna comprobación. Cada paso se registra como un evento compacto (tipo,
+ * fila, columna y valor) y los pasos legibles se reconstruyen después con mostrarTraza, que repite las
+ * operaciones sobre una copia del sistema original.
+ */
+#ifndef TRACE_HPP
+#define TRACE_HPP
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include "Matrix.hpp"
+
+/**
+ * @brief Tipo de operación registrada por los núcleos de eliminación.
+ */
+enum class TipoEvento : std::uint8_t {
+    Pivote,        ///< Pivote elegido para `columna` en la eliminación hacia adelante; `fila` es la fila donde estaba.
+    Intercambio,   ///< Intercambio de las filas `fila` y `columna`.
+    Eliminacion,   ///< Fila `fila` menos `valor` veces la fila del pivote de `columna` (eliminación hacia adelante).
+    Normalizacion, ///< División de la fila `fila` entre su pivote `valor` (eliminación hacia atrás).
+    Sustitucion,   ///< Fila `fila` menos `valor` veces la fila del pivote de `columna` (eliminación hacia atrás).
+    IntercambioColumnas ///< Intercambio de las columnas `fila` y `columna` (pivoteo de torre o completo).
+};
+
+/**
+ * @brief Paso elemental de un método directo.
+ */
+struct EventoTraza {
+    TipoEvento tipo;
+    int fila;
+    int columna;
+    double valor;
+};
+
+/**
+ * @class TrazaNula
+ * @brief Política que descarta todos los eventos; es la que usan los métodos cuando no se piden los pasos.
+ */
+class TrazaNula {
+    public:
+        static constexpr bool activa = false;
+        void registrar(TipoEvento, int, int, double) {}
+};
+
+/**
+ * @class TrazaMemoria
+ * @brief Política que guarda los eventos en un búfer circular de capacidad fija.
+ *
+ * Cuando el búfer se llena se sobrescriben los eventos más antiguos y se cuentan como perdidos.
+ */
+class TrazaMemoria {
+    private:
+        int capacidad;
+        int inicio;
+        int cantidad;
+        long long perdidos;
+        std::unique_ptr<EventoTraza[]> eventos;
+    public:
+        static constexpr bool activa = true;
+
+        /**
+        * @brief Crea un búfer para `capacidad` eventos.
+        *
+        * @throws std::invalid_argument Si la capacidad no es positiva.
+        */
+        explicit TrazaMemoria(int capacidad);
+
+        /**
+        * @brief Capacidad suficiente para registrar Gauss-Jordan completo de un sistema de `size` ecuaciones.
+        */
+        static int capacidadGaussJordan(int size);
+
+        void registrar(TipoEvento tipo, int fila, int columna, double valor) {
+            int posicion = inicio + cantidad;
+            if (posicion >= capacidad) posicion -= capacidad;
+            eventos[posicion] = EventoTraza{tipo, fila, columna, valor};
+            if (cantidad < capacidad) {
+                cantidad++;
+            } else {
+                inicio = inicio + 1 == capacidad ? 0 : inicio + 1;
+                perdidos++;
+            }
+        }
+
+        int getCantidad() const;
+        int getCapacidad() const;
+        long long getPerdidos() const;
+
+        /**
+        * @brief Devuelve el evento `i`, contando desde el más antiguo que se conserva.
+        *
+        * @throws std::out_of_range Si el índice no es válido.
+        */
+        const EventoTraza& evento(int i) const;
+
+        /**
+        * @brief Descarta todos los eventos.
+        */
+        void limpiar();
+};
+
+/**
+ * @class TrazaArchivoBinario
+ * @brief Política que escribe los eventos en un archivo binario a través de un búfer interno.
+ *
+ * El archivo contiene los EventoTraza en el orden en que ocurrieron y puede leerse con cargarTraza.
+ */
+class TrazaArchivoBinario {
+    private:
+        static constexpr int TAMANO_BUFER = 512;
+        std::FILE* archivo;
+        int enBufer;
+        std::unique_ptr<EventoTraza[]> bufer;
+    public:
+        static constexpr bool activa = true;
+
+        /**
+        * @brief Abre (o trunca) el archivo de la traza.
+        *
+        * @throws std::runtime_error Si el archivo no puede abrirse.
+        */
+        explicit TrazaArchivoBinario(const char* ruta);
+        ~TrazaArchivoBinario();
+        TrazaArchivoBinario(const TrazaArchivoBinario&) = delete;
+        TrazaArchivoBinario& operator=(const TrazaArchivoBinario&) = delete;
+
+        void registrar(TipoEvento tipo, int fila, int columna, double valor) {
+            bufer[enBufer++] = EventoTraza{tipo, fila, columna, valor};
+            if (enBufer == TAMANO_BUFER) vaciar();
+        }
+
+        /**
+        * @brief Escribe en el archivo los eventos pendientes del búfer.
+        *
+        * @throws std::runtime_error Si la escritura falla.
+        */
+        void vaciar();
+};
+
+/**
+ * @brief Lee una traza escrita por TrazaArchivoBinario.
+ *
+ * @param ruta Archivo de la traza.
+ * @param destino Traza en memoria donde se agregan los eventos leídos.
+ *
+ * @throws std::runtime_error Si el archivo no puede abrirse o está truncado.
+ */
+void cargarTraza(const char* ruta, TrazaMemoria& destino);
+
+/**
+ * @brief Muestra los pasos legibles de una eliminación a partir de su traza.
+ *
+ * Repite sobre A y b cada operación registrada e imprime el sistema después de cada paso, con los mismos
+ * mensajes que mostraban antes forwardElimination y backwardElimination.
+ *
+ * @param traza Eventos de la eliminación, completos y desde el primer paso.
+ * @param A Copia de la matriz de coeficientes tal como estaba antes del primer evento (modificada).
+ * @param b Copia del vector de términos independientes tal como estaba antes del primer evento (modificado).
+ *
+ * @throws std::runtime_error Si la traza perdió eventos.
+ */
+void mostrarTraza(const TrazaMemoria& traza, Matrix& A, Matrix& b);
+
+#endif
@@ -5,6 +5,10 @@
  * Permite al usuario resolver sistemas de ecuaciones lineales utilizando los métodos de:
  * - Eliminación de Gauss
  * - Eliminación de Gauss-Jordan
+ * - Iteración de Jacobi
+ * - Iteración de Gauss-Seidel
+ * - Selección automática del método a partir del análisis de la matriz
+ * - Generación de problemas de prueba y medición del rendimiento de los métodos, junto con la topología NUMA de la máquina
  * 
  * El usuario puede:
  * - Ingresar el tamaño del sistema
@@ -21,9 +25,15 @@
 #include "Methods.hpp"
 #include <iostream>
 #include <iomanip>
+#include <cstdint>
+#include <exception>
 #include "menu.hpp"
 #include "validations.hpp"
 #include "String.hpp"
+#include "Analysis.hpp"
+#include "Generators.hpp"
+#include "Benchmark.hpp"
+#include "Numa.hpp"
 
 void menuPrincipal(){
     int opcion {0};
@@ -41,13 +51,17 @@ void menuPrincipal(){
         std::cout << "2. Método de Gauss-Jordan\n";
         std::cout << "3. Método de Jacobi\n";
         std::cout << "4. Método de Gauss-Seidel\n";
-        std::cout << "5. Salir\n";
+        std::cout << "5. Selección automática del método\n";
+        std::cout << "6. Generar un problema de prueba y medir los métodos\n";
+        std::cout << "7. Salir\n";
         std::cout << "\nNotas:\n";
         std::cout << "- Los métodos de Gauss y Gauss-Jordan son generalmente más rápidos para sistemas pequeños y medianos.\n";
         std::cout << "- El método de Jacobi es más adecuado para sistemas grandes y puede ser más lento, pero es más robusto en términos de convergencia.\n";
         std::cout << "- El método de Gauss-Seidel es una mejora del método de Jacobi y puede converger más rápido en algunos casos, pero también requiere que la matriz sea diagonal dominante.\n";
         std::cout << "- Si el sistema es grande, se recomienda usar Jacobi o Gauss-Seidel para evitar problemas de memoria.\n";
         std::cout << "- Los métodos de Gauss y Gauss-Jordan pueden ser menos adecuados para equipos de bajos recursos con sistemas muy grandes debido a su mayor consumo de memoria.\n";
+        std::cout << "- Si no está seguro, la selección automática analiza la matriz y elige el método por usted.\n";
+        std::cout << "- Los problemas de prueba se generan sin capturar la matriz, para medir los métodos con sistemas grandes.\n";
         opcion = leerEntero(String("Su elección: "));
         std::cout << "Entrada registrada como " << opcion << " (cualquier parte decimal fue ignorada en caso de haber sido ingresada).\n";
 
@@ -117,7 +131,62 @@ void menuPrincipal(){
             solution.print();
             break;
         }
-        case 5: 
+        case 5: {
+            size = leerEntero(String("Ingrese el tamaño de la matriz: "));
+            std::cout << "Entrada registrada como " << size << " (cualquier parte decimal fue ignorada en caso de haber sido ingresada).\n";
+            Matrix A(size, size);
+            Matrix b (size, 1);
+            std::cout << "Ingrese la matriz A:\n";
+            A.fillMatrix();
+            std::cout << "Ingrese el vector b:\n";
+            b.fillMatrix();
+            String motivo;
+            Matrix solution = resolverAutomatico(A, b, 1e-6, 500, motivo);
+            std::cout << "Método elegido: ";
+            motivo.print();
+            std::cout << "\nSolución:\n";
+            solution.print();
+            break;
+        }
+        case 6: {
+            std::cout << "Tipo de problema:\n";
+            std::cout << "1. Poisson 1D\n2. Poisson 2D\n3. Poisson 3D\n4. Dispersa con diagonal dominante\n";
+            std::cout << "5. Dispersa simétrica definida positiva\n6. De banda\n7. Hilbert (densa)\n8. Mal condicionada (densa)\n";
+            int tipo = leerEntero(String("Su elección: "));
+            if (tipo < 1 || tipo > 8) {
+                std::cout << "Opción inválida.\n";
+                break;
+            }
+            size = leerEntero(String("Ingrese el número de incógnitas: "));
+            int semilla = leerEntero(String("Ingrese la semilla del generador: "));
+            bool guardar = leerBooleano(String("¿Desea guardar los resultados en benchmark.json? (Y:1/N:0)\n"));
+            try {
+                ProblemaPrueba problema = generarProblema(static_cast<TipoProblema>(tipo - 1), size, static_cast<std::uint64_t>(semilla));
+                OpcionesIterativas opciones;
+                opciones.tolerancia = 1e-8;
+                opciones.criterio = CriterioParada::ResiduoRelativo;
+                opciones.maxIter = 10000;
+                MedicionMetodo mediciones[CANTIDAD_METODOS_MEDIDOS];
+                int cantidad = 0;
+                for (int k = 0; k < CANTIDAD_METODOS_MEDIDOS; k++) {
+                    MetodoMedido metodo = static_cast<MetodoMedido>(k);
+                    if (metodoAplicable(problema, metodo)) {
+                        mediciones[cantidad++] = medirMetodo(problema, metodo, opciones);
+                    }
+                }
+                // Los tiempos dependen de cómo se reparten los núcleos y la memoria de la máquina
+                topologiaSistema().imprimir();
+                imprimirMediciones(problema, mediciones, cantidad);
+                if (guardar) {
+                    guardarMedicionesJSON("benchmark.json", problema, static_cast<std::uint64_t>(semilla), mediciones, cantidad);
+                    std::cout << "Resultados guardados en benchmark.json\n";
+                }
+            } catch (const std::exception& e) {
+                std::cout << "Error: " << e.what() << "\n";
+            }
+            break;
+        }
+        case 7: 
             continuar = false;
             std::cout << "Gracias por usar el programa. ¡Hasta luego!\n";
             break;
@@ -0,0 +1,142 @@
+/**
+ * @file test_interrupcion.cpp
+ * @brief Pruebas de la interrupción de los métodos por su control de ejecución.
+ *
+ * Compilar desde la raíz del repositorio:
+ *     g++ -std=c++17 -pthread -I. tests/test_interrupcion.cpp $(ls *.cpp | grep -v main.cpp) -o test_interrupcion
+ * El programa termina con código distinto de cero si alguna prueba falla.
+ */
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+#include "BatchSolver.hpp"
+#include "DomainDecomposition.hpp"
+#include "ExecutionControl.hpp"
+#include "Generators.hpp"
+#include "IterativeOptions.hpp"
+#include "Krylov.hpp"
+
+namespace {
+
+int fallas = 0;
+
+void comprobar(bool condicion, const char* descripcion) {
+    std::cout << (condicion ? "[ OK ] " : "[FALLA] ") << descripcion << "\n";
+    if (!condicion) fallas++;
+}
+
+/**
+ * @brief Cancela la solución desde el quinto aviso de progreso.
+ */
+void cancelarEnQuintoAviso(ControlEjecucion& control, int& avisos) {
+    control.fijarProgreso([&control, &avisos](const ProgresoSolucion&) {
+        if (++avisos == 5) control.cancelar();
+    });
+}
+
+void pruebaBicgstabCancelado() {
+    SparseMatrix A = poisson1D(2000);
+    Matrix b = A.multiplicar(vectorAleatorio(2000, 1));
+    EstadisticasIterativas estadisticas;
+    OpcionesIterativas opciones;
+    opciones.tolerancia = 1e-14;
+    opciones.criterio = CriterioParada::ResiduoRelativo;
+    opciones.maxIter = 3000;
+    opciones.estadisticas = &estadisticas;
+
+    ControlEjecucion control;
+    int avisos = 0;
+    cancelarEnQuintoAviso(control, avisos);
+    SesionControl sesion(&control);
+    bool lanzo = false;
+    int filas = 0;
+    try {
+        filas = bicgstab(A, b, opciones).getRows();
+    } catch (const std::runtime_error&) {
+        lanzo = true;
+    }
+    comprobar(!lanzo, "BiCGSTAB cancelado no lanza excepción");
+    comprobar(filas == 2000, "BiCGSTAB cancelado devuelve su iteración");
+    comprobar(estadisticas.motivo == MotivoParada::Cancelacion, "BiCGSTAB cancelado informa el motivo Cancelacion");
+    comprobar(estadisticas.iteraciones == 5 && avisos == 5, "BiCGSTAB se detiene en la iteración de la cancelación");
+}
+
+void pruebaGradienteConjugadoCancelado() {
+    SparseMatrix A = poisson1D(2000);
+    Matrix b = A.multiplicar(vectorAleatorio(2000, 2));
+    EstadisticasIterativas estadisticas;
+    OpcionesIterativas opciones;
+    opciones.tolerancia = 1e-14;
+    opciones.criterio = CriterioParada::ResiduoRelativo;
+    opciones.maxIter = 3000;
+    opciones.estadisticas = &estadisticas;
+
+    ControlEjecucion control;
+    int avisos = 0;
+    cancelarEnQuintoAviso(control, avisos);
+    SesionControl sesion(&control);
+    gradienteConjugado(A, b, opciones);
+    comprobar(estadisticas.motivo == MotivoParada::Cancelacion && estadisticas.iteraciones == 5,
+              "El gradiente conjugado cancelado se detiene con el motivo Cancelacion");
+}
+
+void pruebaDominiosCancelados() {
+    SparseMatrix A = poisson2D(60, 60);
+    Matrix b = A.multiplicar(vectorAleatorio(3600, 3));
+    EstadisticasIterativas estadisticas;
+    OpcionesIterativas opciones;
+    opciones.tolerancia = 1e-14;
+    opciones.criterio = CriterioParada::ResiduoRelativo;
+    opciones.maxIter = 100000000;
+    opciones.estadisticas = &estadisticas;
+
+    ControlEjecucion control;
+    control.fijarPresupuesto(0.2);
+    SesionControl sesion(&control);
+    bool lanzo = false;
+    double menor = 0.0;
+    try {
+        Matrix x = resolverPorDominios(A, b, opciones, 3);
+        menor = std::abs(x.at(0, 0));
+        for (int i = 0; i < x.getRows(); i++) menor = std::min(menor, std::abs(x.at(i, 0)));
+    } catch (const std::runtime_error&) {
+        lanzo = true;
+    }
+    comprobar(!lanzo, "La descomposición del dominio con plazo vencido no lanza excepción");
+    comprobar(menor > 0.0, "La descomposición del dominio devuelve la iteración de todos los procesos");
+    comprobar(estadisticas.motivo == MotivoParada::PlazoVencido && estadisticas.iteraciones > 0,
+              "La descomposición del dominio informa el motivo PlazoVencido");
+}
+
+void pruebaLoteCancelado() {
+    LoteSistemas lote(40, 64, 2);
+    for (int k = 0; k < 64; k++) {
+        for (int i = 0; i < 40; i++) {
+            lote.coeficiente(k, i, i) = 4.0;
+            lote.termino(k, i) = 1.0;
+        }
+    }
+    ControlEjecucion control;
+    control.cancelar();
+    SesionControl sesion(&control);
+    bool lanzo = false;
+    try {
+        gaussEliminationLote(lote, 2);
+    } catch (const std::runtime_error&) {
+        lanzo = true;
+    }
+    comprobar(lanzo && control.getInterrupcion() == EstadoEjecucion::Cancelada,
+              "El Gauss por lotes cancelado se interrumpe");
+}
+
+} // namespace
+
+int main() {
+    pruebaBicgstabCancelado();
+    pruebaGradienteConjugadoCancelado();
+    pruebaDominiosCancelados();
+    pruebaLoteCancelado();
+    std::cout << (fallas == 0 ? "Todas las pruebas pasaron.\n" : "Hubo pruebas fallidas.\n");
+    return fallas == 0 ? 0 : 1;
+}
@@ -10,73 +10,213 @@
 #include <cmath>
 #include <iostream>
 #include <iomanip>
+#include <algorithm>
+#include <utility>
 #include "Methods.hpp"
 #include "String.hpp"
+#include "utils.hpp"
+#include "Trace.hpp"
+#include "LinearOperator.hpp"
+#include "PerfCounters.hpp"
+#include "ExecutionControl.hpp"
+#include <complex>
+#include <memory>
+#include <type_traits>
 
+namespace {
 
 /**
- * @brief Realiza la eliminación hacia adelante (triangulación) del sistema Ax = b.
+ * @brief Valor que se registra en la traza: el número real o el módulo de un complejo.
+ */
+template<typename T>
+double valorTraza(T valor) {
+    return static_cast<double>(valor);
+}
+
+template<typename R>
+double valorTraza(std::complex<R> valor) {
+    return static_cast<double>(std::abs(valor));
+}
+
+/**
+ * @brief Operaciones de la eliminación hacia adelante de un sistema de n ecuaciones (incluido b).
+ *
+ * En la columna c cada una de las n-c-1 filas de abajo hace una división, n-c multiplicaciones y restas en A
+ * y una en b.
+ */
+double operacionesEliminacion(int n) {
+    double total = 0.0;
+    for (int c = 0; c < n; c++) total += (n - c - 1.0) * (2.0 * (n - c) + 3.0);
+    return total;
+}
+
+/**
+ * @brief Fila del elemento de mayor valor absoluto de la columna `col`, desde la fila `desde`.
+ */
+template<typename T>
+int filaMaxima(const BasicMatrix<T>& A, int col, int desde) {
+    int maxRow = desde;
+    double maximo = std::abs(A.at(desde, col));
+    for (int row = desde + 1; row < A.getRows(); row++) {
+        double valor = std::abs(A.at(row, col));
+        if (valor > maximo) {
+            maximo = valor;
+            maxRow = row;
+        }
+    }
+    return maxRow;
+}
+
+/**
+ * @brief Columna del elemento de mayor valor absoluto de la fila `row`, desde la columna `desde`.
+ */
+template<typename T>
+int columnaMaxima(const BasicMatrix<T>& A, int row, int desde) {
+    const T* fila = &A.at(row, 0);
+    int maxCol = desde;
+    double maximo = std::abs(fila[desde]);
+    for (int col = desde + 1; col < A.getCols(); col++) {
+        double valor = std::abs(fila[col]);
+        if (valor > maximo) {
+            maximo = valor;
+            maxCol = col;
+        }
+    }
+    return maxCol;
+}
+
+/**
+ * @brief Elige el pivote del paso `column` en la submatriz [column, n) x [column, n).
+ *
+ * En caso de empate se queda con el primero encontrado, de modo que el pivoteo parcial elige las mismas
+ * filas que antes.
+ */
+template<typename T>
+void elegirPivote(const BasicMatrix<T>& A, int column, EstrategiaPivoteo estrategia, int& filaPivote, int& columnaPivote) {
+    int n = A.getRows();
+    filaPivote = column;
+    columnaPivote = column;
+    switch (estrategia) {
+    case EstrategiaPivoteo::SinPivoteo:
+        return;
+    case EstrategiaPivoteo::Parcial:
+        filaPivote = filaMaxima(A, column, column);
+        return;
+    case EstrategiaPivoteo::Torre: {
+        // Se alterna entre la columna y la fila del candidato hasta que sea máximo en ambas;
+        // el valor crece en cada cambio, así que la búsqueda termina
+        filaPivote = filaMaxima(A, column, column);
+        double maximo = std::abs(A.at(filaPivote, column));
+        while (true) {
+            int col = columnaMaxima(A, filaPivote, column);
+            if (std::abs(A.at(filaPivote, col)) <= maximo) break;
+            columnaPivote = col;
+            maximo = std::abs(A.at(filaPivote, col));
+            int row = filaMaxima(A, columnaPivote, column);
+            if (std::abs(A.at(row, columnaPivote)) <= maximo) break;
+            filaPivote = row;
+            maximo = std::abs(A.at(row, columnaPivote));
+        }
+        return;
+    }
+    case EstrategiaPivoteo::Completo: {
+        double maximo = -1.0;
+        for (int row = column; row < n; row++) {
+            int col = columnaMaxima(A, row, column);
+            double valor = std::abs(A.at(row, col));
+            if (valor > maximo) {
+                maximo = valor;
+                filaPivote = row;
+                columnaPivote = col;
+            }
+        }
+        return;
+    }
+    }
+}
+
+} // namespace
+
+bool pivoteaColumnas(EstrategiaPivoteo estrategia) {
+    return estrategia == EstrategiaPivoteo::Torre || estrategia == EstrategiaPivoteo::Completo;
+}
+
+
+/**
+ * @brief Núcleo de la eliminación hacia adelante (triangulación) del sistema Ax = b.
  *
  * Esta función aplica el método de eliminación de Gauss para convertir la matriz A
  * en una forma triangular superior, modificando también el vector columna b.
- * Detecta sistemas inconsistentes o numéricamente inestables.
+ * Detecta sistemas inconsistentes o numéricamente inestables. Cada pivote, intercambio y
+ * eliminación de fila se registra en `traza`.
  *
  * @param A Matriz de coeficientes (modificada en el proceso).
  * @param b Vector columna de términos independientes (modificado en el proceso).
- * @param mostrarPasos Si es verdadero, imprime cada paso si el sistema es pequeño (≤ 10 ecuaciones).
+ * @param traza Política de traza que recibe los pasos.
+ * @param estrategia Forma de elegir los pivotes.
+ * @param columnas Recibe la permutación de columnas (puede ser nulo si la estrategia no intercambia columnas).
  *
  * @throws std::runtime_error Si el sistema es numéricamente inestable o inconsistente.
+ * @throws std::invalid_argument Si la estrategia intercambia columnas y `columnas` es nulo.
  */
-void forwardElimination(Matrix& A, Matrix& b, bool mostrarPasos) {
+template<typename T, typename Traza>
+void forwardElimination(BasicMatrix<T>& A, BasicMatrix<T>& b, Traza& traza, EstrategiaPivoteo estrategia, int* columnas) {
     int numEcuations = A.getRows();
-    bool mostrar = mostrarPasos && numEcuations <= 10;
     const double TOLERANCIA = 1e-12;
+    if (pivoteaColumnas(estrategia) && columnas == nullptr) {
+        throw std::invalid_argument("El pivoteo de torre y el completo requieren un arreglo para la permutación de columnas.");
+    }
+    if (columnas != nullptr) {
+        for (int k = 0; k < numEcuations; k++) columnas[k] = k;
+    }
+    RegionRendimiento region(RegionMedida::Eliminacion, operacionesEliminacion(numEcuations));
 
     for (int column = 0; column < numEcuations; column++) {
-        // 1. Encontrar fila con el mayor pivote
-        int maxRow = column; //Al inicio la fila con el pivote máximo será la primera ingresada por el usuario
-        //Recorremos cada fila para ver si hay una fila con pivote mayor
-        for (int row = column + 1; row < numEcuations; row++) {
-            //Si encontramos una fila con un pivote mayor, esa fila será la nueva fila con el pivote máximo
-            if (std::abs(A.at(row, column)) > std::abs(A.at(maxRow, column))) {
-                maxRow = row;
-            }
-        }
+        verificarInterrupcion(RegionMedida::Eliminacion, column, numEcuations);
+        // 1. Elegir el pivote según la estrategia
+        int filaPivote = column;
+        int columnaPivote = column;
+        elegirPivote(A, column, estrategia, filaPivote, columnaPivote);
 
         // 2. Verificar si hay solución
-        if (std::abs(A.at(maxRow, column)) < TOLERANCIA) {
+        double magnitud = std::abs(A.at(filaPivote, columnaPivote));
+        if (magnitud < TOLERANCIA) {
+            if (estrategia == EstrategiaPivoteo::SinPivoteo) {
+                throw std::runtime_error("Pivote nulo sin pivoteo: la matriz no es diagonal dominante, use pivoteo parcial.");
+            }
             throw std::runtime_error("El sistema es numéricamente inestable o no tiene solución única.");
         }
+        traza.registrar(TipoEvento::Pivote, filaPivote, column, valorTraza(A.at(filaPivote, columnaPivote)));
 
-        // 3. Intercambiar filas en A y b si es necesario
-        if (maxRow != column) {
-            //Este ciclo intercambia los valores de las filas posición por posición, no toda la fila de golpe.
-            for (int col = 0; col < numEcuations; col++) {
-                std::swap(A.at(column, col), A.at(maxRow, col));
-            }
+        // 3. Intercambiar filas (solo sus punteros) y, con pivoteo de torre o completo, columnas
+        if (filaPivote != column) {
+            A.intercambiarFilas(column, filaPivote);
             //Al ser una matriz de una dimensión solo es necesario intecambiar un valor
-            std::swap(b.at(column, 0), b.at(maxRow, 0));
-            if (mostrar) {
-                std::cout << "\nIntercambio de fila " << column << " con fila " << maxRow << ":\n";
-                imprimirSistema(A, b);
+            std::swap(b.at(column, 0), b.at(filaPivote, 0));
+            traza.registrar(TipoEvento::Intercambio, column, filaPivote, 0.0);
+        }
+        if (columnaPivote != column) {
+            for (int row = 0; row < numEcuations; row++) {
+                T* fila = &A.at(row, 0);
+                std::swap(fila[column], fila[columnaPivote]);
             }
+            std::swap(columnas[column], columnas[columnaPivote]);
+            traza.registrar(TipoEvento::IntercambioColumnas, column, columnaPivote, 0.0);
         }
 
         // 4. Eliminar hacia abajo
+        const T* filaActual = &A.at(column, 0);
         //El ciclo inicia para modificar la segunda fila
         for (int row = column + 1; row < numEcuations; row++) {
+            T* fila = &A.at(row, 0);
             //Se calcula el factor que al multiplicarlo por la fila anterior y restarlo de la entrada correspondiente transforma en 0 la entrada correspondiente
-            double factor = A.at(row, column) / A.at(column, column);
+            T factor = fila[column] / filaActual[column];
             for (int col = column; col < numEcuations; col++) {
-                A.at(row, col) -= factor * A.at(column, col);
+                fila[col] -= factor * filaActual[col];
             }
             //Al ser una matriz de una dimensión solo es necesario modificar un valor
             b.at(row, 0) -= factor * b.at(column, 0);
-
-            if (mostrar) {
-                std::cout << "\nEliminando fila " << row << " usando fila " << column << " (factor = " << factor << "):\n";
-                imprimirSistema(A, b);
-            }
+            traza.registrar(TipoEvento::Eliminacion, row, column, valorTraza(factor));
         }
     }
     // 5. Verificación de filas nulas para detectar inconsistencia
@@ -94,59 +234,142 @@ void forwardElimination(Matrix& A, Matrix& b, bool mostrarPasos) {
     }
 }
 
-
 /**
- * @brief Realiza la eliminación hacia atrás y normalización de pivotes en la matriz A.
+ * @brief Núcleo de la eliminación hacia atrás y normalización de pivotes en la matriz A.
  *
- * Esta función convierte A en una matriz identidad (forma reducida por filas) mediante
- * eliminación hacia atrás y normalización de pivotes. Es el paso final del método de Gauss-Jordan.
+ * Parte de la matriz triangular superior que deja forwardElimination y recorre los pivotes de abajo
+ * hacia arriba: al llegar a la columna `column` las entradas a la derecha de su pivote ya son cero,
+ * así que cada fila solo cambia en la columna del pivote y en b (O(n²) en total en lugar de O(n³)).
+ * Cada normalización y sustitución se registra en `traza`.
  *
  * @param A Matriz de coeficientes (modificada).
  * @param b Vector columna de términos independientes (modificado).
- * @param mostrarPasos Si es verdadero, imprime los pasos si el sistema es pequeño.
+ * @param traza Política de traza que recibe los pasos.
  *
  * @throws std::runtime_error Si se detectan pivotes demasiado pequeños o inconsistencias numéricas.
  */
-void backwardElimination(Matrix& A, Matrix& b, bool mostrarPasos){
-    //Eliminar hacia atrás
+template<typename T, typename Traza>
+void backwardElimination(BasicMatrix<T>& A, BasicMatrix<T>& b, Traza& traza) {
     int numEcuations = A.getRows();
-    bool mostrar = mostrarPasos && numEcuations <= 10;
     const double TOLERANCIA = 1e-12;
+    // Una división por pivote y una multiplicación y resta por cada elemento sobre él
+    RegionRendimiento region(RegionMedida::Sustitucion, static_cast<double>(numEcuations) * numEcuations);
 
-    //El ciclo inicia para modificar la última fila
+    //El ciclo inicia en la última fila, cuyo pivote es la única entrada no nula
     for (int column = numEcuations - 1; column >= 0; column--) {
+        // Normalización del pivote (hacerlo 1)
+        T pivot = A.at(column, column);
+        if (std::abs(pivot) < TOLERANCIA) {
+            throw std::runtime_error("Pivote demasiado pequeño, posible sistema incompatible o mal condicionado.");
+        }
+        A.at(column, column) = T(1);
+        b.at(column, 0) /= pivot;
+        traza.registrar(TipoEvento::Normalizacion, column, column, valorTraza(pivot));
+
+        // Eliminar hacia arriba: solo cambian la columna del pivote y el valor correspondiente de b
         for (int row = column - 1; row >= 0; row--) {
-            double factor = A.at(row, column) / A.at(column, column);
-            for (int col = 0; col < numEcuations; col++) {
-                A.at(row, col) -= factor * A.at(column, col); //Se usa toda la fila 'column'
-            }
-            b.at(row, 0) -= factor * b.at(column, 0); //Se usa el valor correspondiente de b
+            T factor = A.at(row, column);
+            A.at(row, column) = T(0);
+            b.at(row, 0) -= factor * b.at(column, 0);
+            traza.registrar(TipoEvento::Sustitucion, row, column, valorTraza(factor));
+        }
+        //Bajo el pivote solo quedan residuos de redondeo de la eliminación hacia adelante
+        for (int row = column + 1; row < numEcuations; row++) {
+            A.at(row, column) = T(0);
         }
-        if (mostrarPasos) {
-            std::cout << "Después de eliminar hacia arriba en columna " << column << ":\n";
-            imprimirSistema(A, b);
     }
+}
 
-    // Normalización de pivotes (hacerlos 1)
-    for (int rows = 0; rows < numEcuations; rows++) {
-        double pivot = A.at(rows, rows);
-        if (std::abs(pivot) < TOLERANCIA) {
-            throw std::runtime_error("Pivote demasiado pequeño, posible sistema incompatible o mal condicionado.");
-        }
-        if (std::abs(pivot - 1.0) > TOLERANCIA) {
-            for (int col = 0; col < numEcuations; col++) {
-                A.at(rows, col) /= pivot;
+template void forwardElimination(Matrix&, Matrix&, TrazaNula&, EstrategiaPivoteo, int*);
+template void forwardElimination(Matrix&, Matrix&, TrazaMemoria&, EstrategiaPivoteo, int*);
+template void forwardElimination(Matrix&, Matrix&, TrazaArchivoBinario&, EstrategiaPivoteo, int*);
+template void backwardElimination(Matrix&, Matrix&, TrazaNula&);
+template void backwardElimination(Matrix&, Matrix&, TrazaMemoria&);
+template void backwardElimination(Matrix&, Matrix&, TrazaArchivoBinario&);
+template void forwardElimination(BasicMatrix<float>&, BasicMatrix<float>&, TrazaNula&, EstrategiaPivoteo, int*);
+template void forwardElimination(BasicMatrix<std::complex<float>>&, BasicMatrix<std::complex<float>>&, TrazaNula&, EstrategiaPivoteo, int*);
+template void forwardElimination(BasicMatrix<std::complex<double>>&, BasicMatrix<std::complex<double>>&, TrazaNula&, EstrategiaPivoteo, int*);
+template void backwardElimination(BasicMatrix<float>&, BasicMatrix<float>&, TrazaNula&);
+template void backwardElimination(BasicMatrix<std::complex<float>>&, BasicMatrix<std::complex<float>>&, TrazaNula&);
+template void backwardElimination(BasicMatrix<std::complex<double>>&, BasicMatrix<std::complex<double>>&, TrazaNula&);
+
+/**
+ * @brief Realiza la eliminación hacia adelante (triangulación) del sistema Ax = b.
+ *
+ * Sin pasos usa el núcleo con TrazaNula. Con pasos (y a lo más 10 ecuaciones) registra la eliminación
+ * en memoria y al terminar muestra los pasos reconstruidos a partir de una copia del sistema original.
+ * Los pasos solo se muestran con elementos double.
+ *
+ * @param A Matriz de coeficientes (modificada en el proceso).
+ * @param b Vector columna de términos independientes (modificado en el proceso).
+ * @param mostrarPasos Si es verdadero, imprime cada paso si el sistema es pequeño (≤ 10 ecuaciones).
+ * @param estrategia Forma de elegir los pivotes.
+ * @param columnas Recibe la permutación de columnas (puede ser nulo si la estrategia no intercambia columnas).
+ *
+ * @throws std::runtime_error Si el sistema es numéricamente inestable o inconsistente.
+ */
+template<typename T>
+void forwardElimination(BasicMatrix<T>& A, BasicMatrix<T>& b, bool mostrarPasos, EstrategiaPivoteo estrategia, int* columnas) {
+    if constexpr (std::is_same<T, double>::value) {
+        if (mostrarPasos && A.getRows() <= 10) {
+            Matrix copiaA(A), copiaB(b);
+            TrazaMemoria traza(TrazaMemoria::capacidadGaussJordan(A.getRows()));
+            try {
+                forwardElimination(A, b, traza, estrategia, columnas);
+            } catch (...) {
+                // Se muestran los pasos que alcanzaron a realizarse antes del error
+                mostrarTraza(traza, copiaA, copiaB);
+                throw;
             }
-            b.at(rows, 0) /= pivot;
-        }
-        if (mostrarPasos) {
-            std::cout << "Normalizando fila " << rows << ":\n";
-            imprimirSistema(A, b);
+            mostrarTraza(traza, copiaA, copiaB);
+            return;
         }
+    }
+    TrazaNula traza;
+    forwardElimination(A, b, traza, estrategia, columnas);
+}
+
+/**
+ * @brief Realiza la eliminación hacia atrás y normalización de pivotes en la matriz A.
+ *
+ * Esta función convierte A en una matriz identidad (forma reducida por filas) mediante
+ * eliminación hacia atrás y normalización de pivotes. Es el paso final del método de Gauss-Jordan.
+ *
+ * @param A Matriz de coeficientes (modificada).
+ * @param b Vector columna de términos independientes (modificado).
+ * @param mostrarPasos Si es verdadero, imprime los pasos si el sistema es pequeño.
+ *
+ * @throws std::runtime_error Si se detectan pivotes demasiado pequeños o inconsistencias numéricas.
+ */
+template<typename T>
+void backwardElimination(BasicMatrix<T>& A, BasicMatrix<T>& b, bool mostrarPasos){
+    if constexpr (std::is_same<T, double>::value) {
+        if (mostrarPasos && A.getRows() <= 10) {
+            Matrix copiaA(A), copiaB(b);
+            TrazaMemoria traza(TrazaMemoria::capacidadGaussJordan(A.getRows()));
+            try {
+                backwardElimination(A, b, traza);
+            } catch (...) {
+                mostrarTraza(traza, copiaA, copiaB);
+                throw;
+            }
+            mostrarTraza(traza, copiaA, copiaB);
+            return;
         }
     }
+    TrazaNula traza;
+    backwardElimination(A, b, traza);
 }
 
+template void forwardElimination(BasicMatrix<float>&, BasicMatrix<float>&, bool, EstrategiaPivoteo, int*);
+template void forwardElimination(Matrix&, Matrix&, bool, EstrategiaPivoteo, int*);
+template void forwardElimination(BasicMatrix<std::complex<float>>&, BasicMatrix<std::complex<float>>&, bool, EstrategiaPivoteo, int*);
+template void forwardElimination(BasicMatrix<std::complex<double>>&, BasicMatrix<std::complex<double>>&, bool, EstrategiaPivoteo, int*);
+template void backwardElimination(BasicMatrix<float>&, BasicMatrix<float>&, bool);
+template void backwardElimination(Matrix&, Matrix&, bool);
+template void backwardElimination(BasicMatrix<std::complex<float>>&, BasicMatrix<std::complex<float>>&, bool);
+template void backwardElimination(BasicMatrix<std::complex<double>>&, BasicMatrix<std::complex<double>>&, bool);
+
 /**
  * @brief Método iterativo generalizado para Jacobi y Gauss-Seidel.
  * Este método permite resolver sistemas de ecuaciones lineales utilizando
@@ -160,37 +383,597 @@ void backwardElimination(Matrix& A, Matrix& b, bool mostrarPasos){
  * @return Matrix Vector solución del sistema.
  */
 Matrix metodoIterativoGeneral(Matrix& A, Matrix& b, double tolerancia, int maxIter, bool usarValoresActuales) {
+    OpcionesIterativas opciones;
+    opciones.tolerancia = tolerancia;
+    opciones.maxIter = maxIter;
+    return metodoIterativoGeneral(A, b, opciones, usarValoresActuales);
+}
+
+ControlParada::ControlParada(const OpcionesIterativas& opciones, double normaB)
+    : opciones(opciones), normaB(normaB), medidaPrevia(INFINITY), mejorMedida(INFINITY),
+      crecimientos(0), sinMejora(0), iteraciones(0), detenidoPorControl(false) {}
+
+ControlParada::ControlParada(const OpcionesIterativas& opciones, const Matrix& b) : ControlParada(opciones, 0.0) {
+    for (int i = 0; i < b.getRows(); ++i) normaB = std::max(normaB, std::abs(b.at(i, 0)));
+}
+
+void ControlParada::registrar(double medida, MotivoParada motivo) {
+    if (opciones.estadisticas != nullptr) {
+        opciones.estadisticas->iteraciones = iteraciones;
+        opciones.estadisticas->medidaFinal = medida;
+        opciones.estadisticas->motivo = motivo;
+    }
+}
+
+void ControlParada::detener(double medida, MotivoParada motivo, const char* razon) {
+    registrar(medida, motivo);
+    String iterStr; iterStr.fromInt(iteraciones);
+    String msg = String("El método se detuvo tras ") + iterStr + String(" iteraciones: ") + razon + String(".");
+    throw std::runtime_error(msg.c_str());
+}
+
+bool ControlParada::evaluar(const ResultadoBarrido& resultado) {
+    iteraciones++;
+    double medida = resultado.cambio;
+    if (opciones.criterio == CriterioParada::ResiduoAbsoluto) {
+        medida = resultado.residuo;
+    } else if (opciones.criterio == CriterioParada::ResiduoRelativo) {
+        medida = normaB > 0.0 ? resultado.residuo / normaB : resultado.residuo;
+    }
+
+    if (medida < opciones.tolerancia) {
+        registrar(medida, MotivoParada::Convergencia);
+        return true;
+    }
+    if (!std::isfinite(medida)) {
+        detener(medida, MotivoParada::Divergencia, "diverge, la solución dejó de ser finita");
+    }
+    ControlEjecucion* ejecucion = SesionControl::activo();
+    if (ejecucion != nullptr) {
+        EstadoEjecucion estado = ejecucion->verificar(RegionMedida::Iteracion, iteraciones, opciones.maxIter, medida);
+        if (estado != EstadoEjecucion::Activa) {
+            registrar(medida, estado == EstadoEjecucion::Cancelada ? MotivoParada::Cancelacion : MotivoParada::PlazoVencido);
+            detenidoPorControl = true;
+            return true;
+        }
+    }
+
+    crecimientos = medida > medidaPrevia ? crecimientos + 1 : 0;
+    medidaPrevia = medida;
+    if (opciones.iteracionesDivergencia > 0 && crecimientos >= opciones.iteracionesDivergencia) {
+        detener(medida, MotivoParada::Divergencia, "diverge, el error creció en cada una de las últimas iteraciones");
+    }
+
+    if (medida < mejorMedida * (1.0 - opciones.mejoraMinima)) {
+        mejorMedida = medida;
+        sinMejora = 0;
+    } else {
+        sinMejora++;
+    }
+    if (opciones.iteracionesEstancamiento > 0 && sinMejora >= opciones.iteracionesEstancamiento) {
+        detener(medida, MotivoParada::Estancamiento, "se estancó, el error dejó de disminuir");
+    }
+    registrar(medida, MotivoParada::MaximoIteraciones);
+    return false;
+}
+
+bool ControlParada::interrumpido() const {
+    return detenidoPorControl;
+}
+
+void ControlParada::noConvergio() {
+    double medida = opciones.estadisticas != nullptr ? opciones.estadisticas->medidaFinal : medidaPrevia;
+    registrar(medida, MotivoParada::MaximoIteraciones);
+    String maxIterStr; maxIterStr.fromInt(opciones.maxIter);
+    String msg = String("El método no convergió en ") + maxIterStr + String(" iteraciones.");
+    throw std::runtime_error(msg.c_str());
+}
+
+MedicionRendimiento* destinoRendimiento(const OpcionesIterativas& opciones) {
+    if (!opciones.medirRendimiento || opciones.estadisticas == nullptr) {
+        return nullptr;
+    }
+    opciones.estadisticas->rendimiento = MedicionRendimiento();
+    return &opciones.estadisticas->rendimiento;
+}
+
+template<typename T>
+BasicMatrix<T> metodoIterativoEscalar(const BasicMatrix<T>& A, const BasicMatrix<T>& b, const OpcionesIterativas& opciones,
+                                      bool usarValoresActuales) {
+    int n = A.getRows();
+    if (A.getCols() != n || b.getRows() != n || b.getCols() != 1) {
+        throw std::invalid_argument("Las dimensiones de A y b no son compatibles.");
+    }
+    if (opciones.aceleracion != Aceleracion::Ninguna || opciones.aproximacionInicial != nullptr) {
+        throw std::invalid_argument("La iteración genérica no admite aceleración ni aproximación inicial.");
+    }
+    for (int i = 0; i < n; i++) {
+        if (std::abs(A.at(i, i)) < 1e-12) {
+            String pos; pos.fromInt(i);
+            String msg = String("Cero en la diagonal principal en (") + pos + String(",") + pos + String(").");
+            throw std::runtime_error(msg.c_str());
+        }
+    }
+    double normaB = 0.0;
+    for (int i = 0; i < n; i++) normaB = std::max(normaB, static_cast<double>(std::abs(b.at(i, 0))));
+    ControlParada control(opciones, normaB);
+    SesionRendimiento sesion(destinoRendimiento(opciones));
+    bool medirResiduo = opciones.criterio != CriterioParada::Actualizacion;
+
+    BasicMatrix<T> x(n, 1);
+    std::unique_ptr<T[]> anterior = std::make_unique<T[]>(n);
+    for (int iter = 0; iter < opciones.maxIter; iter++) {
+        RegionRendimiento region(RegionMedida::Iteracion, 2.0 * n * n * (medirResiduo ? 2 : 1));
+        for (int i = 0; i < n; i++) anterior[i] = x.at(i, 0);
+        double cambio = 0.0;
+        for (int i = 0; i < n; i++) {
+            const T* fila = &A.at(i, 0);
+            T suma = b.at(i, 0);
+            for (int j = 0; j < n; j++) {
+                if (j == i) continue;
+                suma -= fila[j] * (usarValoresActuales ? x.at(j, 0) : anterior[j]);
+            }
+            T nuevo = suma / fila[i];
+            cambio = std::max(cambio, static_cast<double>(std::abs(nuevo - anterior[i])));
+            x.at(i, 0) = nuevo;
+        }
+        double residuo = 0.0;
+        if (medirResiduo) {
+            for (int i = 0; i < n; i++) {
+                const T* fila = &A.at(i, 0);
+                T suma = b.at(i, 0);
+                for (int j = 0; j < n; j++) suma -= fila[j] * x.at(j, 0);
+                residuo = std::max(residuo, static_cast<double>(std::abs(suma)));
+            }
+        }
+        if (control.evaluar({cambio, residuo})) {
+            return x;
+        }
+    }
+    control.noConvergio();
+}
+
+template BasicMatrix<float> metodoIterativoEscalar(const BasicMatrix<float>&, const BasicMatrix<float>&,
+                                                   const OpcionesIterativas&, bool);
+template Matrix metodoIterativoEscalar(const Matrix&, const Matrix&, const OpcionesIterativas&, bool);
+template BasicMatrix<std::complex<float>> metodoIterativoEscalar(const BasicMatrix<std::complex<float>>&,
+                                                                 const BasicMatrix<std::complex<float>>&,
+                                                                 const OpcionesIterativas&, bool);
+template BasicMatrix<std::complex<double>> metodoIterativoEscalar(const BasicMatrix<std::complex<double>>&,
+                                                                  const BasicMatrix<std::complex<double>>&,
+                                                                  const OpcionesIterativas&, bool);
+
+/**
+ * @brief Barrido de Jacobi o Gauss-Seidel sobre una matriz dispersa, con relajación `omega`.
+ *
+ * Para Gauss-Seidel `origen` y `destino` pueden ser el mismo arreglo. Las filas sin diagonal se dejan igual.
+ */
+void barridoDisperso(const SparseMatrix& A, const double* b, const double* origen, double* destino,
+                     bool usarValoresActuales, bool haciaAtras, double omega) {
     int n = A.getRows();
+    const int* inicio = A.getInicioFila();
+    const int* columnas = A.getColumnas();
+    const double* valores = A.getValores();
+    for (int paso = 0; paso < n; ++paso) {
+        int i = haciaAtras ? n - 1 - paso : paso;
+        double suma = 0.0;
+        double diagonal = 0.0;
+        for (int k = inicio[i]; k < inicio[i + 1]; ++k) {
+            int j = columnas[k];
+            if (j == i) {
+                diagonal = valores[k];
+                continue;
+            }
+            bool actualizado = usarValoresActuales && (haciaAtras ? j > i : j < i);
+            suma += valores[k] * (actualizado ? destino[j] : origen[j]);
+        }
+        if (diagonal == 0.0) {
+            destino[i] = origen[i];
+            continue;
+        }
+        double nuevo = (b[i] - suma) / diagonal;
+        destino[i] = origen[i] + omega * (nuevo - origen[i]);
+    }
+}
+
+/**
+ * @brief Obtiene la diagonal de A y verifica que no tenga ceros, requisito de Jacobi y Gauss-Seidel.
+ *
+ * @throw std::runtime_error Indicando la posición del primer cero encontrado.
+ */
+static std::unique_ptr<double[]> diagonalVerificada(const OperadorLineal& A) {
+    int n = A.getSize();
     const double TOLERANCIA_DIAGONAL = 1e-12;
+    std::unique_ptr<double[]> diagonal = std::make_unique<double[]>(n);
+    A.diagonal(diagonal.get());
     for (int i = 0; i < n; ++i) {
-        if (std::abs(A.at(i, i)) < TOLERANCIA_DIAGONAL) {
+        if (std::abs(diagonal[i]) < TOLERANCIA_DIAGONAL) {
             String pos; pos.fromInt(i);
             String msg = String("Cero en la diagonal principal en (") + pos + String(",") + pos + String(").");
             throw std::runtime_error(msg.c_str());
         }
     }
-    Matrix x(n, 1), xPrev(n, 1);
-    for (int i = 0; i < n; ++i) x.at(i,0) = xPrev.at(i,0) = 0.0;
+    return diagonal;
+}
+
+/**
+ * @brief Sistema A·x = b preparado para los barridos: diagonal verificada, b contiguo y un arreglo de trabajo.
+ */
+struct SistemaIterativo {
+    const OperadorLineal& A;
+    int n;
+    std::unique_ptr<double[]> diagonal;
+    std::unique_ptr<double[]> b;
+    std::unique_ptr<double[]> producto; ///< Recibe A·x en Jacobi sin acceso por filas y al medir el residuo de la iteración devuelta.
+    double normaB;
+    bool medirResiduo; ///< El criterio de parada usa el residuo.
 
-    for (int iter = 0; iter < maxIter; ++iter) {
-        for (int i = 0; i < n; ++i) xPrev.at(i,0) = x.at(i,0);
+    SistemaIterativo(const OperadorLineal& A, const Matrix& terminos, const OpcionesIterativas& opciones,
+                     bool usarValoresActuales)
+        : A(A), n(A.getSize()), normaB(0.0), medirResiduo(opciones.criterio != CriterioParada::Actualizacion) {
+        if (terminos.getRows() != n || terminos.getCols() != 1) {
+            throw std::invalid_argument("El vector de términos independientes no coincide con el tamaño del sistema.");
+        }
+        if (usarValoresActuales && !A.tieneFilas()) {
+            throw std::invalid_argument("Gauss-Seidel requiere un operador con acceso por filas.");
+        }
+        diagonal = diagonalVerificada(A);
+        b = std::make_unique<double[]>(n);
+        for (int i = 0; i < n; ++i) {
+            b[i] = terminos.at(i, 0);
+            normaB = std::max(normaB, std::abs(b[i]));
+        }
+        producto = std::make_unique<double[]>(n);
+    }
+};
+
+/**
+ * @brief Devuelve el punto de partida de la iteración: la aproximación inicial de las opciones o el vector cero.
+ *
+ * @throw std::invalid_argument Si la aproximación inicial no es un vector columna de n filas.
+ */
+static std::unique_ptr<double[]> aproximacionInicial(const OpcionesIterativas& opciones, int n) {
+    std::unique_ptr<double[]> x = std::make_unique<double[]>(n);
+    if (opciones.aproximacionInicial == nullptr) {
+        return x;
+    }
+    if (opciones.aproximacionInicial->getRows() != n || opciones.aproximacionInicial->getCols() != 1) {
+        throw std::invalid_argument("La aproximación inicial no coincide con el tamaño del sistema.");
+    }
+    for (int i = 0; i < n; ++i) x[i] = opciones.aproximacionInicial->at(i, 0);
+    return x;
+}
+
+/**
+ * @brief Copia un arreglo de n elementos en un vector columna.
+ */
+static Matrix aVectorColumna(const double* x, int n) {
+    Matrix resultado(n, 1);
+    for (int i = 0; i < n; ++i) resultado.at(i, 0) = x[i];
+    return resultado;
+}
+
+/**
+ * @brief Aplica un barrido de Jacobi o Gauss-Seidel: destino = G(origen).
+ *
+ * En Gauss-Seidel `destino` parte de una copia de `origen` y se actualiza en su lugar, de modo que cada fila
+ * ve los valores ya actualizados en este barrido; en Jacobi todos los valores se toman de `origen`, fila por
+ * fila si el operador lo permite o con un solo producto A·origen si no.
+ *
+ * @param origen Iteración actual (no se modifica).
+ * @param destino Recibe la nueva iteración; debe ser un arreglo distinto de `origen`.
+ * @param usarValoresActuales Si es true, barrido de Gauss-Seidel; si es false, de Jacobi.
+ * @param haciaAtras Recorre las filas de la última a la primera (segunda mitad del barrido simétrico).
+ * @return ResultadoBarrido Máximo cambio entre `origen` y `destino` y máximo residuo, sin aplicar A otra vez:
+ * el residuo de la fila i es (b_i - Σ_{j≠i} a_ij·x_j) - a_ii·x_i = a_ii·(nuevo_i - x_i). En Jacobi es el residuo
+ * exacto de `origen`; en Gauss-Seidel mezcla valores de `origen` y `destino` y no corresponde a ninguno de los dos
+ * (ver residuoIteracion).
+ */
+static ResultadoBarrido barridoEstacionario(SistemaIterativo& sistema, const double* origen, double* destino, bool usarValoresActuales, bool haciaAtras) {
+    int n = sistema.n;
+    const double* diagonal = sistema.diagonal.get();
+    const double* b = sistema.b.get();
+    double error = 0.0;
+    double residuo = 0.0;
+    double operaciones = sistema.A.operacionesProducto();
+    RegionRendimiento region(RegionMedida::Iteracion, operaciones > 0.0 ? operaciones + 3.0 * n : 0.0);
+
+    if (!sistema.A.tieneFilas()) {
+        // Jacobi sin acceso por filas: nuevo_i = x_i + (b_i - (A·x)_i) / a_ii
+        double* producto = sistema.producto.get();
+        sistema.A.aplicar(origen, producto);
+        for (int i = 0; i < n; ++i) {
+            double nuevo = origen[i] + (b[i] - producto[i]) / diagonal[i];
+            double cambio = std::abs(nuevo - origen[i]);
+            error = std::max(error, cambio);
+            residuo = std::max(residuo, std::abs(diagonal[i]) * cambio);
+            destino[i] = nuevo;
+        }
+        return ResultadoBarrido{error, residuo};
+    }
+
+    if (usarValoresActuales) {
+        std::copy(origen, origen + n, destino);
+    }
+    // Gauss-Seidel lee los valores ya actualizados de destino; Jacobi, los anteriores de origen
+    const double* lectura = usarValoresActuales ? destino : origen;
+    for (int k = 0; k < n; ++k) {
+        int i = haciaAtras ? n - 1 - k : k;
+        double suma = sistema.A.sumaFueraDiagonal(i, lectura);
+        double nuevo = (b[i] - suma) / diagonal[i];
+        double cambio = std::abs(nuevo - origen[i]);
+        error = std::max(error, cambio);
+        residuo = std::max(residuo, std::abs(diagonal[i]) * cambio);
+        destino[i] = nuevo;
+    }
+    return ResultadoBarrido{error, residuo};
+}
+
+/**
+ * @brief Residuo ||b - A·x||∞ de la iteración `x`, con un producto adicional por A.
+ *
+ * Se usa cuando el criterio de parada mide el residuo y el vector que se devuelve no es el que midió el barrido:
+ * en Gauss-Seidel, en la semi-iteración de Chebyshev y en la mezcla de Anderson.
+ */
+static double residuoIteracion(SistemaIterativo& sistema, const double* x) {
+    int n = sistema.n;
+    double operaciones = sistema.A.operacionesProducto();
+    RegionRendimiento region(RegionMedida::Iteracion, operaciones > 0.0 ? operaciones + n : 0.0);
+    double* producto = sistema.producto.get();
+    sistema.A.aplicar(x, producto);
+    double residuo = 0.0;
+    for (int i = 0; i < n; ++i) {
+        residuo = std::max(residuo, std::abs(sistema.b[i] - producto[i]));
+    }
+    return residuo;
+}
+
+/**
+ * @brief Barrido usado por la semi-iteración de Chebyshev: Jacobi, o Gauss-Seidel simétrico (adelante y atrás).
+ *
+ * El barrido simétrico recorre la matriz dos veces pero es un solo paso de la iteración: ControlParada lo cuenta
+ * como una iteración, así que con Gauss-Seidel `maxIter` y las estadísticas miden pasos simétricos.
+ */
+static ResultadoBarrido barridoChebyshev(SistemaIterativo& sistema, const double* origen, double* destino, double* temporal, bool usarValoresActuales) {
+    if (!usarValoresActuales) {
+        return barridoEstacionario(sistema, origen, destino, false, false);
+    }
+    ResultadoBarrido resultado = barridoEstacionario(sistema, origen, temporal, true, false);
+    barridoEstacionario(sistema, temporal, destino, true, true);
+    resultado.cambio = 0.0;
+    for (int i = 0; i < sistema.n; ++i) {
+        resultado.cambio = std::max(resultado.cambio, std::abs(destino[i] - origen[i]));
+    }
+    return resultado;
+}
+
+/**
+ * @brief Barridos estacionarios simples: x_{k+1} = G(x_k).
+ *
+ * Con un criterio de residuo, Jacobi devuelve x_k, cuyo residuo exacto midió el barrido sin costo extra;
+ * Gauss-Seidel devuelve x_{k+1} y calcula su residuo con residuoIteracion.
+ */
+static Matrix iteracionSimple(SistemaIterativo& sistema, const OpcionesIterativas& opciones, bool usarValoresActuales) {
+    int n = sistema.n;
+    std::unique_ptr<double[]> x = aproximacionInicial(opciones, n);
+    std::unique_ptr<double[]> xNuevo = std::make_unique<double[]>(n);
+    ControlParada control(opciones, sistema.normaB);
+    bool devolverMedido = sistema.medirResiduo && !usarValoresActuales;
+    for (int iter = 0; iter < opciones.maxIter; ++iter) {
+        ResultadoBarrido resultado = barridoEstacionario(sistema, x.get(), xNuevo.get(), usarValoresActuales, false);
+        if (sistema.medirResiduo && usarValoresActuales) resultado.residuo = residuoIteracion(sistema, xNuevo.get());
+        std::swap(x, xNuevo);
+        if (control.evaluar(resultado)) return aVectorColumna(devolverMedido ? xNuevo.get() : x.get(), n);
+    }
+    control.noConvergio();
+}
+
+/**
+ * @brief Semi-iteración de Chebyshev sobre el barrido de Jacobi o Gauss-Seidel simétrico.
+ *
+ * x_{k+1} = ω_{k+1}·(G(x_k) - x_{k-1}) + x_{k-1}, con ω_1 = 1, ω_2 = 2/(2 - ρ²) y
+ * ω_{k+1} = 1/(1 - ρ²·ω_k/4). Si no se proporciona ρ, se estima con el cociente entre los cambios
+ * de barridos simples consecutivos (como en el método de la potencia) durante las primeras iteraciones.
+ * Si la estimación no es menor a 1 no hay aceleración posible y se continúa con barridos simples.
+ * Con un criterio de residuo se mide b - A·x del vector extrapolado, que es el que se devuelve.
+ */
+static Matrix iteracionChebyshev(SistemaIterativo& sistema, const OpcionesIterativas& opciones, bool usarValoresActuales) {
+    const int ITERACIONES_ESTIMACION = 10;
+    int n = sistema.n;
+    std::unique_ptr<double[]> x = aproximacionInicial(opciones, n);
+    std::unique_ptr<double[]> xAnterior = std::make_unique<double[]>(n);
+    std::unique_ptr<double[]> xNuevo = std::make_unique<double[]>(n);
+    std::unique_ptr<double[]> temporal = std::make_unique<double[]>(n);
+    ControlParada control(opciones, sistema.normaB);
+    int iter = 0;
+
+    double rho = opciones.radioEspectral;
+    bool acelerar = rho > 0.0 && rho < 1.0;
+    if (!acelerar) {
+        double errorPrevio = 0.0;
+        for (; iter < opciones.maxIter && iter < ITERACIONES_ESTIMACION; ++iter) {
+            ResultadoBarrido resultado = barridoChebyshev(sistema, x.get(), xNuevo.get(), temporal.get(), usarValoresActuales);
+            std::swap(x, xNuevo);
+            if (sistema.medirResiduo) resultado.residuo = residuoIteracion(sistema, x.get());
+            if (control.evaluar(resultado)) return aVectorColumna(x.get(), n);
+            if (errorPrevio > 0.0) rho = resultado.cambio / errorPrevio;
+            errorPrevio = resultado.cambio;
+        }
+        acelerar = rho > 0.0 && rho < 1.0;
+    }
+
+    if (!acelerar) {
+        for (; iter < opciones.maxIter; ++iter) {
+            ResultadoBarrido resultado = barridoChebyshev(sistema, x.get(), xNuevo.get(), temporal.get(), usarValoresActuales);
+            std::swap(x, xNuevo);
+            if (sistema.medirResiduo) resultado.residuo = residuoIteracion(sistema, x.get());
+            if (control.evaluar(resultado)) return aVectorColumna(x.get(), n);
+        }
+        control.noConvergio();
+    }
+
+    double rho2 = rho * rho;
+    double omega = 1.0;
+    for (int paso = 0; iter < opciones.maxIter; ++iter, ++paso) {
+        ResultadoBarrido resultado = barridoChebyshev(sistema, x.get(), xNuevo.get(), temporal.get(), usarValoresActuales);
+        if (paso == 0) {
+            // ω_1 = 1: el primer paso es un barrido simple y x_{k-1} aún no existe
+            std::copy(x.get(), x.get() + n, xAnterior.get());
+        }
         double error = 0.0;
         for (int i = 0; i < n; ++i) {
-            double suma = 0.0;
-            for (int j = 0; j < n; ++j) {
-                if (j == i) continue;
-                if (usarValoresActuales && j < i)
-                    suma += A.at(i, j) * x.at(j, 0); // Gauss-Seidel: usa el valor ya actualizado
-                else
-                    suma += A.at(i, j) * xPrev.at(j, 0); // Jacobi: usa el valor anterior
+            double anterior = xAnterior[i];
+            double nuevo = omega * (xNuevo[i] - anterior) + anterior;
+            error = std::max(error, std::abs(nuevo - x[i]));
+            xAnterior[i] = x[i];
+            x[i] = nuevo;
+        }
+        resultado.cambio = error;
+        if (sistema.medirResiduo) resultado.residuo = residuoIteracion(sistema, x.get());
+        if (control.evaluar(resultado)) return aVectorColumna(x.get(), n);
+        omega = paso == 0 ? 2.0 / (2.0 - rho2) : 1.0 / (1.0 - rho2 * omega / 4.0);
+    }
+    control.noConvergio();
+}
+
+/**
+ * @brief Mezcla de Anderson sobre el barrido de Jacobi o Gauss-Seidel.
+ *
+ * Con g_k = G(x_k) y f_k = g_k - x_k, guarda las diferencias ΔF y ΔG de las últimas `m` iteraciones y
+ * calcula x_{k+1} = g_k - ΔG·γ, donde γ minimiza ||f_k - ΔF·γ||₂ (por Gram-Schmidt modificado, más estable
+ * que las ecuaciones normales cerca de la convergencia). Si las columnas de ΔF dejan de ser linealmente
+ * independientes se descarta el historial y se continúa con un barrido simple.
+ * Con un criterio de residuo se mide b - A·g_k, ya que g_k es el vector que se devuelve al converger.
+ */
+static Matrix iteracionAnderson(SistemaIterativo& sistema, const OpcionesIterativas& opciones, bool usarValoresActuales) {
+    const double TOLERANCIA_DEPENDENCIA = 1e-10;
+    int n = sistema.n;
+    int m = std::max(1, opciones.profundidadAnderson);
+    std::unique_ptr<double[]> x = aproximacionInicial(opciones, n);
+    std::unique_ptr<double[]> g = std::make_unique<double[]>(n);
+    std::unique_ptr<double[]> fPrevio = std::make_unique<double[]>(n);
+    std::unique_ptr<double[]> gPrevio = std::make_unique<double[]>(n);
+    Matrix deltaF(n, m), deltaG(n, m);
+    // Factores de Gram-Schmidt con capacidad para m columnas; en cada iteración se usan las primeras `usadas`
+    Matrix Q(n, m), R(m, m), proyeccion(m, 1);
+    int usadas = 0;
+    int posicion = 0;
+    ControlParada control(opciones, sistema.normaB);
+
+    for (int iter = 0; iter < opciones.maxIter; ++iter) {
+        ResultadoBarrido resultado = barridoEstacionario(sistema, x.get(), g.get(), usarValoresActuales, false);
+        if (sistema.medirResiduo) resultado.residuo = residuoIteracion(sistema, g.get());
+        if (control.evaluar(resultado)) return aVectorColumna(g.get(), n);
+
+        // Actualizar el historial con las diferencias respecto a la iteración anterior
+        for (int i = 0; i < n; ++i) {
+            double f = g[i] - x[i];
+            if (iter > 0) {
+                deltaF.at(i, posicion) = f - fPrevio[i];
+                deltaG.at(i, posicion) = g[i] - gPrevio[i];
+            }
+            fPrevio[i] = f;
+            gPrevio[i] = g[i];
+        }
+        if (iter > 0) {
+            posicion = (posicion + 1) % m;
+            usadas = std::min(usadas + 1, m);
+        }
+
+        bool mezclado = false;
+        if (usadas > 0) {
+            // Mínimos cuadrados por Gram-Schmidt modificado: ΔF = Q·R, γ = R⁻¹·Qᵀ·f_k
+            bool independientes = true;
+            for (int p = 0; p < usadas && independientes; ++p) {
+                double normaOriginal = 0.0;
+                for (int i = 0; i < n; ++i) {
+                    Q.at(i, p) = deltaF.at(i, p);
+                    normaOriginal += Q.at(i, p) * Q.at(i, p);
+                }
+                for (int q = 0; q < p; ++q) {
+                    double producto = 0.0;
+                    for (int i = 0; i < n; ++i) producto += Q.at(i, q) * Q.at(i, p);
+                    R.at(q, p) = producto;
+                    for (int i = 0; i < n; ++i) Q.at(i, p) -= producto * Q.at(i, q);
+                }
+                double norma = 0.0;
+                for (int i = 0; i < n; ++i) norma += Q.at(i, p) * Q.at(i, p);
+                norma = std::sqrt(norma);
+                if (norma <= TOLERANCIA_DEPENDENCIA * std::sqrt(normaOriginal)) {
+                    independientes = false;
+                    break;
+                }
+                R.at(p, p) = norma;
+                for (int i = 0; i < n; ++i) Q.at(i, p) /= norma;
+            }
+            if (independientes) {
+                for (int p = 0; p < usadas; ++p) {
+                    double producto = 0.0;
+                    for (int i = 0; i < n; ++i) producto += Q.at(i, p) * fPrevio[i];
+                    proyeccion.at(p, 0) = producto;
+                }
+                for (int p = usadas - 1; p >= 0; --p) {
+                    double suma = proyeccion.at(p, 0);
+                    for (int q = p + 1; q < usadas; ++q) suma -= R.at(p, q) * proyeccion.at(q, 0);
+                    proyeccion.at(p, 0) = suma / R.at(p, p);
+                }
+                for (int i = 0; i < n; ++i) {
+                    double correccion = 0.0;
+                    for (int p = 0; p < usadas; ++p) correccion += deltaG.at(i, p) * proyeccion.at(p, 0);
+                    x[i] = g[i] - correccion;
+                }
+                mezclado = true;
+            } else {
+                // El historial perdió independencia lineal: se descarta y se reinicia
+                usadas = 0;
+                posicion = 0;
             }
-            double nuevo = (b.at(i, 0) - suma) / A.at(i, i);
-            error = std::max(error, std::abs(nuevo - x.at(i,0)));
-            x.at(i,0) = nuevo;
         }
-        if (error < tolerancia) return x;
+        if (!mezclado) {
+            std::copy(g.get(), g.get() + n, x.get());
+        }
     }
-    String maxIterStr; maxIterStr.fromInt(maxIter);
-    String msg = String("El método no convergió en ") + maxIterStr + String(" iteraciones.");
-    throw std::runtime_error(msg.c_str());
-}
\ No newline at end of file
+    control.noConvergio();
+}
+
+/**
+ * @brief Método iterativo generalizado para Jacobi y Gauss-Seidel sobre un operador lineal.
+ *
+ * @param A Operador del sistema; Gauss-Seidel requiere acceso por filas.
+ * @param b Vector columna de términos independientes (no se modifica).
+ * @param opciones Tolerancia, iteraciones máximas y aceleración a utilizar.
+ * @param usarValoresActuales Si es true, utiliza el método de Gauss-Seidel; si es false, utiliza Jacobi.
+ * @return Matrix Vector solución del sistema.
+ *
+ * @throw std::runtime_error Si hay ceros en la diagonal o el método no converge.
+ * @throw std::invalid_argument Si b no coincide con el operador o se pide Gauss-Seidel sin acceso por filas.
+ */
+Matrix metodoIterativoGeneral(const OperadorLineal& A, const Matrix& b, const OpcionesIterativas& opciones, bool usarValoresActuales) {
+    SistemaIterativo sistema(A, b, opciones, usarValoresActuales);
+    SesionRendimiento sesion(destinoRendimiento(opciones));
+    switch (opciones.aceleracion) {
+    case Aceleracion::Anderson:
+        return iteracionAnderson(sistema, opciones, usarValoresActuales);
+    case Aceleracion::Chebyshev:
+        return iteracionChebyshev(sistema, opciones, usarValoresActuales);
+    case Aceleracion::Ninguna:
+        break;
+    }
+    return iteracionSimple(sistema, opciones, usarValoresActuales);
+}
+
+/**
+ * @brief Método iterativo generalizado para Jacobi y Gauss-Seidel con opciones de aceleración.
+ *
+ * @param A Matriz de coeficientes del sistema (no se modifica).
+ * @param b Vector columna de términos independientes (no se modifica).
+ * @param opciones Tolerancia, iteraciones máximas y aceleración a utilizar.
+ * @param usarValoresActuales Si es true, utiliza el método de Gauss-Seidel; si es false, utiliza Jacobi.
+ * @return Matrix Vector solución del sistema.
+ *
+ * @throw std::runtime_error Si hay ceros en la diagonal o el método no converge.
+ */
+Matrix metodoIterativoGeneral(Matrix& A, Matrix& b, const OpcionesIterativas& opciones, bool usarValoresActuales) {
+    OperadorMatriz operador(A);
+    return metodoIterativoGeneral(operador, b, opciones, usarValoresActuales);
+}
@@ -10,6 +10,28 @@
 #define UTILS_HPP
 
 #include "Matrix.hpp"
+#include "IterativeOptions.hpp"
+#include "Trace.hpp"
+#include "SparseMatrix.hpp"
+#include "LinearOperator.hpp"
+
+/**
+ * @brief Forma de elegir el pivote en la eliminación hacia adelante.
+ *
+ * Los intercambios de filas se hacen con BasicMatrix::intercambiarFilas (O(1)); los de columnas, necesarios
+ * en el pivoteo de torre y el completo, mueven una columna entera y reordenan las incógnitas.
+ */
+enum class EstrategiaPivoteo {
+    Parcial,   ///< Mayor valor absoluto de la columna (una búsqueda de O(n) por paso).
+    Torre,     ///< Elemento máximo a la vez en su fila y en su columna; casi tan estable como el completo y mucho más barato.
+    Completo,  ///< Mayor valor absoluto de toda la submatriz restante (O(n²) por paso).
+    SinPivoteo ///< Usa la diagonal sin buscar ni intercambiar; solo es seguro si A es diagonal dominante.
+};
+
+/**
+ * @brief Indica si la estrategia intercambia columnas (y por lo tanto reordena las incógnitas).
+ */
+bool pivoteaColumnas(EstrategiaPivoteo estrategia);
 
 /**
  * @brief Realiza la eliminación hacia adelante (triangulación) del sistema Ax = b.
@@ -20,25 +42,67 @@
  *
  * @param A Matriz de coeficientes (modificada en el proceso).
  * @param b Vector columna de términos independientes (modificado en el proceso).
- * @param mostrarPasos Si es verdadero, imprime cada paso si el sistema es pequeño (≤ 10 ecuaciones).
+ * @param mostrarPasos Si es verdadero, imprime cada paso si el sistema es pequeño (≤ 10 ecuaciones); solo con double.
+ * @param estrategia Forma de elegir los pivotes.
+ * @param columnas Arreglo de n enteros que recibe la permutación de columnas: la incógnita de la posición k
+ * del sistema triangular es x[columnas[k]]. Solo se necesita con pivoteo de torre o completo.
  *
  * @throws std::runtime_error Si el sistema es numéricamente inestable o inconsistente.
+ * @throws std::invalid_argument Si la estrategia intercambia columnas y `columnas` es nulo.
  */
-void forwardElimination(Matrix& A, Matrix& b, bool mostrarPasos);
+template<typename T>
+void forwardElimination(BasicMatrix<T>& A, BasicMatrix<T>& b, bool mostrarPasos,
+                        EstrategiaPivoteo estrategia = EstrategiaPivoteo::Parcial, int* columnas = nullptr);
 
 /**
  * @brief Realiza la eliminación hacia atrás y normalización de pivotes en la matriz A.
  *
  * Esta función convierte A en una matriz identidad (forma reducida por filas) mediante
- * eliminación hacia atrás y normalización de pivotes. Es el paso final del método de Gauss-Jordan.
+ * eliminación hacia atrás y normalización de pivotes. Es el paso final del método de Gauss-Jordan y espera
+ * la matriz triangular superior que deja forwardElimination; solo actualiza la columna de cada pivote y b.
  *
  * @param A Matriz de coeficientes (modificada).
  * @param b Vector columna de términos independientes (modificado).
- * @param mostrarPasos Si es verdadero, imprime los pasos si el sistema es pequeño.
+ * @param mostrarPasos Si es verdadero, imprime los pasos si el sistema es pequeño; solo con double.
  *
  * @throws std::runtime_error Si se detectan pivotes demasiado pequeños o inconsistencias numéricas.
  */
-void backwardElimination(Matrix& A, Matrix& b, bool mostrarPasos);
+template<typename T>
+void backwardElimination(BasicMatrix<T>& A, BasicMatrix<T>& b, bool mostrarPasos);
+
+/**
+ * @brief Núcleo de la eliminación hacia adelante que registra sus pasos en `traza`.
+ *
+ * La política de traza (TrazaNula, TrazaMemoria o TrazaArchivoBinario) se elige en tiempo de compilación;
+ * con TrazaNula el núcleo no tiene ningún costo adicional. Está instanciado con las tres trazas para double
+ * y con TrazaNula para float, std::complex<float> y std::complex<double>; en los complejos el pivote es
+ * el de mayor módulo.
+ *
+ * @param A Matriz de coeficientes (modificada en el proceso).
+ * @param b Vector columna de términos independientes (modificado en el proceso).
+ * @param traza Política de traza que recibe los pasos.
+ * @param estrategia Forma de elegir los pivotes.
+ * @param columnas Permutación de columnas resultante (ver la versión con `mostrarPasos`); puede ser nulo
+ * si la estrategia no intercambia columnas.
+ *
+ * @throws std::runtime_error Si el sistema es numéricamente inestable o inconsistente.
+ * @throws std::invalid_argument Si la estrategia intercambia columnas y `columnas` es nulo.
+ */
+template<typename T, typename Traza>
+void forwardElimination(BasicMatrix<T>& A, BasicMatrix<T>& b, Traza& traza,
+                        EstrategiaPivoteo estrategia = EstrategiaPivoteo::Parcial, int* columnas = nullptr);
+
+/**
+ * @brief Núcleo de la eliminación hacia atrás de Gauss-Jordan que registra sus pasos en `traza`.
+ *
+ * @param A Matriz triangular superior que deja forwardElimination (modificada).
+ * @param b Vector columna de términos independientes (modificado).
+ * @param traza Política de traza que recibe los pasos.
+ *
+ * @throws std::runtime_error Si se detectan pivotes demasiado pequeños.
+ */
+template<typename T, typename Traza>
+void backwardElimination(BasicMatrix<T>& A, BasicMatrix<T>& b, Traza& traza);
 
 /**
  * @brief Método iterativo generalizado para Jacobi y Gauss-Seidel.
@@ -54,4 +118,153 @@ void backwardElimination(Matrix& A, Matrix& b, bool mostrarPasos);
  */
 Matrix metodoIterativoGeneral(Matrix& A, Matrix& b, double tolerancia, int maxIter, bool usarValoresActuales);
 
+/**
+ * @brief Método iterativo generalizado para Jacobi y Gauss-Seidel con opciones de aceleración.
+ *
+ * Con `Aceleracion::Ninguna` realiza los mismos barridos que la versión sin opciones. Con `Anderson`
+ * combina las últimas iteraciones para extrapolar el punto fijo, y con `Chebyshev` aplica la semi-iteración
+ * de Chebyshev sobre el barrido (en Gauss-Seidel se usa el barrido simétrico, hacia adelante y hacia atrás,
+ * para que los valores propios de la matriz de iteración sean reales). En todos los casos el criterio de
+ * parada es el de `opciones.criterio`, con a lo más `maxIter` iteraciones y, si se activan, las detecciones de
+ * divergencia y estancamiento. Cada iteración es un barrido, salvo en Chebyshev con Gauss-Seidel, donde el
+ * barrido simétrico cuenta como una sola iteración aunque cuesta dos barridos.
+ *
+ * @param A Matriz de coeficientes del sistema (no se modifica).
+ * @param b Vector columna de términos independientes (no se modifica).
+ * @param opciones Tolerancia, criterio de parada, iteraciones máximas y aceleración a utilizar.
+ * @param usarValoresActuales Si es true, utiliza el método de Gauss-Seidel; si es false, utiliza Jacobi.
+ * @return Matrix Vector solución del sistema.
+ *
+ * @throw std::runtime_error Si hay ceros en la diagonal, el método no converge, diverge o se estanca.
+ */
+Matrix metodoIterativoGeneral(Matrix& A, Matrix& b, const OpcionesIterativas& opciones, bool usarValoresActuales);
+
+/**
+ * @brief Método iterativo generalizado para Jacobi y Gauss-Seidel sobre un operador lineal, sin formar la matriz.
+ *
+ * Realiza los mismos barridos y aceleraciones que la versión con Matrix. Jacobi recorre las filas del operador
+ * si este lo permite y, si no, usa un producto A·x por barrido; Gauss-Seidel requiere acceso por filas.
+ *
+ * @param A Operador del sistema.
+ * @param b Vector columna de términos independientes (no se modifica).
+ * @param opciones Tolerancia, criterio de parada, iteraciones máximas y aceleración a utilizar.
+ * @param usarValoresActuales Si es true, utiliza el método de Gauss-Seidel; si es false, utiliza Jacobi.
+ * @return Matrix Vector solución del sistema.
+ *
+ * @throw std::runtime_error Si hay ceros en la diagonal, el método no converge, diverge o se estanca.
+ * @throw std::invalid_argument Si b no coincide con el operador o se pide Gauss-Seidel sin acceso por filas.
+ */
+Matrix metodoIterativoGeneral(const OperadorLineal& A, const Matrix& b, const OpcionesIterativas& opciones, bool usarValoresActuales);
+
+/**
+ * @brief Cambio y residuo medidos durante una iteración, en norma infinito.
+ */
+struct ResultadoBarrido {
+    double cambio;
+    double residuo;
+};
+
+/**
+ * @class ControlParada
+ * @brief Aplica el criterio de parada y la detección de divergencia y estancamiento de OpcionesIterativas.
+ *
+ * Cada método iterativo llama a `evaluar` una vez por iteración; el control lleva la cuenta de las
+ * iteraciones, decide si el método convergió y lanza la excepción correspondiente si debe detenerse
+ * antes de tiempo. En todos los casos deja el resumen en `opciones.estadisticas`.
+ */
+class ControlParada {
+    private:
+        const OpcionesIterativas& opciones;
+        double normaB;
+        double medidaPrevia;
+        double mejorMedida;
+        int crecimientos;
+        int sinMejora;
+        int iteraciones;
+        bool detenidoPorControl;
+
+        void registrar(double medida, MotivoParada motivo);
+        [[noreturn]] void detener(double medida, MotivoParada motivo, const char* razon);
+    public:
+        /**
+        * @brief Crea el control para un sistema cuyo término independiente tiene norma infinito `normaB`.
+        */
+        ControlParada(const OpcionesIterativas& opciones, double normaB);
+
+        /**
+        * @brief Crea el control para el sistema con término independiente `b`.
+        */
+        ControlParada(const OpcionesIterativas& opciones, const Matrix& b);
+
+        /**
+        * @brief Registra una iteración y devuelve true si el método convergió o debe detenerse.
+        *
+        * También es el punto de verificación del ControlEjecucion activo: envía el aviso de progreso y, si la
+        * solución fue cancelada o venció su plazo, devuelve true para que el método entregue su última
+        * iteración; el motivo queda en las estadísticas.
+        *
+        * @throw std::runtime_error Si se detecta divergencia o estancamiento.
+        */
+        bool evaluar(const ResultadoBarrido& resultado);
+
+        /**
+        * @brief Indica si el último `evaluar` devolvió true por cancelación o plazo vencido y no por convergencia.
+        *
+        * Los métodos que confirman la convergencia con otra medida después de `evaluar` deben consultarlo y
+        * entregar la iteración actual sin continuar.
+        */
+        bool interrumpido() const;
+
+        /**
+        * @brief Lanza la excepción de falta de convergencia con el número de iteraciones permitidas.
+        */
+        [[noreturn]] void noConvergio();
+};
+
+/**
+ * @brief Medición donde un método iterativo debe dejar sus contadores, o nullptr si no se pidió medir.
+ *
+ * Los métodos la pasan a una SesionRendimiento al comenzar.
+ */
+MedicionRendimiento* destinoRendimiento(const OpcionesIterativas& opciones);
+
+/**
+ * @brief Jacobi o Gauss-Seidel sin aceleración para matrices de cualquier tipo de elemento.
+ *
+ * Es el barrido de metodoIterativoGeneral escrito directamente sobre BasicMatrix<T>, para los tipos que no
+ * admite el resto de la maquinaria iterativa (que trabaja en double). Aplica el criterio de parada y las
+ * detecciones de OpcionesIterativas; las medidas se calculan con el módulo de cada elemento. Está instanciado
+ * para float, double, std::complex<float> y std::complex<double>.
+ *
+ * @param A Matriz cuadrada de coeficientes (no se modifica).
+ * @param b Vector columna de términos independientes (no se modifica).
+ * @param opciones Tolerancia, criterio de parada e iteraciones máximas; no admite aceleración ni aproximación inicial.
+ * @param usarValoresActuales Si es true, utiliza el método de Gauss-Seidel; si es false, utiliza Jacobi.
+ * @return BasicMatrix<T> Vector solución del sistema.
+ *
+ * @throw std::invalid_argument Si las dimensiones no son compatibles o se pide aceleración o aproximación inicial.
+ * @throw std::runtime_error Si hay ceros en la diagonal, el método no converge, diverge o se estanca.
+ */
+template<typename T>
+BasicMatrix<T> metodoIterativoEscalar(const BasicMatrix<T>& A, const BasicMatrix<T>& b, const OpcionesIterativas& opciones,
+                                      bool usarValoresActuales);
+
+/**
+ * @brief Barrido de Jacobi o Gauss-Seidel sobre una matriz dispersa en formato CSR.
+ *
+ * Es el suavizador de los métodos multimalla. Con `usarValoresActuales` se usan los valores ya actualizados
+ * de `destino` (Gauss-Seidel, en cuyo caso `origen` y `destino` pueden ser el mismo arreglo); si no, solo
+ * los de `origen` (Jacobi). El resultado se relaja con `omega`: destino = origen + omega·(nuevo - origen).
+ *
+ * @param A Matriz dispersa cuadrada.
+ * @param b Término independiente.
+ * @param origen Iteración actual.
+ * @param destino Iteración siguiente.
+ * @param usarValoresActuales Si es true, utiliza el método de Gauss-Seidel; si es false, utiliza Jacobi.
+ * @param haciaAtras Recorre las filas de la última a la primera.
+ * @param omega Factor de relajación (1 para el barrido sin relajar).
+ */
+void barridoDisperso(const SparseMatrix& A, const double* b, const double* origen, double* destino,
+                     bool usarValoresActuales, bool haciaAtras, double omega = 1.0);
+
 #endif
\ No newline at end of file